@@ -0,0 +1,174 @@
+#include <assert.h> /**< Necessário para uso da macro "assert". */
+#include <atomic> /**< Necessário para uso de std::atomic. */
+#include <cstdlib> /**< Necessário para uso do NULL. */
+#include "../comum/cache.hpp"
+#include "filadconc.hpp"
+
+using namespace std;
+
+/*
+ * Vetor circular com capacidade potência de dois. Os elementos são atômicos (acessados de forma
+ * relaxada) porque uma ladra pode ler uma posição ao mesmo tempo em que a dona a reescreve; nesse
+ * caso, a comparação e troca da ladra falha e o valor lido é descartado.
+ */
+struct VetorCircular {
+	long long capacidade; /**< Quantidade de posições do vetor. */
+	long long mascara; /**< Igual a capacidade - 1. */
+	atomic<int>* itens; /**< Posições do vetor. */
+	VetorCircular* anterior; /**< Vetor substituído por este no último crescimento. */
+};
+
+/*
+ * Os índices inicio e fim apenas crescem; a posição no vetor é obtida com "indice & mascara".
+ * O índice inicio é disputado pelas ladras e o índice fim pertence à dona: por isso, ficam em
+ * linhas de cache distintas.
+ */
+struct FilaDConc {
+	alignas(TAM_LINHA_CACHE) atomic<long long> inicio; /**< Posição do primeiro elemento (lado das ladras). */
+	alignas(TAM_LINHA_CACHE) atomic<long long> fim; /**< Próxima posição vazia (lado da dona). */
+	atomic<VetorCircular*> vetor; /**< Vetor em uso. */
+};
+
+static VetorCircular* criar_vetor(long long capacidade, VetorCircular* anterior) {
+	VetorCircular* v = new VetorCircular;
+	v->capacidade = capacidade;
+	v->mascara = capacidade - 1;
+	v->itens = new atomic<int>[capacidade];
+	v->anterior = anterior;
+	return v;
+}
+
+FilaDConc* criar_fila_d_conc(int capacidade) {
+	assert((capacidade >= 1) && (capacidade <= (1 << 30)));
+
+	long long cap = 1;
+	while (cap < capacidade) {
+		cap *= 2;
+	}
+
+	/*
+	 * Caso não seja possível alocar o espaço solicitado, o próprio operador "new"
+	 * irá lançar uma exceção abortando a execução do programa.
+	 */
+	FilaDConc* fila = new FilaDConc;
+
+	fila->inicio.store(0, memory_order_relaxed);
+	fila->fim.store(0, memory_order_relaxed);
+	fila->vetor.store(criar_vetor(cap, NULL), memory_order_relaxed);
+	return fila;
+}
+
+void liberar_fila(FilaDConc* fila) {
+	/*
+	 * Macro da biblioteca \file assert.h. Aborta a execução do programa e envia uma mensagem
+	 * de erro para a saída de erro padrão, caso a expressão entre parênteses seja avaliada
+	 * como false.
+	 */
+	assert(fila != NULL);
+
+	// Libera o vetor em uso e todos os vetores que ele substituiu.
+	VetorCircular* v = fila->vetor.load(memory_order_relaxed);
+	while (v != NULL) {
+		VetorCircular* anterior = v->anterior;
+		delete[] v->itens;
+		delete v;
+		v = anterior;
+	}
+	delete fila;
+}
+
+/* Copia os elementos das posições [inicio, fim) para um vetor com o dobro da capacidade. */
+static VetorCircular* crescer(FilaDConc* fila, VetorCircular* v, long long inicio, long long fim) {
+	VetorCircular* novo = criar_vetor(2 * v->capacidade, v);
+	for (long long i = inicio; i < fim; i++) {
+		novo->itens[i & novo->mascara].store(v->itens[i & v->mascara].load(memory_order_relaxed), memory_order_relaxed);
+	}
+	/* "release" garante que as ladras que lerem o novo vetor enxerguem os elementos copiados. */
+	fila->vetor.store(novo, memory_order_release);
+	return novo;
+}
+
+void inserir_no_fim(FilaDConc* fila, int item) {
+	assert(fila != NULL);
+
+	long long fim = fila->fim.load(memory_order_relaxed);
+	long long inicio = fila->inicio.load(memory_order_acquire);
+	VetorCircular* v = fila->vetor.load(memory_order_relaxed);
+	if (fim - inicio > v->capacidade - 1) {
+		v = crescer(fila, v, inicio, fim);
+	}
+	v->itens[fim & v->mascara].store(item, memory_order_relaxed);
+
+	/* A barreira publica o elemento antes do novo valor do índice fim. */
+	atomic_thread_fence(memory_order_release);
+	fila->fim.store(fim + 1, memory_order_relaxed);
+}
+
+bool remover_do_fim(FilaDConc* fila, int* item) {
+	assert(fila != NULL);
+	assert(item != NULL);
+
+	/*
+	 * A dona reserva o último elemento decrementando o índice fim antes de ler o índice inicio.
+	 * A barreira seq_cst garante que uma ladra concorrente veja o novo fim ou que a dona veja
+	 * o novo inicio da ladra: as duas nunca levam o mesmo elemento sem disputá-lo.
+	 */
+	long long fim = fila->fim.load(memory_order_relaxed) - 1;
+	VetorCircular* v = fila->vetor.load(memory_order_relaxed);
+	fila->fim.store(fim, memory_order_relaxed);
+	atomic_thread_fence(memory_order_seq_cst);
+	long long inicio = fila->inicio.load(memory_order_relaxed);
+
+	if (inicio > fim) {
+		/* A fila estava vazia: desfaz a reserva. */
+		fila->fim.store(fim + 1, memory_order_relaxed);
+		return false;
+	}
+
+	*item = v->itens[fim & v->mascara].load(memory_order_relaxed);
+	if (inicio < fim) {
+		/* Ainda restam outros elementos: nenhuma ladra pode estar disputando este. */
+		return true;
+	}
+
+	/* Era o último elemento: a dona o disputa com as ladras pelo índice inicio. */
+	bool venceu = fila->inicio.compare_exchange_strong(inicio, inicio + 1, memory_order_seq_cst, memory_order_relaxed);
+	fila->fim.store(fim + 1, memory_order_relaxed);
+	return venceu;
+}
+
+bool remover_do_inicio(FilaDConc* fila, int* item) {
+	assert(fila != NULL);
+	assert(item != NULL);
+
+	long long inicio = fila->inicio.load(memory_order_acquire);
+	atomic_thread_fence(memory_order_seq_cst);
+	long long fim = fila->fim.load(memory_order_acquire);
+
+	if (inicio >= fim) {
+		return false;
+	}
+
+	VetorCircular* v = fila->vetor.load(memory_order_acquire);
+	int valor = v->itens[inicio & v->mascara].load(memory_order_relaxed);
+	if (!fila->inicio.compare_exchange_strong(inicio, inicio + 1, memory_order_seq_cst, memory_order_relaxed)) {
+		/* Outra ladra (ou a dona) levou o elemento primeiro. */
+		return false;
+	}
+	*item = valor;
+	return true;
+}
+
+int obter_tamanho(FilaDConc* fila) {
+	assert(fila != NULL);
+
+	long long inicio = fila->inicio.load(memory_order_acquire);
+	long long fim = fila->fim.load(memory_order_acquire);
+	return (fim > inicio) ? (int) (fim - inicio) : 0;
+}
+
+bool estah_vazia(FilaDConc* fila) {
+	assert(fila != NULL);
+
+	return (obter_tamanho(fila) == 0);
+}
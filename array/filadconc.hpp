@@ -0,0 +1,164 @@
+/**
+ * \file filadconc.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Interface do TAD FilaDConc
+ *
+ * Disponibiliza as funções necessárias para manipulação de uma Fila Dupla para roubo de tarefas
+ * (work stealing), segundo o algoritmo de Chase e Lev (2005).
+ *
+ * Assim como a FilaDVet, a fila é um vetor circular com os índices inicio e fim. Ela possui uma
+ * thread dona, que insere e remove elementos no fim da fila (como em uma pilha), e pode ter várias
+ * threads ladras, que removem elementos do início da fila. Nenhuma das operações usa travas:
+ *  - a dona só disputa com as ladras quando resta um único elemento; e
+ *  - as ladras disputam entre si por meio de uma comparação e troca (compare-and-swap) no índice inicio.
+ *
+ * Diferentemente da FilaDVet, a fila não tem capacidade máxima: quando o vetor fica cheio, a dona
+ * copia os elementos para um vetor com o dobro do tamanho. Os vetores antigos só são liberados
+ * junto com a fila, pois uma ladra pode ainda estar lendo-os.
+ *
+ * As funções inserir_no_inicio e remover_do_inicio da FilaDVet não têm equivalente para a dona:
+ * o início da fila pertence às ladras.
+ */
+
+#ifndef FILADCONC_HPP
+#define FILADCONC_HPP
+
+/**
+ * \struct FilaDConc
+ * \brief Declaração opaca da estrutura de uma fila.
+ *
+ * Isso significa que os detalhes de implementação desta estrutura estão escondidos do usuário do TAD.
+ * A definição da estrutura FilaDConc encontra-se no arquivo \file filadconc.cpp.
+ */
+struct FilaDConc;
+
+/**
+ * \brief Cria dinamicamente uma fila vazia e retorna o endereço onde ela se encontra alocada.
+ *
+ * A thread que criar a fila não precisa ser a sua dona, mas, a partir da primeira inserção,
+ * apenas uma thread pode chamar \p inserir_no_fim e \p remover_do_fim.
+ *
+ * \pre \p capacidade deve estar no intervalo [1, 2^30].
+ *
+ * \param capacidade representa a capacidade inicial do vetor (arredondada para uma potência de dois).
+ *
+ * \return O endereço de memória da fila alocada dinamicamente.
+ */
+FilaDConc* criar_fila_d_conc(int capacidade);
+
+/**
+ * \brief Libera o espaço de memória anteriormente reservado para a fila.
+ *
+ * \pre O ponteiro \p *f deve ser diferente de \p NULL.
+ * \pre Nenhuma outra thread pode estar utilizando a fila.
+ *
+ * \param *f representa um ponteiro para a fila a ser liberada da memória.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *f seja igual a \p NULL.
+ */
+void liberar_fila(FilaDConc* f);
+
+/**
+ * \brief Insere um elemento no fim da fila. Deve ser chamada apenas pela thread dona.
+ *
+ * \pre O ponteiro \p *f deve ser diferente de \p NULL.
+ *
+ * \param *f representa um ponteiro para a fila.
+ * \param item representa o item a ser inserido.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *f seja igual a \p NULL.
+ */
+void inserir_no_fim(FilaDConc* f, int item);
+
+/**
+ * \brief Tenta remover o elemento do fim da fila. Deve ser chamada apenas pela thread dona.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include "filadconc.hpp"
+ *
+ * using namespace std;
+ *
+ * int main() {
+ *     FilaDConc *f = criar_fila_d_conc(16);
+ *     inserir_no_fim(f, 1);
+ *     inserir_no_fim(f, 2);
+ *     int item;
+ *     while (remover_do_fim(f, &item)) {
+ *         cout << item << endl;
+ *     }
+ *     liberar_fila(f);
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * Saída esperada:
+ * \code {.unparsed}
+ *     2
+ *     1
+ * \endcode
+ *
+ * \pre Os ponteiros \p *f e \p *item devem ser diferentes de \p NULL.
+ *
+ * \param *f representa um ponteiro para a fila.
+ * \param *item representa o endereço onde o elemento removido será armazenado.
+ *
+ * \return \p true, se um elemento foi removido e \p false, caso a fila estivesse vazia
+ *         (ou o último elemento tenha sido roubado por uma ladra).
+ *
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL.
+ */
+bool remover_do_fim(FilaDConc* f, int* item);
+
+/**
+ * \brief Tenta roubar o elemento do início da fila. Pode ser chamada por qualquer thread.
+ *
+ * \pre Os ponteiros \p *f e \p *item devem ser diferentes de \p NULL.
+ *
+ * \param *f representa um ponteiro para a fila.
+ * \param *item representa o endereço onde o elemento removido será armazenado.
+ *
+ * \return \p true, se um elemento foi removido e \p false, caso a fila estivesse vazia ou outra
+ *         thread tenha removido o mesmo elemento primeiro.
+ *
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL.
+ */
+bool remover_do_inicio(FilaDConc* f, int* item);
+
+/**
+ * \brief Retorna a quantidade de elementos da fila.
+ *
+ * Quando outras threads estão usando a fila, o resultado reflete um instante recente e pode
+ * estar desatualizado quando for usado.
+ *
+ * \pre O ponteiro \p *f deve ser diferente de \p NULL.
+ *
+ * \param *f representa um ponteiro para a fila.
+ *
+ * \return A quantidade de elementos da fila.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *f seja igual a \p NULL.
+ */
+int obter_tamanho(FilaDConc* f);
+
+/**
+ * \brief Verifica se a fila está vazia (com a mesma ressalva de \p obter_tamanho).
+ *
+ * \pre O ponteiro \p *f deve ser diferente de \p NULL.
+ *
+ * \param *f representa um ponteiro para a fila cuja situação será consultada.
+ *
+ * \return \p true, se a fila estiver vazia e \p false, caso contrário.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *f seja igual a \p NULL.
+ */
+bool estah_vazia(FilaDConc* f);
+
+#endif
@@ -1,35 +1,66 @@
 #include <assert.h> /**< Necessário para uso da macro "assert" */
 #include <cstdlib> /**< Necessário para uso do NULL */
+#include <cstring> /**< Necessário para uso das funções "memcpy". */
 #include "filadvet.hpp"
+#include "varredura.hpp"
 
-using namespace std;
+/*
+ * A definição da estrutura e as operações nas extremidades (inserir_no_fim, remover_do_inicio,
+ * obter_fim etc.) ficam em filadvet_em_linha.hpp, compartilhado com o modo em linha de
+ * filadvet.hpp. Fora desse modo, elas são compiladas aqui como funções comuns.
+ */
+#ifndef ESTRUTURAS_EM_LINHA
+#define FILADVET_EM_LINHA
+#include "filadvet_em_linha.hpp"
+#endif
 
-struct FilaDVet {
-	int itens[TAM_MAX]; /**< Vetor que armazena os elementos da fila. */            
-	int inicio; /**< Variável que indica a posição do primeiro elemento da fila. */
-	int fim; /**< Variável que indica a próxima posição vazia da fila. */
-};
+using namespace std;
 
 /* 
- * Retorna o próximo valor do índice i, de forma circular. 
- * Ou seja, se i == TAM_MAX - 1, retorn 0. Caso contrário, retorna i + 1.
- * A palavra-chave "static" na assinatura desta função garante que ela só estará disponível
- * para uso dentro deste arquivo.
+ * Retorna o índice i avançado n posições (-TAM_MAX_FILADVET < n < TAM_MAX_FILADVET), de forma
+ * circular. Valores negativos de n recuam o índice.
  */
-static int incrementar(int i) {
-	return ((i + 1) % TAM_MAX);
+static int avancar(int i, int n) {
+	if (FILADVET_POTENCIA_DE_DOIS) {
+		return ((i + n) & (TAM_MAX_FILADVET - 1));
+	}
+	return ((i + n + TAM_MAX_FILADVET) % TAM_MAX_FILADVET);
 }
 
-/* 
- * Retorna o decremento do índice i, de forma circular. 
- * Ou seja, se i == 0, retorna TAM_MAX - 1. Caso contrário, retorna i - 1.
- * A palavra-chave "static" na assinatura desta função garante que ela só estará disponível
- * para uso dentro deste arquivo.
+#ifndef NDEBUG
+/* Retorna a quantidade de elementos da fila. Usada apenas nas verificações (assert). */
+static int tamanho(FilaDVet* fila) {
+	return avancar(fila->fim, -fila->inicio);
+}
+#endif
+
+/*
+ * Copia "n" elementos de "origem" para o vetor circular da fila, a partir da posição "pos".
+ * Se o bloco ultrapassar o final do vetor, ele é copiado em dois trechos: um até o final do
+ * vetor e o restante a partir da posição 0.
  */
-static int decrementar(int i) {
-	return ((i - 1 + TAM_MAX) % TAM_MAX);
+static void copiar_para_fila(FilaDVet* fila, int pos, const int* origem, int n) {
+	int trecho = TAM_MAX_FILADVET - pos;
+	if (trecho > n) {
+		trecho = n;
+	}
+	memcpy(fila->itens + pos, origem, trecho * sizeof(int));
+	if (trecho < n) {
+		memcpy(fila->itens, origem + trecho, (n - trecho) * sizeof(int));
+	}
 }
 
+/* Copia "n" elementos do vetor circular da fila, a partir da posição "pos", para "destino". */
+static void copiar_da_fila(FilaDVet* fila, int pos, int* destino, int n) {
+	int trecho = TAM_MAX_FILADVET - pos;
+	if (trecho > n) {
+		trecho = n;
+	}
+	memcpy(destino, fila->itens + pos, trecho * sizeof(int));
+	if (trecho < n) {
+		memcpy(destino + trecho, fila->itens, (n - trecho) * sizeof(int));
+	}
+}
 
 FilaDVet* criar_fila_d() {
 	/* 
@@ -40,6 +71,7 @@ FilaDVet* criar_fila_d() {
     
 	fila->inicio = 0;
 	fila->fim = 0;
+	ESTATISTICA(zerar_estatisticas(&fila->estat));
 	return fila;
 }
 
@@ -54,73 +86,104 @@ void liberar_fila(FilaDVet* fila) {
 	delete fila;		
 }
 
-bool estah_cheia(FilaDVet* fila) {
-	assert(fila != NULL);	
-    
-    /* Para a fila ser considerada cheia, o incremento de seu índice fim deve ser igual ao seu índice inicio */ 
-	return (incrementar(fila->fim) == fila->inicio);
+void inserir_lote_no_fim(FilaDVet* fila, const int* itens, int n) {
+	assert((fila != NULL) && (itens != NULL));
+	assert((n >= 0) && (tamanho(fila) + n <= TAM_MAX_FILADVET - 1));
+
+	copiar_para_fila(fila, fila->fim, itens, n);
+	fila->fim = avancar(fila->fim, n);
+	ESTATISTICA(contar_insercoes(&fila->estat, n));
 }
 
-bool estah_vazia(FilaDVet* fila) {
-	assert(fila != NULL);	
-	
-	/* Para a fila ser considerada vazia, seus índices inicio e fim devem ser iguais */ 
-	return (fila->inicio == fila->fim);
+void inserir_lote_no_inicio(FilaDVet* fila, const int* itens, int n) {
+	assert((fila != NULL) && (itens != NULL));
+	assert((n >= 0) && (tamanho(fila) + n <= TAM_MAX_FILADVET - 1));
+
+	fila->inicio = avancar(fila->inicio, -n);
+	copiar_para_fila(fila, fila->inicio, itens, n);
+	ESTATISTICA(contar_insercoes(&fila->estat, n));
+}
+
+void remover_lote_do_inicio(FilaDVet* fila, int* saida, int n) {
+	assert((fila != NULL) && (saida != NULL));
+	assert((n >= 0) && (n <= tamanho(fila)));
+
+	copiar_da_fila(fila, fila->inicio, saida, n);
+	fila->inicio = avancar(fila->inicio, n);
+	ESTATISTICA(contar_remocoes(&fila->estat, n));
+}
+
+void remover_lote_do_fim(FilaDVet* fila, int* saida, int n) {
+	assert((fila != NULL) && (saida != NULL));
+	assert((n >= 0) && (n <= tamanho(fila)));
+
+	fila->fim = avancar(fila->fim, -n);
+	copiar_da_fila(fila, fila->fim, saida, n);
+	ESTATISTICA(contar_remocoes(&fila->estat, n));
+}
+
+/*
+ * Retorna os elementos da fila: as posições de "inicio" até "fim" ou, se a fila der a volta no
+ * vetor, as posições de "inicio" até o final do vetor, seguidas das posições de 0 até "fim".
+ */
+static Trechos trechos(FilaDVet* fila) {
+	if (fila->inicio <= fila->fim) {
+		Trechos t = {fila->itens + fila->inicio, fila->fim - fila->inicio, fila->itens, 0};
+		return t;
+	}
+	Trechos t = {fila->itens + fila->inicio, TAM_MAX_FILADVET - fila->inicio, fila->itens, fila->fim};
+	return t;
 }
 
-void inserir_no_fim(FilaDVet* fila, int item) {
+int buscar_primeiro(FilaDVet* fila, int item) {
 	assert(fila != NULL);
-	assert(!estah_cheia(fila));    
-    
-	fila->itens[fila->fim] = item;
-	
-	/* Atenção para o incremento circular do índice fim da fila */
-    fila->fim = incrementar(fila->fim);
+
+	ESTATISTICA(contar_consulta(&fila->estat));
+	return varrer_primeiro(trechos(fila), item);
 }
 
-int remover_do_inicio(FilaDVet* fila) {
+int contar_ocorrencias(FilaDVet* fila, int item) {
 	assert(fila != NULL);
-	assert(!estah_vazia(fila));    
-        
-	int item = fila->itens[fila->inicio];
-    
-    /* Atenção para o incremento circular do índice inicio da fila */
-    fila->inicio = incrementar(fila->inicio);
-    return item;    
+
+	ESTATISTICA(contar_consulta(&fila->estat));
+	return varrer_ocorrencias(trechos(fila), item);
 }
 
-int obter_inicio(FilaDVet* fila) {
+long long somar(FilaDVet* fila) {
 	assert(fila != NULL);
-	assert(!estah_vazia(fila));    
-    
-	return fila->itens[fila->inicio];
+
+	ESTATISTICA(contar_consulta(&fila->estat));
+	return varrer_soma(trechos(fila));
 }
 
-void inserir_no_inicio(FilaDVet* fila, int item) {
+int minimo(FilaDVet* fila) {
 	assert(fila != NULL);
-	assert(!estah_cheia(fila));    
-    
-	/* Atenção para o decremento circular do índice inicio da fila */
-    fila->inicio = decrementar(fila->inicio);
-	fila->itens[fila->inicio] = item;	
+	assert(!estah_vazia(fila));
+
+	ESTATISTICA(contar_consulta(&fila->estat));
+	return varrer_minimo(trechos(fila));
 }
 
-int remover_do_fim(FilaDVet* fila) {
+int maximo(FilaDVet* fila) {
 	assert(fila != NULL);
-	assert(!estah_vazia(fila));    
-    
-    int item = fila->itens[decrementar(fila->fim)];
-    
-    /* Atenção para o decremento circular do índice fim da fila */
-    fila->fim = decrementar(fila->fim);
-	
-    return item;    
+	assert(!estah_vazia(fila));
+
+	ESTATISTICA(contar_consulta(&fila->estat));
+	return varrer_maximo(trechos(fila));
 }
 
-int obter_fim(FilaDVet* fila) {
+int filtrar(FilaDVet* fila, int menor, int maior, int* saida) {
+	assert((fila != NULL) && (saida != NULL));
+	assert(menor <= maior);
+
+	ESTATISTICA(contar_consulta(&fila->estat));
+	return varrer_filtro(trechos(fila), menor, maior, saida);
+}
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+const Estatisticas* obter_estatisticas(FilaDVet* fila) {
 	assert(fila != NULL);
-	assert(!estah_vazia(fila));    
-    
-    /* Atenção: a posição indicada pelo índice fim da fila não contém um item válido! */
-	return fila->itens[decrementar(fila->fim)];
+
+	return &fila->estat;
 }
+#endif
@@ -10,19 +10,45 @@
 #ifndef FILADVET_HPP
 #define FILADVET_HPP
 
+#include "../comum/estatisticas.hpp"
+
 /**
- * \def TAM_MAX 
- * \brief Define a quantidade máxima de elementos suportada pela fila.
+ * \def TAM_MAX_FILADVET
+ * \brief Define o tamanho do vetor circular da fila (que comporta TAM_MAX_FILADVET - 1 elementos).
+ *
+ * Pode ser redefinida na compilação (por exemplo, com -DTAM_MAX_FILADVET=1024). Quando ela é uma
+ * potência de dois, o avanço circular dos índices é feito com uma máscara de bits, em vez do
+ * resto da divisão (operador %).
  * \hideinitializer
  */
-#define TAM_MAX 100 
+#ifndef TAM_MAX_FILADVET
+#define TAM_MAX_FILADVET 100
+#endif
+
+/**
+ * \def TAM_MAX
+ * \brief Nome antigo de TAM_MAX_FILADVET, mantido por compatibilidade.
+ *
+ * Como todos os cabeçalhos de array/ definiam TAM_MAX, incluir dois deles no mesmo arquivo
+ * redefinia a macro. Agora, ela só é definida pelo primeiro cabeçalho incluído e, por isso,
+ * pode não corresponder a esta fila: prefira TAM_MAX_FILADVET.
+ * \hideinitializer
+ */
+#ifndef TAM_MAX
+#define TAM_MAX TAM_MAX_FILADVET
+#endif
 
 /** 
  * \struct FilaDVet
  * \brief Declaração opaca da estrutura de uma fila.
  * 
  * Isso significa que os detalhes de implementação desta estrutura estão escondidos do usuário do TAD. 
- * A definição da estrutura FilaDVet encontra-se no arquivo \file filadvet.cpp.
+ * A definição da estrutura FilaDVet encontra-se no arquivo \file filadvet_em_linha.hpp.
+ *
+ * Se a macro ESTRUTURAS_EM_LINHA for definida na compilação, este cabeçalho também inclui essa
+ * definição e as versões "inline" das operações de uma única posição (estah_vazia, estah_cheia,
+ * inserir_no_inicio, inserir_no_fim, remover_do_inicio, remover_do_fim, obter_inicio e
+ * obter_fim). O programa inteiro, inclusive filadvet.cpp, deve ser compilado com a macro.
  */
 struct FilaDVet;
 
@@ -396,4 +422,235 @@ int remover_do_fim(FilaDVet* f);
  */
 int obter_fim(FilaDVet* f);
 
+/** 
+ * \brief Insere, de uma só vez, os \p n elementos do vetor \p itens no fim da fila.
+ * 
+ * O resultado é o mesmo de chamar inserir_no_fim(f, itens[i]) para i = 0, 1, ..., n - 1, mas os
+ * elementos são copiados com no máximo duas chamadas a memcpy (duas quando o bloco dá a volta
+ * no vetor circular).
+ * 
+ * \pre Os ponteiros \p *f e \p *itens devem ser diferentes de \p NULL.
+ * \pre A fila deve ter espaço para mais \p n elementos.
+ * 
+ * \param *f representa um ponteiro para a fila.
+ * \param *itens representa o vetor com os elementos a serem inseridos.
+ * \param n representa a quantidade de elementos a serem inseridos.
+ * 
+ * \return void
+ * 
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL ou
+ * 			caso não haja espaço para os \p n elementos.
+ */
+void inserir_lote_no_fim(FilaDVet* f, const int* itens, int n);
+
+/** 
+ * \brief Insere, de uma só vez, os \p n elementos do vetor \p itens no início da fila, na mesma ordem.
+ * 
+ * Após a operação, itens[0] é o primeiro elemento da fila, itens[1] o segundo e assim por diante.
+ * Note que isso é o contrário de chamar inserir_no_inicio(f, itens[i]) para i = 0, 1, ..., n - 1.
+ * 
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include "filadvet.hpp"
+ * 
+ * using namespace std;
+ *
+ * int main() {
+ *     FilaDVet *f = criar_fila_d();
+ *     int v[] = {1, 2, 3};
+ *     inserir_no_fim(f, 4);
+ *     inserir_lote_no_inicio(f, v, 3);
+ *     while (!estah_vazia(f)) {
+ *         cout << remover_do_inicio(f) << " ";
+ *     }
+ *     cout << endl;
+ *     liberar_fila(f);
+ *     return EXIT_SUCCESS;
+ * }  
+ * \endcode
+ * 
+ * Saída esperada:
+ * \code {.unparsed}
+ *     1 2 3 4
+ * \endcode
+ * 
+ * \pre Os ponteiros \p *f e \p *itens devem ser diferentes de \p NULL.
+ * \pre A fila deve ter espaço para mais \p n elementos.
+ * 
+ * \param *f representa um ponteiro para a fila.
+ * \param *itens representa o vetor com os elementos a serem inseridos.
+ * \param n representa a quantidade de elementos a serem inseridos.
+ * 
+ * \return void
+ * 
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL ou
+ * 			caso não haja espaço para os \p n elementos.
+ */
+void inserir_lote_no_inicio(FilaDVet* f, const int* itens, int n);
+
+/** 
+ * \brief Remove, de uma só vez, os \p n primeiros elementos da fila.
+ * 
+ * O resultado é o mesmo de chamar saida[i] = remover_do_inicio(f) para i = 0, 1, ..., n - 1.
+ * 
+ * \pre Os ponteiros \p *f e \p *saida devem ser diferentes de \p NULL.
+ * \pre A fila deve ter pelo menos \p n elementos.
+ * 
+ * \param *f representa um ponteiro para a fila.
+ * \param *saida representa o vetor, com pelo menos \p n posições, que receberá os elementos.
+ * \param n representa a quantidade de elementos a serem removidos.
+ * 
+ * \return void
+ * 
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL ou
+ * 			caso a fila tenha menos do que \p n elementos.
+ */
+void remover_lote_do_inicio(FilaDVet* f, int* saida, int n);
+
+/** 
+ * \brief Remove, de uma só vez, os \p n últimos elementos da fila, mantendo a sua ordem.
+ * 
+ * Os elementos são armazenados em \p saida na ordem em que estavam na fila: saida[n - 1] é
+ * o antigo último elemento. Assim, inserir_lote_no_fim(f, saida, n) desfaz a operação.
+ * 
+ * \pre Os ponteiros \p *f e \p *saida devem ser diferentes de \p NULL.
+ * \pre A fila deve ter pelo menos \p n elementos.
+ * 
+ * \param *f representa um ponteiro para a fila.
+ * \param *saida representa o vetor, com pelo menos \p n posições, que receberá os elementos.
+ * \param n representa a quantidade de elementos a serem removidos.
+ * 
+ * \return void
+ * 
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL ou
+ * 			caso a fila tenha menos do que \p n elementos.
+ */
+void remover_lote_do_fim(FilaDVet* f, int* saida, int n);
+
+/** 
+ * \brief Retorna a posição da primeira ocorrência de \p item na fila, percorrendo-a do início.
+ * 
+ * Esta e as demais consultas em bloco (contar_ocorrencias, somar, minimo, maximo e filtrar)
+ * percorrem a fila sem remover elementos, lendo-os direto do vetor circular, em até dois
+ * trechos, e usam instruções SIMD (AVX2 ou AVX-512) quando o processador as suporta
+ * (veja varredura.hpp).
+ * 
+ * \pre O ponteiro \p *f deve ser diferente de \p NULL.
+ * 
+ * \param *f representa um ponteiro para a fila.
+ * \param item representa o item procurado.
+ * 
+ * \return A posição de \p item, contada a partir do início (0), ou -1, se ele não estiver na fila.
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *f seja igual a \p NULL.
+ */
+int buscar_primeiro(FilaDVet* f, int item);
+
+/** 
+ * \brief Retorna a quantidade de ocorrências de \p item na fila.
+ * 
+ * \pre O ponteiro \p *f deve ser diferente de \p NULL.
+ * 
+ * \param *f representa um ponteiro para a fila.
+ * \param item representa o item procurado.
+ * 
+ * \return A quantidade de elementos iguais a \p item.
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *f seja igual a \p NULL.
+ */
+int contar_ocorrencias(FilaDVet* f, int item);
+
+/** 
+ * \brief Retorna a soma dos elementos da fila.
+ * 
+ * \pre O ponteiro \p *f deve ser diferente de \p NULL.
+ * 
+ * \param *f representa um ponteiro para a fila.
+ * 
+ * \return A soma dos elementos (0, se a fila estiver vazia), calculada em 64 bits, sem estouro.
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *f seja igual a \p NULL.
+ */
+long long somar(FilaDVet* f);
+
+/** 
+ * \brief Retorna o menor elemento da fila.
+ * 
+ * \pre O ponteiro \p *f deve ser diferente de \p NULL.
+ * \pre A fila não pode estar vazia.
+ * 
+ * \param *f representa um ponteiro para a fila.
+ * 
+ * \return O menor elemento.
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *f seja igual a \p NULL ou
+ * 			caso a fila esteja vazia.
+ */
+int minimo(FilaDVet* f);
+
+/** 
+ * \brief Retorna o maior elemento da fila.
+ * 
+ * \pre O ponteiro \p *f deve ser diferente de \p NULL.
+ * \pre A fila não pode estar vazia.
+ * 
+ * \param *f representa um ponteiro para a fila.
+ * 
+ * \return O maior elemento.
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *f seja igual a \p NULL ou
+ * 			caso a fila esteja vazia.
+ */
+int maximo(FilaDVet* f);
+
+/** 
+ * \brief Copia para \p saida, na ordem da fila, os elementos do intervalo [menor, maior].
+ * 
+ * \code {.cpp}
+ *     int saida[TAM_MAX_FILADVET];
+ *     int n = filtrar(f, 10, 20, saida); // saida[0, n) contém os elementos x com 10 <= x <= 20
+ * \endcode
+ * 
+ * \pre Os ponteiros \p *f e \p *saida devem ser diferentes de \p NULL.
+ * \pre menor <= maior.
+ * 
+ * \param *f representa um ponteiro para a fila.
+ * \param menor representa o menor valor aceito.
+ * \param maior representa o maior valor aceito.
+ * \param *saida representa o vetor que receberá os elementos. Ele deve ter uma posição para cada
+ * 		elemento da fila, mesmo que poucos sejam copiados: as posições após os copiados podem
+ * 		ser sobrescritas.
+ * 
+ * \return A quantidade de elementos copiados.
+ * 
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL ou
+ * 			caso menor > maior.
+ */
+int filtrar(FilaDVet* f, int menor, int maior, int* saida);
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+/**
+ * \brief Retorna os contadores de uso da fila.
+ *
+ * Disponível apenas quando a macro ESTRUTURAS_ESTATISTICAS é definida na compilação. Os contadores
+ * continuam sendo atualizados pelas operações seguintes; veja o arquivo estatisticas.hpp.
+ *
+ * \pre O ponteiro \p *f deve ser diferente de \p NULL.
+ *
+ * \param *f representa um ponteiro para a fila.
+ *
+ * \return O endereço dos contadores da fila.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *f seja igual a \p NULL.
+ */
+const Estatisticas* obter_estatisticas(FilaDVet* f);
+#endif
+
+#ifdef ESTRUTURAS_EM_LINHA
+#define FILADVET_EM_LINHA inline
+#include "filadvet_em_linha.hpp"
+#endif
+
 #endif
@@ -0,0 +1,135 @@
+/**
+ * \file filadvet_em_linha.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Definição da estrutura FilaDVet e das operações nas extremidades da fila dupla
+ *
+ * Não deve ser incluído diretamente: filadvet.cpp o inclui para gerar as versões comuns das
+ * operações e filadvet.hpp, para oferecer as versões "inline" quando ESTRUTURAS_EM_LINHA está
+ * definida (a macro FILADVET_EM_LINHA indica qual das duas é gerada).
+ */
+
+#ifndef FILADVET_EM_LINHA_HPP
+#define FILADVET_EM_LINHA_HPP
+
+#include <assert.h> /**< Necessário para uso da macro "assert". */
+#include <cstdlib> /**< Necessário para uso do NULL. */
+#include "filadvet.hpp"
+
+struct FilaDVet {
+	int itens[TAM_MAX_FILADVET]; /**< Vetor que armazena os elementos da fila. */
+	int inicio; /**< Variável que indica a posição do primeiro elemento da fila. */
+	int fim; /**< Variável que indica a próxima posição vazia da fila. */
+#ifdef ESTRUTURAS_ESTATISTICAS
+	Estatisticas estat; /**< Contadores de uso (veja estatisticas.hpp). */
+#endif
+};
+
+/*
+ * Indica se o tamanho do vetor é uma potência de dois. Nesse caso, os índices circulares são
+ * calculados com uma máscara de bits (i & (TAM_MAX_FILADVET - 1)), que custa uma única instrução,
+ * em vez do resto da divisão. Como a condição é constante, o compilador descarta o ramo não usado.
+ */
+const bool FILADVET_POTENCIA_DE_DOIS = ((TAM_MAX_FILADVET & (TAM_MAX_FILADVET - 1)) == 0);
+
+/*
+ * Retorna o próximo valor do índice i, de forma circular.
+ * Ou seja, se i == TAM_MAX_FILADVET - 1, retorna 0. Caso contrário, retorna i + 1.
+ */
+inline int incrementar_filadvet(int i) {
+	if (FILADVET_POTENCIA_DE_DOIS) {
+		return ((i + 1) & (TAM_MAX_FILADVET - 1));
+	}
+	return ((i + 1) % TAM_MAX_FILADVET);
+}
+
+/*
+ * Retorna o decremento do índice i, de forma circular.
+ * Ou seja, se i == 0, retorna TAM_MAX_FILADVET - 1. Caso contrário, retorna i - 1.
+ */
+inline int decrementar_filadvet(int i) {
+	if (FILADVET_POTENCIA_DE_DOIS) {
+		return ((i - 1) & (TAM_MAX_FILADVET - 1));
+	}
+	return ((i - 1 + TAM_MAX_FILADVET) % TAM_MAX_FILADVET);
+}
+
+FILADVET_EM_LINHA bool estah_cheia(FilaDVet* fila) {
+	assert(fila != NULL);
+
+	/* Para a fila ser considerada cheia, o incremento de seu índice fim deve ser igual ao seu índice inicio */
+	return (incrementar_filadvet(fila->fim) == fila->inicio);
+}
+
+FILADVET_EM_LINHA bool estah_vazia(FilaDVet* fila) {
+	assert(fila != NULL);
+
+	/* Para a fila ser considerada vazia, seus índices inicio e fim devem ser iguais */
+	return (fila->inicio == fila->fim);
+}
+
+FILADVET_EM_LINHA void inserir_no_fim(FilaDVet* fila, int item) {
+	assert(fila != NULL);
+	assert(!estah_cheia(fila));
+
+	fila->itens[fila->fim] = item;
+
+	/* Atenção para o incremento circular do índice fim da fila */
+	fila->fim = incrementar_filadvet(fila->fim);
+	ESTATISTICA(contar_insercoes(&fila->estat, 1));
+}
+
+FILADVET_EM_LINHA int remover_do_inicio(FilaDVet* fila) {
+	assert(fila != NULL);
+	assert(!estah_vazia(fila));
+
+	int item = fila->itens[fila->inicio];
+
+	/* Atenção para o incremento circular do índice inicio da fila */
+	fila->inicio = incrementar_filadvet(fila->inicio);
+	ESTATISTICA(contar_remocoes(&fila->estat, 1));
+	return item;
+}
+
+FILADVET_EM_LINHA int obter_inicio(FilaDVet* fila) {
+	assert(fila != NULL);
+	assert(!estah_vazia(fila));
+
+	ESTATISTICA(contar_consulta(&fila->estat));
+	return fila->itens[fila->inicio];
+}
+
+FILADVET_EM_LINHA void inserir_no_inicio(FilaDVet* fila, int item) {
+	assert(fila != NULL);
+	assert(!estah_cheia(fila));
+
+	/* Atenção para o decremento circular do índice inicio da fila */
+	fila->inicio = decrementar_filadvet(fila->inicio);
+	fila->itens[fila->inicio] = item;
+	ESTATISTICA(contar_insercoes(&fila->estat, 1));
+}
+
+FILADVET_EM_LINHA int remover_do_fim(FilaDVet* fila) {
+	assert(fila != NULL);
+	assert(!estah_vazia(fila));
+
+	int item = fila->itens[decrementar_filadvet(fila->fim)];
+
+	/* Atenção para o decremento circular do índice fim da fila */
+	fila->fim = decrementar_filadvet(fila->fim);
+	ESTATISTICA(contar_remocoes(&fila->estat, 1));
+
+	return item;
+}
+
+FILADVET_EM_LINHA int obter_fim(FilaDVet* fila) {
+	assert(fila != NULL);
+	assert(!estah_vazia(fila));
+
+	/* Atenção: a posição indicada pelo índice fim da fila não contém um item válido! */
+	ESTATISTICA(contar_consulta(&fila->estat));
+	return fila->itens[decrementar_filadvet(fila->fim)];
+}
+
+#endif
+
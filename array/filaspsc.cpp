@@ -0,0 +1,208 @@
+#include <assert.h> /**< Necessário para uso da macro "assert". */
+#include <atomic> /**< Necessário para uso de std::atomic. */
+#include <cstdlib> /**< Necessário para uso do NULL. */
+#include <cstring> /**< Necessário para uso da função "memcpy". */
+#include "../comum/cache.hpp"
+#include "filaspsc.hpp"
+
+using namespace std;
+
+/*
+ * Os índices inicio e fim não são reduzidos módulo a capacidade: eles apenas crescem
+ * (com aritmética sem sinal, que dá a volta naturalmente) e a posição no vetor é obtida
+ * com "indice & mascara". Assim, a quantidade de elementos é sempre "fim - inicio" e
+ * todas as posições do vetor podem ser usadas, sem a posição vazia da FilaVet.
+ *
+ * Cada thread também guarda uma cópia local do índice escrito pela outra thread. Enquanto
+ * a cópia indicar que há espaço (ou elementos), a linha de cache da outra thread não precisa
+ * ser lida.
+ */
+struct FilaSPSC {
+	/* Dados da thread produtora. */
+	alignas(TAM_LINHA_CACHE) atomic<unsigned> fim; /**< Próxima posição a ser escrita. */
+	unsigned inicio_local; /**< Última leitura do índice inicio feita pela produtora. */
+
+	/* Dados da thread consumidora. */
+	alignas(TAM_LINHA_CACHE) atomic<unsigned> inicio; /**< Posição do primeiro elemento da fila. */
+	unsigned fim_local; /**< Última leitura do índice fim feita pela consumidora. */
+
+	/* Dados somente leitura, compartilhados pelas duas threads. */
+	alignas(TAM_LINHA_CACHE) int* itens; /**< Vetor que armazena os elementos da fila. */
+	unsigned capacidade; /**< Quantidade de posições do vetor (potência de dois). */
+	unsigned mascara; /**< Igual a capacidade - 1. */
+};
+
+FilaSPSC* criar_fila_spsc(int capacidade) {
+	assert((capacidade >= 1) && (capacidade <= (1 << 30)));
+
+	unsigned cap = 1;
+	while (cap < (unsigned) capacidade) {
+		cap *= 2;
+	}
+
+	/*
+	 * Caso não seja possível alocar o espaço solicitado, o próprio operador "new"
+	 * irá lançar uma exceção abortando a execução do programa.
+	 */
+	FilaSPSC* fila = new FilaSPSC;
+
+	fila->itens = new int[cap];
+	fila->capacidade = cap;
+	fila->mascara = cap - 1;
+	fila->inicio.store(0, memory_order_relaxed);
+	fila->fim.store(0, memory_order_relaxed);
+	fila->inicio_local = 0;
+	fila->fim_local = 0;
+	return fila;
+}
+
+void liberar_fila(FilaSPSC* fila) {
+	/*
+	 * Macro da biblioteca \file assert.h. Aborta a execução do programa e envia uma mensagem
+	 * de erro para a saída de erro padrão, caso a expressão entre parênteses seja avaliada
+	 * como false.
+	 */
+	assert(fila != NULL);
+
+	delete[] fila->itens;
+	delete fila;
+}
+
+/*
+ * Copia "n" elementos de "origem" para o vetor circular, a partir do índice "pos".
+ * Como o vetor é circular, a cópia pode precisar de dois trechos: do índice até o
+ * fim do vetor e do início do vetor em diante.
+ */
+static void copiar_para_vetor(FilaSPSC* fila, unsigned pos, const int* origem, unsigned n) {
+	unsigned i = pos & fila->mascara;
+	unsigned primeiro_trecho = fila->capacidade - i;
+	if (primeiro_trecho > n) {
+		primeiro_trecho = n;
+	}
+	memcpy(fila->itens + i, origem, primeiro_trecho * sizeof(int));
+	memcpy(fila->itens, origem + primeiro_trecho, (n - primeiro_trecho) * sizeof(int));
+}
+
+/* Operação inversa de "copiar_para_vetor". */
+static void copiar_do_vetor(FilaSPSC* fila, unsigned pos, int* destino, unsigned n) {
+	unsigned i = pos & fila->mascara;
+	unsigned primeiro_trecho = fila->capacidade - i;
+	if (primeiro_trecho > n) {
+		primeiro_trecho = n;
+	}
+	memcpy(destino, fila->itens + i, primeiro_trecho * sizeof(int));
+	memcpy(destino + primeiro_trecho, fila->itens, (n - primeiro_trecho) * sizeof(int));
+}
+
+/* Retorna quantas posições livres a produtora pode usar, relendo o índice inicio só se necessário. */
+static unsigned espaco_livre(FilaSPSC* fila, unsigned fim, unsigned desejado) {
+	unsigned livre = fila->capacidade - (fim - fila->inicio_local);
+	if (livre < desejado) {
+		/* "acquire" garante que a consumidora já terminou de ler as posições liberadas. */
+		fila->inicio_local = fila->inicio.load(memory_order_acquire);
+		livre = fila->capacidade - (fim - fila->inicio_local);
+	}
+	return livre;
+}
+
+/* Retorna quantos elementos a consumidora pode ler, relendo o índice fim só se necessário. */
+static unsigned elementos_disponiveis(FilaSPSC* fila, unsigned inicio, unsigned desejado) {
+	unsigned disponiveis = fila->fim_local - inicio;
+	if (disponiveis < desejado) {
+		/* "acquire" garante que os elementos escritos pela produtora já estão visíveis. */
+		fila->fim_local = fila->fim.load(memory_order_acquire);
+		disponiveis = fila->fim_local - inicio;
+	}
+	return disponiveis;
+}
+
+bool inserir(FilaSPSC* fila, int item) {
+	assert(fila != NULL);
+
+	/* Somente a produtora escreve o índice fim; por isso, ela pode lê-lo de forma relaxada. */
+	unsigned fim = fila->fim.load(memory_order_relaxed);
+	if (espaco_livre(fila, fim, 1) == 0) {
+		return false;
+	}
+
+	fila->itens[fim & fila->mascara] = item;
+
+	/* "release" publica o elemento escrito acima antes do novo valor do índice fim. */
+	fila->fim.store(fim + 1, memory_order_release);
+	return true;
+}
+
+bool remover(FilaSPSC* fila, int* item) {
+	assert(fila != NULL);
+	assert(item != NULL);
+
+	unsigned inicio = fila->inicio.load(memory_order_relaxed);
+	if (elementos_disponiveis(fila, inicio, 1) == 0) {
+		return false;
+	}
+
+	*item = fila->itens[inicio & fila->mascara];
+
+	/* "release" garante que a leitura acima termine antes de a posição ser liberada para a produtora. */
+	fila->inicio.store(inicio + 1, memory_order_release);
+	return true;
+}
+
+int inserir_lote(FilaSPSC* fila, const int* itens, int n) {
+	assert(fila != NULL);
+	assert(itens != NULL);
+	assert(n >= 0);
+
+	unsigned fim = fila->fim.load(memory_order_relaxed);
+	unsigned qtd = espaco_livre(fila, fim, n);
+	if (qtd > (unsigned) n) {
+		qtd = n;
+	}
+	if (qtd == 0) {
+		return 0;
+	}
+
+	copiar_para_vetor(fila, fim, itens, qtd);
+	fila->fim.store(fim + qtd, memory_order_release);
+	return qtd;
+}
+
+int remover_lote(FilaSPSC* fila, int* itens, int n) {
+	assert(fila != NULL);
+	assert(itens != NULL);
+	assert(n >= 0);
+
+	unsigned inicio = fila->inicio.load(memory_order_relaxed);
+	unsigned qtd = elementos_disponiveis(fila, inicio, n);
+	if (qtd > (unsigned) n) {
+		qtd = n;
+	}
+	if (qtd == 0) {
+		return 0;
+	}
+
+	copiar_do_vetor(fila, inicio, itens, qtd);
+	fila->inicio.store(inicio + qtd, memory_order_release);
+	return qtd;
+}
+
+bool estah_vazia(FilaSPSC* fila) {
+	assert(fila != NULL);
+
+	return (obter_tamanho(fila) == 0);
+}
+
+int obter_tamanho(FilaSPSC* fila) {
+	assert(fila != NULL);
+
+	/* Lê inicio antes de fim: assim, o resultado nunca é negativo. */
+	unsigned inicio = fila->inicio.load(memory_order_acquire);
+	unsigned fim = fila->fim.load(memory_order_acquire);
+	return (int) (fim - inicio);
+}
+
+int obter_capacidade(FilaSPSC* fila) {
+	assert(fila != NULL);
+
+	return (int) fila->capacidade;
+}
@@ -0,0 +1,213 @@
+/**
+ * \file filaspsc.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Interface do TAD FilaSPSC
+ *
+ * Disponibiliza as funções necessárias para manipulação de uma Fila circular que pode ser
+ * compartilhada, sem o uso de travas (locks), entre exatamente duas threads: uma produtora,
+ * que apenas insere, e uma consumidora, que apenas remove (single-producer/single-consumer).
+ *
+ * A organização é a mesma da FilaVet: um vetor circular com os índices inicio e fim. As
+ * diferenças são:
+ *  - cada índice é escrito por apenas uma das threads e lido pela outra com semântica
+ *    acquire/release, o que dispensa travas;
+ *  - os dois índices ficam em linhas de cache distintas, evitando o falso compartilhamento
+ *    (false sharing) entre as threads;
+ *  - a capacidade é sempre uma potência de dois, de modo que a volta ao início do vetor é
+ *    feita com uma máscara de bits em vez do operador "%"; e
+ *  - as funções inserir e remover não abortam o programa quando a fila está cheia ou vazia,
+ *    pois, com duas threads, essa situação é esperada e transitória. Elas retornam \p false.
+ */
+
+#ifndef FILASPSC_HPP
+#define FILASPSC_HPP
+
+/**
+ * \struct FilaSPSC
+ * \brief Declaração opaca da estrutura de uma fila.
+ *
+ * Isso significa que os detalhes de implementação desta estrutura estão escondidos do usuário do TAD.
+ * A definição da estrutura FilaSPSC encontra-se no arquivo \file filaspsc.cpp.
+ */
+struct FilaSPSC;
+
+/**
+ * \brief Cria dinamicamente uma fila vazia e retorna o endereço onde ela se encontra alocada.
+ *
+ * A capacidade da fila é a menor potência de dois maior ou igual a \p capacidade.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include "filaspsc.hpp"
+
+ * int main() {
+ *     FilaSPSC *f = criar_fila_spsc(1000); // capacidade efetiva: 1024
+ *     liberar_fila(f);
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * \pre \p capacidade deve estar no intervalo [1, 2^30].
+ *
+ * \param capacidade representa a quantidade mínima de elementos que a fila deve comportar.
+ *
+ * \return O endereço de memória da fila alocada dinamicamente.
+ */
+FilaSPSC* criar_fila_spsc(int capacidade);
+
+/**
+ * \brief Libera o espaço de memória anteriormente reservado para a fila.
+ *
+ * \pre O ponteiro \p *f deve ser diferente de \p NULL.
+ * \pre Nenhuma das threads pode estar utilizando a fila.
+ *
+ * \param *f representa um ponteiro para a fila a ser liberada da memória.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *f seja igual a \p NULL.
+ */
+void liberar_fila(FilaSPSC* f);
+
+/**
+ * \brief Tenta inserir um novo elemento no fim da fila. Deve ser chamada apenas pela thread produtora.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include<thread>
+ * #include "filaspsc.hpp"
+ *
+ * using namespace std;
+ *
+ * int main() {
+ *     FilaSPSC *f = criar_fila_spsc(64);
+ *     thread produtora([f]() {
+ *         for (int i = 1; i <= 3; i++) {
+ *             while (!inserir(f, i)) {} // aguarda até haver espaço
+ *         }
+ *     });
+ *     for (int i = 0; i < 3; i++) {
+ *         int item;
+ *         while (!remover(f, &item)) {} // aguarda até haver um elemento
+ *         cout << item << endl;
+ *     }
+ *     produtora.join();
+ *     liberar_fila(f);
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * Saída esperada:
+ * \code {.unparsed}
+ *     1
+ *     2
+ *     3
+ * \endcode
+ *
+ * \pre O ponteiro \p *f deve ser diferente de \p NULL.
+ *
+ * \param *f representa um ponteiro para a fila onde o elemento será inserido.
+ * \param item representa o item a ser inserido na fila.
+ *
+ * \return \p true, se o elemento foi inserido e \p false, caso a fila estivesse cheia.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *f seja igual a \p NULL.
+ */
+bool inserir(FilaSPSC* f, int item);
+
+/**
+ * \brief Tenta remover o elemento do início da fila. Deve ser chamada apenas pela thread consumidora.
+ *
+ * \pre Os ponteiros \p *f e \p *item devem ser diferentes de \p NULL.
+ *
+ * \param *f representa um ponteiro para a fila de onde o elemento será removido.
+ * \param *item representa o endereço onde o elemento removido será armazenado.
+ *
+ * \return \p true, se um elemento foi removido e \p false, caso a fila estivesse vazia.
+ *
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL.
+ */
+bool remover(FilaSPSC* f, int* item);
+
+/**
+ * \brief Insere até \p n elementos no fim da fila de uma só vez. Deve ser chamada apenas pela thread produtora.
+ *
+ * Os elementos são copiados do vetor \p itens, na ordem, e publicados para a thread consumidora
+ * com uma única escrita no índice fim. Se não houver espaço para todos, apenas os primeiros são inseridos.
+ *
+ * \pre Os ponteiros \p *f e \p *itens devem ser diferentes de \p NULL.
+ * \pre \p n deve ser maior ou igual a zero.
+ *
+ * \param *f representa um ponteiro para a fila onde os elementos serão inseridos.
+ * \param *itens representa o vetor com os elementos a serem inseridos.
+ * \param n representa a quantidade de elementos do vetor \p itens.
+ *
+ * \return A quantidade de elementos efetivamente inseridos (entre 0 e \p n).
+ *
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL ou \p n seja negativo.
+ */
+int inserir_lote(FilaSPSC* f, const int* itens, int n);
+
+/**
+ * \brief Remove até \p n elementos do início da fila de uma só vez. Deve ser chamada apenas pela thread consumidora.
+ *
+ * \pre Os ponteiros \p *f e \p *itens devem ser diferentes de \p NULL.
+ * \pre \p n deve ser maior ou igual a zero.
+ *
+ * \param *f representa um ponteiro para a fila de onde os elementos serão removidos.
+ * \param *itens representa o vetor onde os elementos removidos serão armazenados, na ordem da fila.
+ * \param n representa a quantidade máxima de elementos a serem removidos.
+ *
+ * \return A quantidade de elementos efetivamente removidos (entre 0 e \p n).
+ *
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL ou \p n seja negativo.
+ */
+int remover_lote(FilaSPSC* f, int* itens, int n);
+
+/**
+ * \brief Verifica se a fila está vazia.
+ *
+ * Quando há uma thread inserindo ou removendo ao mesmo tempo, o resultado reflete um instante
+ * recente da fila e pode estar desatualizado quando for usado.
+ *
+ * \pre O ponteiro \p *f deve ser diferente de \p NULL.
+ *
+ * \param *f representa um ponteiro para a fila cuja situação será consultada.
+ *
+ * \return \p true, se a fila estiver vazia e \p false, caso contrário.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *f seja igual a \p NULL.
+ */
+bool estah_vazia(FilaSPSC* f);
+
+/**
+ * \brief Retorna a quantidade de elementos da fila (com a mesma ressalva de \p estah_vazia).
+ *
+ * \pre O ponteiro \p *f deve ser diferente de \p NULL.
+ *
+ * \param *f representa um ponteiro para a fila.
+ *
+ * \return A quantidade de elementos da fila.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *f seja igual a \p NULL.
+ */
+int obter_tamanho(FilaSPSC* f);
+
+/**
+ * \brief Retorna a quantidade máxima de elementos da fila (sempre uma potência de dois).
+ *
+ * \pre O ponteiro \p *f deve ser diferente de \p NULL.
+ *
+ * \param *f representa um ponteiro para a fila.
+ *
+ * \return A capacidade da fila.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *f seja igual a \p NULL.
+ */
+int obter_capacidade(FilaSPSC* f);
+
+#endif
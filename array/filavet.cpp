@@ -1,14 +1,37 @@
 #include <assert.h> /**< Necessário para uso da macro "assert" */
 #include <cstdlib> /**< Necessário para uso do NULL */
+#include <cstring> /**< Necessário para uso das funções "memcpy". */
 #include "filavet.hpp"
+#include "varredura.hpp"
+
+/*
+ * A estrutura e as operações curtas (estah_vazia, inserir, remover etc.) ficam em
+ * filavet_em_linha.hpp. Fora do modo em linha (veja filavet.hpp), elas são compiladas aqui como
+ * funções comuns.
+ */
+#ifndef ESTRUTURAS_EM_LINHA
+#define FILAVET_EM_LINHA
+#include "filavet_em_linha.hpp"
+#endif
 
 using namespace std;
 
-struct FilaVet {
-	int itens[TAM_MAX]; /**< Vetor que armazena os elementos da fila. */            
-	int inicio; /**< Variável que indica a posição do primeiro elemento da fila. */
-	int fim; /**< Variável que indica a próxima posição vazia da fila. */
-};
+/* 
+ * Retorna o índice i avançado n posições (0 <= n < TAM_MAX_FILAVET), de forma circular.
+ */
+static int avancar(int i, int n) {
+	if (FILAVET_POTENCIA_DE_DOIS) {
+		return ((i + n) & (TAM_MAX_FILAVET - 1));
+	}
+	return ((i + n) % TAM_MAX_FILAVET);
+}
+
+#ifndef NDEBUG
+/* Retorna a quantidade de elementos da fila. Usada apenas nas verificações (assert). */
+static int tamanho(FilaVet* fila) {
+	return (fila->fim - fila->inicio + TAM_MAX_FILAVET) % TAM_MAX_FILAVET;
+}
+#endif
 
 FilaVet* criar_fila() {
 	/* 
@@ -19,6 +42,7 @@ FilaVet* criar_fila() {
     
 	fila->inicio = 0;
 	fila->fim = 0;
+	ESTATISTICA(zerar_estatisticas(&fila->estat));
 	return fila;
 }
 
@@ -33,49 +57,108 @@ void liberar_fila(FilaVet* fila) {
 	delete fila;		
 }
 
-bool estah_cheia(FilaVet* fila) {
-	assert(fila != NULL);	
-    
-	/* Retorna o próximo valor do índice fila->fim, de forma circular. 
-	 * Ou seja, se fila->fim == TAM_MAX - 1, retorna 0. Caso contrário, retorna fila->fim + 1. 
+void inserir_lote(FilaVet* fila, const int* itens, int n) {
+	assert((fila != NULL) && (itens != NULL));
+	assert((n >= 0) && (tamanho(fila) + n <= TAM_MAX_FILAVET - 1));
+
+	/*
+	 * Os "n" elementos ocupam as posições a partir de fila->fim. Se o bloco ultrapassar o final
+	 * do vetor, ele é copiado em dois trechos: um até o final do vetor e o restante a partir da
+	 * posição 0.
 	 */
-    int novo_fim = (fila->fim + 1) % TAM_MAX;
-    
-    /* Para a fila ser considerada cheia, o incremento de seu índice fim deve ser igual ao seu índice inicio */ 
-	return (novo_fim == fila->inicio);
+	int trecho = TAM_MAX_FILAVET - fila->fim;
+	if (trecho > n) {
+		trecho = n;
+	}
+	memcpy(fila->itens + fila->fim, itens, trecho * sizeof(int));
+	if (trecho < n) {
+		memcpy(fila->itens, itens + trecho, (n - trecho) * sizeof(int));
+	}
+
+	fila->fim = avancar(fila->fim, n);
+	ESTATISTICA(contar_insercoes(&fila->estat, n));
 }
 
-bool estah_vazia(FilaVet* fila) {
-	assert(fila != NULL);	
-	
-	/* Para a fila ser considerada vazia, seus índices inicio e fim devem ser iguais */ 
-	return (fila->inicio == fila->fim);
+void remover_lote(FilaVet* fila, int* saida, int n) {
+	assert((fila != NULL) && (saida != NULL));
+	assert((n >= 0) && (n <= tamanho(fila)));
+
+	/* Cópia em dois trechos, como em inserir_lote. */
+	int trecho = TAM_MAX_FILAVET - fila->inicio;
+	if (trecho > n) {
+		trecho = n;
+	}
+	memcpy(saida, fila->itens + fila->inicio, trecho * sizeof(int));
+	if (trecho < n) {
+		memcpy(saida + trecho, fila->itens, (n - trecho) * sizeof(int));
+	}
+
+	fila->inicio = avancar(fila->inicio, n);
+	ESTATISTICA(contar_remocoes(&fila->estat, n));
 }
 
-void inserir(FilaVet* fila, int item) {
+/*
+ * Retorna os elementos da fila: as posições de "inicio" até "fim" ou, se a fila der a volta no
+ * vetor, as posições de "inicio" até o final do vetor, seguidas das posições de 0 até "fim".
+ */
+static Trechos trechos(FilaVet* fila) {
+	if (fila->inicio <= fila->fim) {
+		Trechos t = {fila->itens + fila->inicio, fila->fim - fila->inicio, fila->itens, 0};
+		return t;
+	}
+	Trechos t = {fila->itens + fila->inicio, TAM_MAX_FILAVET - fila->inicio, fila->itens, fila->fim};
+	return t;
+}
+
+int buscar_primeiro(FilaVet* fila, int item) {
 	assert(fila != NULL);
-	assert(!estah_cheia(fila));    
-    
-	fila->itens[fila->fim] = item;
-	
-	/* Atenção para o incremento circular do índice fim da fila */
-    fila->fim = (fila->fim + 1) % TAM_MAX;
+
+	ESTATISTICA(contar_consulta(&fila->estat));
+	return varrer_primeiro(trechos(fila), item);
 }
 
-int remover(FilaVet* fila) {
+int contar_ocorrencias(FilaVet* fila, int item) {
 	assert(fila != NULL);
-	assert(!estah_vazia(fila));    
-        
-	int item = fila->itens[fila->inicio];
-    
-    /* Atenção para o incremento circular do índice inicio da fila */
-    fila->inicio = (fila->inicio + 1) % TAM_MAX;
-    return item;    
+
+	ESTATISTICA(contar_consulta(&fila->estat));
+	return varrer_ocorrencias(trechos(fila), item);
 }
 
-int obter_inicio(FilaVet* fila) {
+long long somar(FilaVet* fila) {
 	assert(fila != NULL);
-	assert(!estah_vazia(fila));    
-    
-	return fila->itens[fila->inicio];
+
+	ESTATISTICA(contar_consulta(&fila->estat));
+	return varrer_soma(trechos(fila));
+}
+
+int minimo(FilaVet* fila) {
+	assert(fila != NULL);
+	assert(!estah_vazia(fila));
+
+	ESTATISTICA(contar_consulta(&fila->estat));
+	return varrer_minimo(trechos(fila));
+}
+
+int maximo(FilaVet* fila) {
+	assert(fila != NULL);
+	assert(!estah_vazia(fila));
+
+	ESTATISTICA(contar_consulta(&fila->estat));
+	return varrer_maximo(trechos(fila));
+}
+
+int filtrar(FilaVet* fila, int menor, int maior, int* saida) {
+	assert((fila != NULL) && (saida != NULL));
+	assert(menor <= maior);
+
+	ESTATISTICA(contar_consulta(&fila->estat));
+	return varrer_filtro(trechos(fila), menor, maior, saida);
+}
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+const Estatisticas* obter_estatisticas(FilaVet* fila) {
+	assert(fila != NULL);
+
+	return &fila->estat;
 }
+#endif
@@ -10,19 +10,45 @@
 #ifndef FILAVET_HPP
 #define FILAVET_HPP
 
+#include "../comum/estatisticas.hpp"
+
 /**
- * \def TAM_MAX 
- * \brief Define a quantidade máxima de elementos suportada pela fila.
+ * \def TAM_MAX_FILAVET
+ * \brief Define o tamanho do vetor circular da fila (que comporta TAM_MAX_FILAVET - 1 elementos).
+ *
+ * Pode ser redefinida na compilação (por exemplo, com -DTAM_MAX_FILAVET=1024). Quando ela é uma
+ * potência de dois, o avanço circular dos índices é feito com uma máscara de bits, em vez do
+ * resto da divisão (operador %).
  * \hideinitializer
  */
-#define TAM_MAX 100 
+#ifndef TAM_MAX_FILAVET
+#define TAM_MAX_FILAVET 100
+#endif
+
+/**
+ * \def TAM_MAX
+ * \brief Nome antigo de TAM_MAX_FILAVET, mantido por compatibilidade.
+ *
+ * Como todos os cabeçalhos de array/ definiam TAM_MAX, incluir dois deles no mesmo arquivo
+ * redefinia a macro. Agora, ela só é definida pelo primeiro cabeçalho incluído e, por isso,
+ * pode não corresponder a esta fila: prefira TAM_MAX_FILAVET.
+ * \hideinitializer
+ */
+#ifndef TAM_MAX
+#define TAM_MAX TAM_MAX_FILAVET
+#endif
 
 /** 
  * \struct FilaVet
  * \brief Declaração opaca da estrutura de uma fila.
  * 
  * Isso significa que os detalhes de implementação desta estrutura estão escondidos do usuário do TAD. 
- * A definição da estrutura FilaVet encontra-se no arquivo \file filavet.cpp.
+ * A definição da estrutura FilaVet encontra-se no arquivo \file filavet_em_linha.hpp.
+ *
+ * Com a macro ESTRUTURAS_EM_LINHA definida na compilação, a definição passa a ser incluída por
+ * este cabeçalho, junto com as versões "inline" de estah_vazia, estah_cheia, inserir, remover e
+ * obter_inicio, que o compilador pode então expandir em cada chamada. Esse modo deve ser usado
+ * por todos os arquivos do programa, inclusive filavet.cpp.
  */
 struct FilaVet;
 
@@ -270,4 +296,193 @@ int remover(FilaVet* f);
  */
 int obter_inicio(FilaVet* f);
 
+/** 
+ * \brief Insere, de uma só vez, os \p n elementos do vetor \p itens no fim da fila.
+ * 
+ * O resultado é o mesmo de chamar inserir(f, itens[i]) para i = 0, 1, ..., n - 1, mas os
+ * elementos são copiados com no máximo duas chamadas a memcpy (duas quando o bloco dá a volta
+ * no vetor circular).
+ * 
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include "filavet.hpp"
+ * 
+ * using namespace std;
+ *
+ * int main() {
+ *     FilaVet *f = criar_fila();
+ *     int entrada[] = {1, 2, 3};
+ *     int saida[3];
+ *     inserir_lote(f, entrada, 3);
+ *     remover_lote(f, saida, 3);
+ *     cout << saida[0] << " " << saida[1] << " " << saida[2] << endl;
+ *     liberar_fila(f);
+ *     return EXIT_SUCCESS;
+ * }  
+ * \endcode
+ * 
+ * Saída esperada:
+ * \code {.unparsed}
+ *     1 2 3
+ * \endcode
+ * 
+ * \pre Os ponteiros \p *f e \p *itens devem ser diferentes de \p NULL.
+ * \pre A fila deve ter espaço para mais \p n elementos.
+ * 
+ * \param *f representa um ponteiro para a fila.
+ * \param *itens representa o vetor com os elementos a serem inseridos.
+ * \param n representa a quantidade de elementos a serem inseridos.
+ * 
+ * \return void
+ * 
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL ou
+ * 			caso não haja espaço para os \p n elementos.
+ */
+void inserir_lote(FilaVet* f, const int* itens, int n);
+
+/** 
+ * \brief Remove, de uma só vez, os \p n primeiros elementos da fila.
+ * 
+ * O resultado é o mesmo de chamar saida[i] = remover(f) para i = 0, 1, ..., n - 1.
+ * 
+ * \pre Os ponteiros \p *f e \p *saida devem ser diferentes de \p NULL.
+ * \pre A fila deve ter pelo menos \p n elementos.
+ * 
+ * \param *f representa um ponteiro para a fila.
+ * \param *saida representa o vetor, com pelo menos \p n posições, que receberá os elementos.
+ * \param n representa a quantidade de elementos a serem removidos.
+ * 
+ * \return void
+ * 
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL ou
+ * 			caso a fila tenha menos do que \p n elementos.
+ */
+void remover_lote(FilaVet* f, int* saida, int n);
+
+/** 
+ * \brief Retorna a posição da primeira ocorrência de \p item na fila, percorrendo-a do início.
+ * 
+ * Esta e as demais consultas em bloco (contar_ocorrencias, somar, minimo, maximo e filtrar)
+ * percorrem a fila sem remover elementos, lendo-os direto do vetor circular, em até dois
+ * trechos, e usam instruções SIMD (AVX2 ou AVX-512) quando o processador as suporta
+ * (veja varredura.hpp).
+ * 
+ * \pre O ponteiro \p *f deve ser diferente de \p NULL.
+ * 
+ * \param *f representa um ponteiro para a fila.
+ * \param item representa o item procurado.
+ * 
+ * \return A posição de \p item, contada a partir do início (0), ou -1, se ele não estiver na fila.
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *f seja igual a \p NULL.
+ */
+int buscar_primeiro(FilaVet* f, int item);
+
+/** 
+ * \brief Retorna a quantidade de ocorrências de \p item na fila.
+ * 
+ * \pre O ponteiro \p *f deve ser diferente de \p NULL.
+ * 
+ * \param *f representa um ponteiro para a fila.
+ * \param item representa o item procurado.
+ * 
+ * \return A quantidade de elementos iguais a \p item.
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *f seja igual a \p NULL.
+ */
+int contar_ocorrencias(FilaVet* f, int item);
+
+/** 
+ * \brief Retorna a soma dos elementos da fila.
+ * 
+ * \pre O ponteiro \p *f deve ser diferente de \p NULL.
+ * 
+ * \param *f representa um ponteiro para a fila.
+ * 
+ * \return A soma dos elementos (0, se a fila estiver vazia), calculada em 64 bits, sem estouro.
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *f seja igual a \p NULL.
+ */
+long long somar(FilaVet* f);
+
+/** 
+ * \brief Retorna o menor elemento da fila.
+ * 
+ * \pre O ponteiro \p *f deve ser diferente de \p NULL.
+ * \pre A fila não pode estar vazia.
+ * 
+ * \param *f representa um ponteiro para a fila.
+ * 
+ * \return O menor elemento.
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *f seja igual a \p NULL ou
+ * 			caso a fila esteja vazia.
+ */
+int minimo(FilaVet* f);
+
+/** 
+ * \brief Retorna o maior elemento da fila.
+ * 
+ * \pre O ponteiro \p *f deve ser diferente de \p NULL.
+ * \pre A fila não pode estar vazia.
+ * 
+ * \param *f representa um ponteiro para a fila.
+ * 
+ * \return O maior elemento.
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *f seja igual a \p NULL ou
+ * 			caso a fila esteja vazia.
+ */
+int maximo(FilaVet* f);
+
+/** 
+ * \brief Copia para \p saida, na ordem da fila, os elementos do intervalo [menor, maior].
+ * 
+ * \code {.cpp}
+ *     int saida[TAM_MAX_FILAVET];
+ *     int n = filtrar(f, 10, 20, saida); // saida[0, n) contém os elementos x com 10 <= x <= 20
+ * \endcode
+ * 
+ * \pre Os ponteiros \p *f e \p *saida devem ser diferentes de \p NULL.
+ * \pre menor <= maior.
+ * 
+ * \param *f representa um ponteiro para a fila.
+ * \param menor representa o menor valor aceito.
+ * \param maior representa o maior valor aceito.
+ * \param *saida representa o vetor que receberá os elementos. Ele deve ter uma posição para cada
+ * 		elemento da fila, mesmo que poucos sejam copiados: as posições após os copiados podem
+ * 		ser sobrescritas.
+ * 
+ * \return A quantidade de elementos copiados.
+ * 
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL ou
+ * 			caso menor > maior.
+ */
+int filtrar(FilaVet* f, int menor, int maior, int* saida);
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+/**
+ * \brief Retorna os contadores de uso da fila.
+ *
+ * Disponível apenas quando a macro ESTRUTURAS_ESTATISTICAS é definida na compilação. Os contadores
+ * continuam sendo atualizados pelas operações seguintes; veja o arquivo estatisticas.hpp.
+ *
+ * \pre O ponteiro \p *f deve ser diferente de \p NULL.
+ *
+ * \param *f representa um ponteiro para a fila.
+ *
+ * \return O endereço dos contadores da fila.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *f seja igual a \p NULL.
+ */
+const Estatisticas* obter_estatisticas(FilaVet* f);
+#endif
+
+#ifdef ESTRUTURAS_EM_LINHA
+#define FILAVET_EM_LINHA inline
+#include "filavet_em_linha.hpp"
+#endif
+
 #endif
@@ -0,0 +1,91 @@
+/**
+ * \file filavet_em_linha.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Definição da estrutura FilaVet e das operações curtas da fila
+ *
+ * Incluído apenas por filavet.cpp (versões comuns das operações) e por filavet.hpp, quando a
+ * macro ESTRUTURAS_EM_LINHA está definida (versões "inline", conforme a macro FILAVET_EM_LINHA).
+ */
+
+#ifndef FILAVET_EM_LINHA_HPP
+#define FILAVET_EM_LINHA_HPP
+
+#include <assert.h> /**< Necessário para uso da macro "assert". */
+#include <cstdlib> /**< Necessário para uso do NULL. */
+#include "filavet.hpp"
+
+struct FilaVet {
+	int itens[TAM_MAX_FILAVET]; /**< Vetor que armazena os elementos da fila. */
+	int inicio; /**< Variável que indica a posição do primeiro elemento da fila. */
+	int fim; /**< Variável que indica a próxima posição vazia da fila. */
+#ifdef ESTRUTURAS_ESTATISTICAS
+	Estatisticas estat; /**< Contadores de uso (veja estatisticas.hpp). */
+#endif
+};
+
+/*
+ * Indica se o tamanho do vetor é uma potência de dois. Nesse caso, os índices circulares são
+ * calculados com uma máscara de bits (i & (TAM_MAX_FILAVET - 1)), que custa uma única instrução,
+ * em vez do resto da divisão. Como a condição é constante, o compilador descarta o ramo não usado.
+ */
+const bool FILAVET_POTENCIA_DE_DOIS = ((TAM_MAX_FILAVET & (TAM_MAX_FILAVET - 1)) == 0);
+
+/*
+ * Retorna o próximo valor do índice i, de forma circular.
+ * Ou seja, se i == TAM_MAX_FILAVET - 1, retorna 0. Caso contrário, retorna i + 1.
+ */
+inline int incrementar_filavet(int i) {
+	if (FILAVET_POTENCIA_DE_DOIS) {
+		return ((i + 1) & (TAM_MAX_FILAVET - 1));
+	}
+	return ((i + 1) % TAM_MAX_FILAVET);
+}
+
+FILAVET_EM_LINHA bool estah_cheia(FilaVet* fila) {
+	assert(fila != NULL);
+
+	/* Para a fila ser considerada cheia, o incremento de seu índice fim deve ser igual ao seu índice inicio */
+	return (incrementar_filavet(fila->fim) == fila->inicio);
+}
+
+FILAVET_EM_LINHA bool estah_vazia(FilaVet* fila) {
+	assert(fila != NULL);
+
+	/* Para a fila ser considerada vazia, seus índices inicio e fim devem ser iguais */
+	return (fila->inicio == fila->fim);
+}
+
+FILAVET_EM_LINHA void inserir(FilaVet* fila, int item) {
+	assert(fila != NULL);
+	assert(!estah_cheia(fila));
+
+	fila->itens[fila->fim] = item;
+
+	/* Atenção para o incremento circular do índice fim da fila */
+	fila->fim = incrementar_filavet(fila->fim);
+	ESTATISTICA(contar_insercoes(&fila->estat, 1));
+}
+
+FILAVET_EM_LINHA int remover(FilaVet* fila) {
+	assert(fila != NULL);
+	assert(!estah_vazia(fila));
+
+	int item = fila->itens[fila->inicio];
+
+	/* Atenção para o incremento circular do índice inicio da fila */
+	fila->inicio = incrementar_filavet(fila->inicio);
+	ESTATISTICA(contar_remocoes(&fila->estat, 1));
+	return item;
+}
+
+FILAVET_EM_LINHA int obter_inicio(FilaVet* fila) {
+	assert(fila != NULL);
+	assert(!estah_vazia(fila));
+
+	ESTATISTICA(contar_consulta(&fila->estat));
+	return fila->itens[fila->inicio];
+}
+
+#endif
+
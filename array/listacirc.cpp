@@ -0,0 +1,187 @@
+#include <assert.h> /**< Necessário para uso da macro "assert". */
+#include <cstdlib> /**< Necessário para uso do NULL. */
+#include <cstring> /**< Necessário para uso da função "memmove". */
+#include "listacirc.hpp"
+
+using namespace std;
+
+struct ListaCirc {
+	int itens[TAM_MAX_LISTACIRC]; /**< Vetor circular que armazena os elementos da lista. */
+	int inicio; /**< Variável que indica a posição do vetor onde está o primeiro elemento da lista. */
+	int tam; /**< Variável que indica a quantidade de elementos da lista. */
+#ifdef ESTRUTURAS_ESTATISTICAS
+	Estatisticas estat; /**< Contadores de uso (veja estatisticas.hpp). */
+#endif
+};
+
+/*
+ * Indica se o tamanho do vetor é uma potência de dois, como na FilaDVet: nesse caso, os índices
+ * circulares são calculados com uma máscara de bits, em vez do resto da divisão.
+ */
+static const bool TAM_POTENCIA_DE_DOIS = ((TAM_MAX_LISTACIRC & (TAM_MAX_LISTACIRC - 1)) == 0);
+
+/* Retorna o próximo valor do índice i, de forma circular. */
+static int incrementar(int i) {
+	if (TAM_POTENCIA_DE_DOIS) {
+		return ((i + 1) & (TAM_MAX_LISTACIRC - 1));
+	}
+	return ((i + 1) % TAM_MAX_LISTACIRC);
+}
+
+/* Retorna o decremento do índice i, de forma circular. */
+static int decrementar(int i) {
+	if (TAM_POTENCIA_DE_DOIS) {
+		return ((i - 1) & (TAM_MAX_LISTACIRC - 1));
+	}
+	return ((i - 1 + TAM_MAX_LISTACIRC) % TAM_MAX_LISTACIRC);
+}
+
+/* Retorna o índice do vetor onde está (ou estará) o elemento da posição "pos" da lista. */
+static int indice(ListaCirc* lista, int pos) {
+	int i = lista->inicio + pos;
+	if (TAM_POTENCIA_DE_DOIS) {
+		return (i & (TAM_MAX_LISTACIRC - 1));
+	}
+	return (i < TAM_MAX_LISTACIRC) ? i : i - TAM_MAX_LISTACIRC;
+}
+
+/*
+ * Desloca uma posição para frente os "n" elementos que ocupam o vetor a partir do índice "i",
+ * de forma circular. Como o trecho pode dar a volta no vetor, a cópia é feita com até duas
+ * chamadas a memmove, mais a cópia do elemento que passa da última para a primeira posição.
+ */
+static void deslocar_para_frente(ListaCirc* lista, int i, int n) {
+	ESTATISTICA(contar_deslocamento(&lista->estat, n, sizeof(int)));
+	if (i + n < TAM_MAX_LISTACIRC) {
+		memmove(lista->itens + i + 1, lista->itens + i, n * sizeof(int));
+	} else {
+		memmove(lista->itens + 1, lista->itens, (i + n - TAM_MAX_LISTACIRC) * sizeof(int));
+		lista->itens[0] = lista->itens[TAM_MAX_LISTACIRC - 1];
+		// Se "i" é o último índice, o único elemento desse trecho já foi copiado para o índice 0.
+		int resto = TAM_MAX_LISTACIRC - 1 - i;
+		if (resto > 0) {
+			memmove(lista->itens + i + 1, lista->itens + i, resto * sizeof(int));
+		}
+	}
+}
+
+/*
+ * Desloca uma posição para trás os "n" elementos que ocupam o vetor a partir do índice "i",
+ * de forma circular (o primeiro deles passa a ocupar o índice anterior a "i").
+ */
+static void deslocar_para_tras(ListaCirc* lista, int i, int n) {
+	ESTATISTICA(contar_deslocamento(&lista->estat, n, sizeof(int)));
+	int destino = decrementar(i);
+	if (destino + n < TAM_MAX_LISTACIRC) {
+		memmove(lista->itens + destino, lista->itens + destino + 1, n * sizeof(int));
+	} else {
+		memmove(lista->itens + destino, lista->itens + destino + 1, (TAM_MAX_LISTACIRC - 1 - destino) * sizeof(int));
+		lista->itens[TAM_MAX_LISTACIRC - 1] = lista->itens[0];
+		memmove(lista->itens, lista->itens + 1, (destino + n - TAM_MAX_LISTACIRC) * sizeof(int));
+	}
+}
+
+ListaCirc* criar_lista_circ() {
+	/*
+	 * Caso não seja possível alocar o espaço solicitado, o próprio operador "new"
+	 * irá lançar uma exceção abortando a execução do programa.
+	 */
+	ListaCirc* lista = new ListaCirc;
+
+	lista->inicio = 0;
+	lista->tam = 0;
+	ESTATISTICA(zerar_estatisticas(&lista->estat));
+	return lista;
+}
+
+void liberar_lista(ListaCirc* lista) {
+	/*
+	 * Macro da biblioteca \file assert.h. Aborta a execução do programa e envia uma mensagem
+	 * de erro para a saída de erro padrão, caso a expressão entre parênteses seja avaliada
+	 * como false.
+	 */
+	assert(lista != NULL);
+
+	delete lista;
+}
+
+bool estah_vazia(ListaCirc* lista) {
+	assert(lista != NULL);
+
+	return (lista->tam == 0);
+}
+
+bool estah_cheia(ListaCirc* lista) {
+	assert(lista != NULL);
+
+	return (lista->tam == TAM_MAX_LISTACIRC);
+}
+
+void inserir(ListaCirc* lista, int item, int pos) {
+	assert(lista != NULL);
+	assert(!estah_cheia(lista));
+
+	/* Garante que a posição passada por parâmetro seja válida. */
+	assert((pos >= 0) && (pos <= lista->tam));
+
+	if (pos < lista->tam - pos) {
+		/* Desloca os "pos" primeiros elementos uma posição para trás, recuando o início. */
+		deslocar_para_tras(lista, lista->inicio, pos);
+		lista->inicio = decrementar(lista->inicio);
+	} else {
+		/* Desloca os elementos a partir de "pos" uma posição para frente. */
+		deslocar_para_frente(lista, indice(lista, pos), lista->tam - pos);
+	}
+
+	lista->itens[indice(lista, pos)] = item;
+	lista->tam++;
+	ESTATISTICA(contar_insercoes(&lista->estat, 1));
+}
+
+int remover(ListaCirc* lista, int pos) {
+	assert(lista != NULL);
+	assert(!estah_vazia(lista));
+
+	/* Garante que a posição passada por parâmetro seja válida. */
+	assert((pos >= 0) && (pos < lista->tam));
+
+	int item = lista->itens[indice(lista, pos)];
+
+	if (pos < lista->tam - 1 - pos) {
+		/* Desloca os "pos" primeiros elementos uma posição para frente e avança o início. */
+		deslocar_para_frente(lista, lista->inicio, pos);
+		lista->inicio = incrementar(lista->inicio);
+	} else {
+		/* Desloca os elementos após "pos" uma posição para trás. */
+		deslocar_para_tras(lista, indice(lista, pos + 1), lista->tam - 1 - pos);
+	}
+
+	lista->tam--;
+	ESTATISTICA(contar_remocoes(&lista->estat, 1));
+	return item;
+}
+
+int obter(ListaCirc* lista, int pos) {
+	assert(lista != NULL);
+	assert(!estah_vazia(lista));
+
+	/* Garante que a posição passada por parâmetro seja válida. */
+	assert((pos >= 0) && (pos < lista->tam));
+
+	ESTATISTICA(contar_consulta(&lista->estat));
+	return lista->itens[indice(lista, pos)];
+}
+
+int obter_tamanho(ListaCirc* lista) {
+	assert(lista != NULL);
+
+	return lista->tam;
+}
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+const Estatisticas* obter_estatisticas(ListaCirc* lista) {
+	assert(lista != NULL);
+
+	return &lista->estat;
+}
+#endif
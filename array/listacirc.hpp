@@ -0,0 +1,264 @@
+/**
+ * \file listacirc.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Interface do TAD ListaCirc
+ *
+ * Disponibiliza as funções necessárias para manipulação da estrutura de dados Lista,
+ * implementada com um arranjo circular, como o da FilaDVet. Diferentemente da ListaVet, o primeiro
+ * elemento não precisa ficar na posição 0 do vetor: cada inserção ou remoção desloca os elementos
+ * do lado mais próximo da posição informada (os anteriores, recuando o início, ou os seguintes).
+ * Assim, as operações nas duas extremidades custam O(1) e, no meio, deslocam em média a metade
+ * dos elementos deslocados pela ListaVet.
+ */
+
+#ifndef LISTACIRC_HPP
+#define LISTACIRC_HPP
+
+#include "../comum/estatisticas.hpp"
+
+/**
+ * \def TAM_MAX_LISTACIRC
+ * \brief Define a quantidade máxima de elementos suportada pela lista.
+ *
+ * Pode ser redefinida na compilação (por exemplo, com -DTAM_MAX_LISTACIRC=1024). Quando ela é uma
+ * potência de dois, o avanço circular dos índices é feito com uma máscara de bits, em vez do
+ * resto da divisão (operador %).
+ * \hideinitializer
+ */
+#ifndef TAM_MAX_LISTACIRC
+#define TAM_MAX_LISTACIRC 100
+#endif
+
+/**
+ * \struct ListaCirc
+ * \brief Declaração opaca da estrutura da lista.
+ *
+ * Isso significa que os detalhes de implementação desta estrutura estão escondidos do usuário do TAD.
+ * A definição da estrutura ListaCirc encontra-se no arquivo \file listacirc.cpp.
+ */
+struct ListaCirc;
+
+/**
+ * \brief Cria dinamicamente uma lista vazia e retorna o endereço onde ela se encontra alocada.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include "listacirc.hpp"
+
+ * int main() {
+ *     ListaCirc *li = criar_lista_circ();
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * \return O endereço de memória da lista alocada dinamicamente.
+ */
+ListaCirc* criar_lista_circ();
+
+/**
+ * \brief Libera o espaço de memória anteriormente reservado para a lista.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include "listacirc.hpp"
+ *
+ * int main() {
+ *     ListaCirc *li = criar_lista_circ();
+ *     liberar_lista(li);
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista a ser liberada da memória.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+void liberar_lista(ListaCirc* li);
+
+/**
+ * \brief Verifica se a lista está vazia.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista cuja situação será consultada.
+ *
+ * \return \p true, se a lista estiver vazia e \p false, caso contrário.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+bool estah_vazia(ListaCirc* li);
+
+/**
+ * \brief Verifica se a lista está cheia.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista cuja situação será consultada.
+ *
+ * \return \p true, se a lista estiver cheia e \p false, caso contrário.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+bool estah_cheia(ListaCirc* li);
+
+/**
+ * \brief Insere um novo elemento na lista.
+ *
+ * A posição informada deve estar no intervalo [0, tamanho_da_lista]. Se ela estiver na primeira
+ * metade da lista, os elementos anteriores são deslocados uma posição para trás (e o início da
+ * lista recua); caso contrário, os elementos seguintes são deslocados uma posição para frente.
+ * Portanto, a inserção no início ou no final da lista custa O(1).
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include "listacirc.hpp"
+ *
+ * using namespace std;
+ *
+ * int main() {
+ *     ListaCirc *li = criar_lista_circ();
+ *     inserir(li, 2, 0);
+ *     inserir(li, 3, 1);
+ *     inserir(li, 1, 0);
+ *     for (int i = 0; i < obter_tamanho(li); i++) {
+ *         cout << obter(li, i) << " ";
+ *     }
+ *     cout << endl;
+ *     liberar_lista(li);
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * Saída esperada:
+ * \code {.unparsed}
+ *     1 2 3
+ * \endcode
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre A lista não deve estar cheia.
+ * \pre A posição \p pos deve ser válida.
+ *
+ * \param *li representa um ponteiro para a lista onde o elemento será inserido.
+ * \param item representa o item a ser inserido na lista.
+ * \param pos representa a posição onde o \p item deve ser inserido na lista.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado:
+ * 			1. caso o ponteiro \p *li seja igual a \p NULL;
+ * 			2. caso a lista esteja cheia; ou
+ * 			3. caso a posição informada seja inválida.
+ */
+void inserir(ListaCirc* li, int item, int pos);
+
+/**
+ * \brief Remove e retorna um elemento da lista.
+ *
+ * A posição informada deve estar no intervalo [0, tamanho_da_lista - 1]. Assim como na inserção,
+ * são deslocados apenas os elementos do lado mais próximo da posição; a remoção do início ou do
+ * final da lista custa O(1).
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include "listacirc.hpp"
+ *
+ * using namespace std;
+ *
+ * int main() {
+ *     ListaCirc *li = criar_lista_circ();
+ *     for (int i = 1; i <= 3; i++) {
+ *         inserir(li, i, obter_tamanho(li));
+ *     }
+ *     while (!estah_vazia(li)) {
+ *         cout << remover(li, 0) << endl;
+ *     }
+ *     liberar_lista(li);
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * Saída esperada:
+ * \code {.unparsed}
+ *     1
+ *     2
+ *     3
+ * \endcode
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre A lista não deve estar vazia.
+ * \pre A posição \p pos deve ser válida.
+ *
+ * \param *li representa um ponteiro para a lista de onde o elemento será removido.
+ * \param pos representa a posição de onde o elemento deve ser removido da lista.
+ *
+ * \return O elemento removido da lista.
+ *
+ * \warning O programa será abortado:
+ * 			1. caso o ponteiro \p *li seja igual a \p NULL;
+ * 			2. caso a lista esteja vazia; ou
+ * 			3. caso a posição informada seja inválida.
+ */
+int remover(ListaCirc* li, int pos);
+
+/**
+ * \brief Retorna (sem remover) o elemento da posição \p pos da lista, em O(1).
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre A lista não deve estar vazia.
+ * \pre A posição \p pos deve estar no intervalo [0, tamanho_da_lista - 1].
+ *
+ * \param *li representa um ponteiro para a lista.
+ * \param pos representa a posição do elemento a ser obtido.
+ *
+ * \return O elemento da posição \p pos.
+ *
+ * \warning O programa será abortado:
+ * 			1. caso o ponteiro \p *li seja igual a \p NULL;
+ * 			2. caso a lista esteja vazia; ou
+ * 			3. caso a posição informada seja inválida.
+ */
+int obter(ListaCirc* li, int pos);
+
+/**
+ * \brief Retorna a quantidade de elementos da lista.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista.
+ *
+ * \return A quantidade de elementos da lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+int obter_tamanho(ListaCirc* li);
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+/**
+ * \brief Retorna os contadores de uso da lista.
+ *
+ * Disponível apenas quando a macro ESTRUTURAS_ESTATISTICAS é definida na compilação. Os contadores
+ * continuam sendo atualizados pelas operações seguintes; veja o arquivo estatisticas.hpp.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista.
+ *
+ * \return O endereço dos contadores da lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+const Estatisticas* obter_estatisticas(ListaCirc* li);
+#endif
+
+#endif
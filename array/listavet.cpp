@@ -1,14 +1,70 @@
 #include <assert.h> /**< Necessário para uso da macro "assert". */
+#include <climits> /**< Necessário para uso da macro "INT_MAX". */
+#include <cstdint> /**< Necessário para uso do tipo "uintptr_t". */
 #include <cstdlib> /**< Necessário para uso do NULL. */
+#include <cstring> /**< Necessário para uso das funções "memcpy" e "memmove". */
 #include "listavet.hpp"
+#include "ordenacao.hpp"
+#include "varredura.hpp"
 
 using namespace std;
 
 struct ListaVet {
-	int itens[TAM_MAX]; /**< Vetor que armazena os elementos da lista. */        
-	int ultimo; /**< Variável que indica a próxima posição vazia da lista. */
+	int itens[TAM_MAX_LISTAVET]; /**< Vetor que armazena os elementos da lista. */        
+	int ultimo; /**< Variável que indica a quantidade de elementos da lista. */
+	int lacuna; /**< Posição onde começa o espaço livre do vetor (igual a "ultimo", fora do modo lacuna). */
+	bool modo_lacuna; /**< Indica se o espaço livre deve acompanhar a última posição editada. */
+	bool eytz_ativado; /**< Indica se as buscas devem usar o índice no leiaute de Eytzinger. */
+	bool eytz_atualizado; /**< Indica se o índice corresponde aos elementos atuais da lista. */
+	int* eytz_valores; /**< Elementos da lista no leiaute de Eytzinger, nas posições [1, ultimo]. */
+	int* eytz_posicoes; /**< Posição na lista de cada elemento de "eytz_valores". */
+#ifdef ESTRUTURAS_ESTATISTICAS
+	Estatisticas estat; /**< Contadores de uso (veja estatisticas.hpp). */
+#endif
 };
 
+/*
+ * No modo lacuna, os elementos das posições [0, lacuna) ficam no início do vetor e os demais ficam
+ * no seu final, separados pelo espaço livre de TAM_MAX_LISTAVET - ultimo posições. Fora desse modo,
+ * o espaço livre fica sempre no final do vetor (lacuna == ultimo), como na lista tradicional.
+ */
+
+/* Retorna o tamanho do espaço livre do vetor. */
+static int tamanho_lacuna(ListaVet* lista) {
+	return TAM_MAX_LISTAVET - lista->ultimo;
+}
+
+/* Retorna o índice do vetor onde está o elemento da posição "pos". */
+static int indice(ListaVet* lista, int pos) {
+	return (pos < lista->lacuna) ? pos : pos + tamanho_lacuna(lista);
+}
+
+/*
+ * Move o espaço livre para a posição "pos", deslocando com uma única chamada a memmove apenas os
+ * elementos entre a posição atual do espaço livre e a nova. Assim, uma sequência de edições em
+ * posições próximas desloca poucos elementos, independentemente do tamanho da lista.
+ */
+static void mover_lacuna(ListaVet* lista, int pos) {
+	int tam = tamanho_lacuna(lista);
+	ESTATISTICA(contar_deslocamento(&lista->estat, abs(pos - lista->lacuna), sizeof(int)));
+#if defined(__GNUC__)
+	/*
+	 * Com a LTO, o GCC não consegue deduzir que a lacuna nunca é negativa e, sem as verificações
+	 * (NDEBUG), acusa cópias para antes do início do vetor. Informar o invariante evita o aviso.
+	 */
+	if (lista->lacuna < 0) {
+		__builtin_unreachable();
+	}
+#endif
+	if (pos < lista->lacuna) {
+		memmove(lista->itens + pos + tam, lista->itens + pos, (lista->lacuna - pos) * sizeof(int));
+	} else if (pos > lista->lacuna) {
+		memmove(lista->itens + lista->lacuna, lista->itens + lista->lacuna + tam,
+			(pos - lista->lacuna) * sizeof(int));
+	}
+	lista->lacuna = pos;
+}
+
 ListaVet* criar_lista() {
 	/* 
 	 * Caso não seja possível alocar o espaço solicitado, o próprio operador "new"
@@ -17,6 +73,13 @@ ListaVet* criar_lista() {
 	ListaVet* lista = new ListaVet;
     
 	lista->ultimo = 0;
+	lista->lacuna = 0;
+	lista->modo_lacuna = false;
+	lista->eytz_ativado = false;
+	lista->eytz_atualizado = false;
+	lista->eytz_valores = NULL;
+	lista->eytz_posicoes = NULL;
+	ESTATISTICA(zerar_estatisticas(&lista->estat));
 	return lista;
 }
 
@@ -28,13 +91,15 @@ void liberar_lista(ListaVet* lista) {
 	 */
 	assert(lista != NULL);
 	
+	delete[] lista->eytz_valores;
+	delete[] lista->eytz_posicoes;
 	delete lista;		
 }
 
 bool estah_cheia(ListaVet* lista) {
 	assert(lista != NULL);	
     
-	return (lista->ultimo == TAM_MAX);
+	return (lista->ultimo == TAM_MAX_LISTAVET);
 }
 
 bool estah_vazia(ListaVet* lista) {
@@ -49,14 +114,25 @@ void inserir(ListaVet* lista, int item, int pos) {
 	
 	/* Garante que a posição passada por parâmetro seja válida. */
 	assert((pos >= 0) && (pos <= lista->ultimo));   
+	ESTATISTICA(contar_insercoes(&lista->estat, 1));
+	lista->eytz_atualizado = false;
     
-	/* Laço responsável por deslocar os elementos da lista uma posição para a direita. */
-    for(int i = lista->ultimo; i > pos; i--)  {
-        lista->itens[i] = lista->itens[i - 1];
-    }
+	if (lista->modo_lacuna) {
+		/* O novo elemento ocupa a primeira posição do espaço livre, que encolhe. */
+		mover_lacuna(lista, pos);
+		lista->itens[pos] = item;
+		lista->lacuna++;
+		lista->ultimo++;
+		return;
+	}
+
+	/* Desloca os elementos da lista uma posição para a direita, com uma única cópia de bloco. */
+	ESTATISTICA(contar_deslocamento(&lista->estat, lista->ultimo - pos, sizeof(int)));
+	memmove(lista->itens + pos + 1, lista->itens + pos, (lista->ultimo - pos) * sizeof(int));
     
     lista->itens[pos] = item;
     lista->ultimo++;
+    lista->lacuna = lista->ultimo;
 }
 
 int remover(ListaVet* lista, int pos) {
@@ -65,15 +141,25 @@ int remover(ListaVet* lista, int pos) {
 	
 	/* Garante que a posição passada por parâmetro seja válida. */
 	assert((pos >= 0) && (pos < lista->ultimo));      
+	ESTATISTICA(contar_remocoes(&lista->estat, 1));
+	lista->eytz_atualizado = false;
         
+	if (lista->modo_lacuna) {
+		/* O elemento removido é o primeiro após o espaço livre, que cresce. */
+		mover_lacuna(lista, pos);
+		int item = lista->itens[pos + tamanho_lacuna(lista)];
+		lista->ultimo--;
+		return item;
+	}
+
 	int item = lista->itens[pos];
     
-    /* Laço responsável por deslocar os elementos da lista uma posição para a esquerda. */
-    for(int i = pos; i < (lista->ultimo - 1); i++)  {
-        lista->itens[i] = lista->itens[i + 1];
-    }
+    /* Desloca os elementos da lista uma posição para a esquerda, com uma única cópia de bloco. */
+    ESTATISTICA(contar_deslocamento(&lista->estat, lista->ultimo - pos - 1, sizeof(int)));
+    memmove(lista->itens + pos, lista->itens + pos + 1, (lista->ultimo - pos - 1) * sizeof(int));
     
     lista->ultimo--;
+    lista->lacuna = lista->ultimo;
     return item;   
 }
 
@@ -84,7 +170,8 @@ int obter(ListaVet* lista, int pos) {
     /* Garante que a posição passada por parâmetro seja válida. */
 	assert((pos >= 0) && (pos < lista->ultimo));      
     
-	return lista->itens[pos];
+	ESTATISTICA(contar_consulta(&lista->estat));
+	return lista->itens[indice(lista, pos)];
 }
 
 int obter_tamanho(ListaVet* lista) {
@@ -92,3 +179,314 @@ int obter_tamanho(ListaVet* lista) {
 	
 	return lista->ultimo;
 }
+
+void inserir_intervalo(ListaVet* lista, int pos, const int* primeiro, const int* ultimo) {
+	assert((lista != NULL) && (primeiro != NULL) && (ultimo != NULL));
+	assert(primeiro <= ultimo);
+
+	/* Garante que a posição passada por parâmetro seja válida. */
+	assert((pos >= 0) && (pos <= lista->ultimo));
+
+	int n = (int) (ultimo - primeiro);
+	assert(lista->ultimo + n <= TAM_MAX_LISTAVET);
+	ESTATISTICA(contar_insercoes(&lista->estat, n));
+	lista->eytz_atualizado = false;
+
+	if (lista->modo_lacuna) {
+		mover_lacuna(lista, pos);
+		memcpy(lista->itens + pos, primeiro, n * sizeof(int));
+		lista->lacuna += n;
+		lista->ultimo += n;
+		return;
+	}
+
+	/* Desloca o final da lista "n" posições para a direita, com uma única cópia de bloco. */
+	ESTATISTICA(contar_deslocamento(&lista->estat, lista->ultimo - pos, sizeof(int)));
+	memmove(lista->itens + pos + n, lista->itens + pos, (lista->ultimo - pos) * sizeof(int));
+	memcpy(lista->itens + pos, primeiro, n * sizeof(int));
+	lista->ultimo += n;
+	lista->lacuna = lista->ultimo;
+}
+
+void remover_intervalo(ListaVet* lista, int pos, int n, int* saida) {
+	assert(lista != NULL);
+
+	/* Garante que o intervalo [pos, pos + n - 1] esteja dentro da lista. */
+	assert((pos >= 0) && (n >= 0) && (pos + n <= lista->ultimo));
+	ESTATISTICA(contar_remocoes(&lista->estat, n));
+	lista->eytz_atualizado = false;
+
+	if (lista->modo_lacuna) {
+		mover_lacuna(lista, pos);
+		if (saida != NULL) {
+			memcpy(saida, lista->itens + pos + tamanho_lacuna(lista), n * sizeof(int));
+		}
+		lista->ultimo -= n;
+		return;
+	}
+
+	if (saida != NULL) {
+		memcpy(saida, lista->itens + pos, n * sizeof(int));
+	}
+
+	/* Desloca o final da lista "n" posições para a esquerda, com uma única cópia de bloco. */
+	ESTATISTICA(contar_deslocamento(&lista->estat, lista->ultimo - pos - n, sizeof(int)));
+	memmove(lista->itens + pos, lista->itens + pos + n, (lista->ultimo - pos - n) * sizeof(int));
+	lista->ultimo -= n;
+	lista->lacuna = lista->ultimo;
+}
+
+void definir_modo_lacuna(ListaVet* lista, bool ativado) {
+	assert(lista != NULL);
+
+	/* Ao sair do modo lacuna, o espaço livre volta para o final do vetor. */
+	if (!ativado) {
+		mover_lacuna(lista, lista->ultimo);
+	}
+	lista->modo_lacuna = ativado;
+}
+
+/*
+ * Retorna a quantidade de elementos de v[0, n) menores que "item", com uma busca binária sem
+ * desvios: a cada passo, o intervalo cai à metade e o início avança "metade" posições multiplicadas
+ * pelo resultado da comparação (0 ou 1). Com um "if" ou com o operador "?:", o GCC gera um desvio
+ * condicional, cuja previsão o processador erra em metade dos passos de uma busca aleatória.
+ */
+static int contar_menores(const int* v, int n, int item) {
+	if (n == 0) {
+		return 0;
+	}
+	const int* base = v;
+	while (n > 1) {
+		int metade = n / 2;
+		base += (base[metade - 1] < item) * metade;
+		n -= metade;
+	}
+	return (int) (base - v) + (*base < item);
+}
+
+/*
+ * Limite inferior por busca binária no vetor da lista. No modo lacuna, os elementos ficam em dois
+ * trechos contíguos (antes e depois do espaço livre), e o segundo só é consultado se todos os
+ * elementos do primeiro forem menores que "item".
+ */
+static int limite_inferior_binario(ListaVet* lista, int item) {
+	int pos = contar_menores(lista->itens, lista->lacuna, item);
+	if (pos < lista->lacuna) {
+		return pos;
+	}
+	return pos + contar_menores(lista->itens + lista->lacuna + tamanho_lacuna(lista),
+		lista->ultimo - lista->lacuna, item);
+}
+
+/*
+ * Preenche a subárvore de raiz "k" do índice com os elementos a partir da posição "*pos", em ordem
+ * simétrica: no leiaute de Eytzinger, os filhos do nó k ficam nas posições 2k e 2k + 1.
+ */
+static void preencher_eytzinger(ListaVet* lista, int k, int* pos) {
+	if (k <= lista->ultimo) {
+		preencher_eytzinger(lista, 2 * k, pos);
+		lista->eytz_valores[k] = lista->itens[indice(lista, *pos)];
+		lista->eytz_posicoes[k] = *pos;
+		(*pos)++;
+		preencher_eytzinger(lista, 2 * k + 1, pos);
+	}
+}
+
+static void construir_eytzinger(ListaVet* lista) {
+	delete[] lista->eytz_valores;
+	delete[] lista->eytz_posicoes;
+	lista->eytz_valores = new int[lista->ultimo + 1];
+	lista->eytz_posicoes = new int[lista->ultimo + 1];
+
+	int pos = 0;
+	preencher_eytzinger(lista, 1, &pos);
+	lista->eytz_atualizado = true;
+}
+
+/*
+ * Limite inferior pelo índice de Eytzinger. A busca desce da raiz (k = 1) sem desvios. Os 16
+ * descendentes do nó k quatro níveis abaixo ocupam as posições [16k, 16k + 15], ou seja, 64 bytes
+ * consecutivos, e a busca já pede ao processador que os traga para a cache, enquanto desce os
+ * quatro níveis. O endereço é calculado com inteiros porque pode estar após o fim do vetor; nesse
+ * caso, o pedido é apenas ignorado.
+ */
+static int limite_inferior_eytzinger(ListaVet* lista, int item) {
+	const int* valores = lista->eytz_valores;
+	int n = lista->ultimo;
+	int k = 1;
+	while (k <= n) {
+#if defined(__GNUC__)
+		__builtin_prefetch((const void*) ((uintptr_t) valores + 16 * sizeof(int) * (uintptr_t) k));
+#endif
+		k = 2 * k + (valores[k] < item);
+	}
+
+	/*
+	 * O limite inferior é o último nó onde a busca desceu para a esquerda: basta desfazer as
+	 * descidas para a direita (os bits 1 do final de k) e mais uma. Se k zerar, a busca só desceu
+	 * para a direita e todos os elementos são menores que "item".
+	 */
+#if defined(__GNUC__)
+	k >>= __builtin_ffs(~k);
+#else
+	while (k & 1) {
+		k >>= 1;
+	}
+	k >>= 1;
+#endif
+	return (k == 0) ? n : lista->eytz_posicoes[k];
+}
+
+/* Limite inferior pelo índice de Eytzinger, se ele estiver ativado, ou pela busca binária. */
+static int localizar_limite(ListaVet* lista, int item) {
+	ESTATISTICA(contar_consulta(&lista->estat));
+	if (lista->eytz_ativado) {
+		if (!lista->eytz_atualizado) {
+			construir_eytzinger(lista);
+		}
+		return limite_inferior_eytzinger(lista, item);
+	}
+	return limite_inferior_binario(lista, item);
+}
+
+int inserir_ordenado(ListaVet* lista, int item) {
+	assert(lista != NULL);
+	assert(!estah_cheia(lista));
+
+	/*
+	 * O novo elemento entra após os iguais a ele. Como os elementos são inteiros, o limite
+	 * superior de "item" é o limite inferior de item + 1. A inserção desatualiza o índice de
+	 * Eytzinger e, por isso, a posição é sempre obtida pela busca binária.
+	 */
+	int pos = (item == INT_MAX) ? lista->ultimo : limite_inferior_binario(lista, item + 1);
+	inserir(lista, item, pos);
+	return pos;
+}
+
+bool remover_valor(ListaVet* lista, int item) {
+	assert(lista != NULL);
+
+	int pos = limite_inferior_binario(lista, item);
+	if ((pos == lista->ultimo) || (lista->itens[indice(lista, pos)] != item)) {
+		return false;
+	}
+	remover(lista, pos);
+	return true;
+}
+
+int buscar(ListaVet* lista, int item) {
+	assert(lista != NULL);
+
+	int pos = localizar_limite(lista, item);
+	if ((pos == lista->ultimo) || (lista->itens[indice(lista, pos)] != item)) {
+		return -1;
+	}
+	return pos;
+}
+
+bool contem(ListaVet* lista, int item) {
+	return (buscar(lista, item) != -1);
+}
+
+int limite_inferior(ListaVet* lista, int item) {
+	assert(lista != NULL);
+
+	return localizar_limite(lista, item);
+}
+
+int limite_superior(ListaVet* lista, int item) {
+	assert(lista != NULL);
+
+	return (item == INT_MAX) ? lista->ultimo : localizar_limite(lista, item + 1);
+}
+
+void definir_indice_eytzinger(ListaVet* lista, bool ativado) {
+	assert(lista != NULL);
+
+	/* O índice é construído na primeira busca após a ativação ou após uma alteração da lista. */
+	if (!ativado) {
+		delete[] lista->eytz_valores;
+		delete[] lista->eytz_posicoes;
+		lista->eytz_valores = NULL;
+		lista->eytz_posicoes = NULL;
+		lista->eytz_atualizado = false;
+	}
+	lista->eytz_ativado = ativado;
+}
+
+void ordenar(ListaVet* lista) {
+	ordenar_paralelo(lista, 1);
+}
+
+void ordenar_paralelo(ListaVet* lista, int qtd_threads) {
+	assert(lista != NULL);
+
+	/* No modo lacuna, o espaço livre vai para o final, para que os elementos fiquem em um só trecho. */
+	mover_lacuna(lista, lista->ultimo);
+	ordenar_vetor(lista->itens, lista->ultimo, qtd_threads);
+	lista->eytz_atualizado = false;
+}
+
+/*
+ * Retorna os elementos da lista em dois trechos: os do início do vetor e os que ficam após o espaço
+ * livre (nenhum, fora do modo lacuna).
+ */
+static Trechos trechos(ListaVet* lista) {
+	Trechos t = {lista->itens, lista->lacuna, lista->itens + lista->lacuna + tamanho_lacuna(lista),
+		lista->ultimo - lista->lacuna};
+	return t;
+}
+
+int buscar_primeiro(ListaVet* lista, int item) {
+	assert(lista != NULL);
+
+	ESTATISTICA(contar_consulta(&lista->estat));
+	return varrer_primeiro(trechos(lista), item);
+}
+
+int contar_ocorrencias(ListaVet* lista, int item) {
+	assert(lista != NULL);
+
+	ESTATISTICA(contar_consulta(&lista->estat));
+	return varrer_ocorrencias(trechos(lista), item);
+}
+
+long long somar(ListaVet* lista) {
+	assert(lista != NULL);
+
+	ESTATISTICA(contar_consulta(&lista->estat));
+	return varrer_soma(trechos(lista));
+}
+
+int minimo(ListaVet* lista) {
+	assert(lista != NULL);
+	assert(!estah_vazia(lista));
+
+	ESTATISTICA(contar_consulta(&lista->estat));
+	return varrer_minimo(trechos(lista));
+}
+
+int maximo(ListaVet* lista) {
+	assert(lista != NULL);
+	assert(!estah_vazia(lista));
+
+	ESTATISTICA(contar_consulta(&lista->estat));
+	return varrer_maximo(trechos(lista));
+}
+
+int filtrar(ListaVet* lista, int menor, int maior, int* saida) {
+	assert((lista != NULL) && (saida != NULL));
+	assert(menor <= maior);
+
+	ESTATISTICA(contar_consulta(&lista->estat));
+	return varrer_filtro(trechos(lista), menor, maior, saida);
+}
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+const Estatisticas* obter_estatisticas(ListaVet* lista) {
+	assert(lista != NULL);
+
+	return &lista->estat;
+}
+#endif
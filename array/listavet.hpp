@@ -10,12 +10,31 @@
 #ifndef LISTAVET_HPP
 #define LISTAVET_HPP
 
+#include "../comum/estatisticas.hpp"
+
 /**
- * \def TAM_MAX 
+ * \def TAM_MAX_LISTAVET
  * \brief Define a quantidade máxima de elementos suportada pela lista.
+ *
+ * Pode ser redefinida na compilação (por exemplo, com -DTAM_MAX_LISTAVET=1024).
  * \hideinitializer
  */
-#define TAM_MAX 100 
+#ifndef TAM_MAX_LISTAVET
+#define TAM_MAX_LISTAVET 100
+#endif
+
+/**
+ * \def TAM_MAX
+ * \brief Nome antigo de TAM_MAX_LISTAVET, mantido por compatibilidade.
+ *
+ * Como todos os cabeçalhos de array/ definiam TAM_MAX, incluir dois deles no mesmo arquivo
+ * redefinia a macro. Agora, ela só é definida pelo primeiro cabeçalho incluído e, por isso,
+ * pode não corresponder a esta lista: prefira TAM_MAX_LISTAVET.
+ * \hideinitializer
+ */
+#ifndef TAM_MAX
+#define TAM_MAX TAM_MAX_LISTAVET
+#endif
 
 /** 
  * \struct ListaVet
@@ -340,5 +359,476 @@ int obter(ListaVet* li, int pos);
  */
 int obter_tamanho(ListaVet* li);
 
+/** 
+ * \brief Insere, de uma só vez, os elementos do intervalo [primeiro, ultimo) a partir da posição \p pos.
+ * 
+ * Após a operação, *primeiro ocupa a posição \p pos, *(primeiro + 1) a posição pos + 1 e assim por
+ * diante. Os elementos que estavam a partir de \p pos são deslocados com uma única chamada a
+ * memmove, em vez de um deslocamento por elemento inserido.
+ * 
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include "listavet.hpp"
+ * 
+ * using namespace std;
+ *
+ * int main() {
+ *     ListaVet *li = criar_lista();
+ *     int v[] = {2, 3, 4};
+ *     inserir(li, 1, 0);
+ *     inserir(li, 5, 1);
+ *     inserir_intervalo(li, 1, v, v + 3);
+ *     remover_intervalo(li, 0, 2, NULL);
+ *     for (int i = 0; i < obter_tamanho(li); i++) {
+ *         cout << obter(li, i) << " ";
+ *     }
+ *     cout << endl;
+ *     liberar_lista(li);
+ *     return EXIT_SUCCESS;
+ * }  
+ * \endcode
+ * 
+ * Saída esperada:
+ * \code {.unparsed}
+ *     3 4 5
+ * \endcode
+ * 
+ * \pre Os ponteiros \p *li, \p *primeiro e \p *ultimo devem ser diferentes de \p NULL, com primeiro <= ultimo.
+ * \pre A lista deve ter espaço para mais TAM elementos, onde TAM = ultimo - primeiro.
+ * \pre A posição \p pos deve estar no intervalo [0, tamanho_da_lista].
+ * 
+ * \param *li representa um ponteiro para a lista.
+ * \param pos representa a posição onde o primeiro elemento do intervalo será inserido.
+ * \param *primeiro representa o endereço do primeiro elemento a ser inserido.
+ * \param *ultimo representa o endereço seguinte ao último elemento a ser inserido.
+ * 
+ * \return void
+ * 
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL,
+ * 			caso não haja espaço para os elementos
+ * 			ou caso a posição informada seja inválida.
+ */
+void inserir_intervalo(ListaVet* li, int pos, const int* primeiro, const int* ultimo);
+
+/** 
+ * \brief Remove, de uma só vez, os \p n elementos a partir da posição \p pos.
+ * 
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre O intervalo [pos, pos + n - 1] deve estar contido em [0, tamanho_da_lista - 1].
+ * 
+ * \param *li representa um ponteiro para a lista.
+ * \param pos representa a posição do primeiro elemento a ser removido.
+ * \param n representa a quantidade de elementos a serem removidos.
+ * \param *saida representa o vetor, com pelo menos \p n posições, que receberá os elementos removidos,
+ * 		  na ordem em que estavam na lista. Se for \p NULL, os elementos são apenas descartados.
+ * 
+ * \return void
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL ou
+ * 			caso o intervalo seja inválido.
+ */
+void remover_intervalo(ListaVet* li, int pos, int n, int* saida);
+
+/** 
+ * \brief Ativa ou desativa o modo lacuna (gap buffer) da lista.
+ * 
+ * Normalmente, o espaço livre do vetor fica no final da lista, e cada inserção ou remoção na posição
+ * \p pos desloca todos os elementos seguintes (com memmove). No modo lacuna, o espaço livre "flutua"
+ * até a posição da última edição: cada inserção ou remoção desloca apenas os elementos entre a
+ * posição editada anteriormente e a atual. Assim, uma sequência de edições na mesma região, como a
+ * digitação em um editor de texto, custa O(1) por edição, qualquer que seja o tamanho da lista.
+ * 
+ * As demais operações não mudam: obter(li, pos) continua O(1), ao custo de uma comparação a mais.
+ * Ao desativar o modo, o espaço livre é levado de volta ao final do vetor, em O(n).
+ * 
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include "listavet.hpp"
+ * 
+ * using namespace std;
+ *
+ * int main() {
+ *     ListaVet *li = criar_lista();
+ *     definir_modo_lacuna(li, true);
+ *     inserir(li, 1, 0);
+ *     inserir(li, 4, 1);
+ *     inserir(li, 2, 1);
+ *     inserir(li, 3, 2);
+ *     for (int i = 0; i < obter_tamanho(li); i++) {
+ *         cout << obter(li, i) << " ";
+ *     }
+ *     cout << endl;
+ *     liberar_lista(li);
+ *     return EXIT_SUCCESS;
+ * }  
+ * \endcode
+ * 
+ * Saída esperada:
+ * \code {.unparsed}
+ *     1 2 3 4
+ * \endcode
+ * 
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * 
+ * \param *li representa um ponteiro para a lista.
+ * \param ativado indica se o modo lacuna deve ser ativado (\p true) ou desativado (\p false).
+ * 
+ * \return void
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+void definir_modo_lacuna(ListaVet* li, bool ativado);
+
+/** 
+ * \brief Insere um elemento em uma lista ordenada, mantendo-a ordenada.
+ * 
+ * As funções inserir_ordenado, remover_valor, buscar, contem, limite_inferior e limite_superior
+ * tratam a lista como um conjunto ordenado: os elementos devem estar em ordem não decrescente, como
+ * ficam quando são inseridos apenas por esta função. A posição do novo elemento é encontrada por
+ * busca binária, em O(log n), e o elemento é inserido após os iguais a ele. A inserção ainda desloca
+ * os elementos seguintes, como em \p inserir (ou os elementos até a edição anterior, no modo lacuna).
+ * 
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include "listavet.hpp"
+ * 
+ * using namespace std;
+ *
+ * int main() {
+ *     ListaVet *li = criar_lista();
+ *     int v[] = {5, 1, 4, 1, 3};
+ *     for (int i = 0; i < 5; i++) {
+ *         inserir_ordenado(li, v[i]);
+ *     }
+ *     for (int i = 0; i < obter_tamanho(li); i++) {
+ *         cout << obter(li, i) << " ";
+ *     }
+ *     cout << endl << buscar(li, 4) << " " << buscar(li, 2) << endl;
+ *     cout << limite_inferior(li, 1) << " " << limite_superior(li, 1) << endl;
+ *     remover_valor(li, 1);
+ *     cout << contem(li, 1) << " " << obter_tamanho(li) << endl;
+ *     liberar_lista(li);
+ *     return EXIT_SUCCESS;
+ * }  
+ * \endcode
+ * 
+ * Saída esperada:
+ * \code {.unparsed}
+ *     1 1 3 4 5
+ *     3 -1
+ *     0 2
+ *     1 4
+ * \endcode
+ * 
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre A lista não deve estar cheia.
+ * \pre Os elementos da lista devem estar em ordem não decrescente.
+ * 
+ * \param *li representa um ponteiro para a lista.
+ * \param item representa o item a ser inserido na lista.
+ * 
+ * \return A posição onde o elemento foi inserido.
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL ou caso a lista
+ * 			esteja cheia. Se a lista não estiver ordenada, a posição escolhida é imprevisível.
+ */
+int inserir_ordenado(ListaVet* li, int item);
+
+/** 
+ * \brief Remove de uma lista ordenada a primeira ocorrência de um elemento, se houver.
+ * 
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre Os elementos da lista devem estar em ordem não decrescente.
+ * 
+ * \param *li representa um ponteiro para a lista.
+ * \param item representa o item a ser removido.
+ * 
+ * \return \p true, se o elemento foi encontrado e removido, ou \p false, caso contrário.
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+bool remover_valor(ListaVet* li, int item);
+
+/** 
+ * \brief Retorna a posição da primeira ocorrência de um elemento em uma lista ordenada.
+ * 
+ * A busca é binária e sem desvios condicionais (O(log n)) ou, se o índice estiver ativado, feita no
+ * índice de Eytzinger (veja \p definir_indice_eytzinger).
+ * 
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre Os elementos da lista devem estar em ordem não decrescente.
+ * 
+ * \param *li representa um ponteiro para a lista.
+ * \param item representa o item procurado.
+ * 
+ * \return A posição da primeira ocorrência de \p item ou -1, se ele não estiver na lista.
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+int buscar(ListaVet* li, int item);
+
+/** 
+ * \brief Indica se um elemento está em uma lista ordenada.
+ * 
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre Os elementos da lista devem estar em ordem não decrescente.
+ * 
+ * \param *li representa um ponteiro para a lista.
+ * \param item representa o item procurado.
+ * 
+ * \return \p true, se \p item estiver na lista, ou \p false, caso contrário.
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+bool contem(ListaVet* li, int item);
+
+/** 
+ * \brief Retorna a primeira posição de uma lista ordenada cujo elemento não é menor que \p item.
+ * 
+ * Equivale a std::lower_bound: é a posição onde \p item seria inserido antes dos iguais a ele.
+ * 
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre Os elementos da lista devem estar em ordem não decrescente.
+ * 
+ * \param *li representa um ponteiro para a lista.
+ * \param item representa o item procurado.
+ * 
+ * \return Uma posição no intervalo [0, tamanho_da_lista].
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+int limite_inferior(ListaVet* li, int item);
+
+/** 
+ * \brief Retorna a primeira posição de uma lista ordenada cujo elemento é maior que \p item.
+ * 
+ * Equivale a std::upper_bound: é a posição onde \p item seria inserido após os iguais a ele.
+ * 
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre Os elementos da lista devem estar em ordem não decrescente.
+ * 
+ * \param *li representa um ponteiro para a lista.
+ * \param item representa o item procurado.
+ * 
+ * \return Uma posição no intervalo [0, tamanho_da_lista].
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+int limite_superior(ListaVet* li, int item);
+
+/** 
+ * \brief Ativa ou desativa o índice de Eytzinger usado pelas buscas na lista ordenada.
+ * 
+ * Na busca binária, os primeiros passos consultam elementos distantes entre si, e cada um deles
+ * costuma custar uma falta de cache quando a lista é grande. O índice guarda uma cópia dos elementos
+ * no leiaute de Eytzinger (o de um heap binário: a raiz na posição 1 e os filhos do nó k nas
+ * posições 2k e 2k + 1), em que os nós visitados nos primeiros passos ficam próximos e os dos
+ * passos seguintes podem ser trazidos para a cache antes de serem necessários. As funções buscar,
+ * contem, limite_inferior e limite_superior passam a usar o índice.
+ * 
+ * O índice ocupa mais 8 bytes por elemento e é reconstruído, em O(n), na primeira busca após
+ * qualquer alteração da lista. Por isso, compensa em listas grandes com muitas buscas entre as
+ * alterações. As funções inserir_ordenado e remover_valor não usam o índice.
+ * 
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * 
+ * \param *li representa um ponteiro para a lista.
+ * \param ativado indica se o índice deve ser usado (\p true) ou descartado (\p false).
+ * 
+ * \return void
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+void definir_indice_eytzinger(ListaVet* li, bool ativado);
+
+/** 
+ * \brief Coloca os elementos da lista em ordem não decrescente, no próprio vetor da lista.
+ * 
+ * Listas com pelo menos LIMIAR_RADIX elementos são ordenadas pelo radix sort MSD, que distribui os
+ * elementos em baldes byte a byte trocando-os de lugar dentro do vetor, e as menores pelo introsort
+ * (veja ordenacao.hpp). Nenhuma das duas aloca memória. Listas já ordenadas ou em ordem estritamente
+ * decrescente são reconhecidas e resolvidas em O(n). Depois da ordenação, a lista pode ser usada
+ * com inserir_ordenado, buscar e as demais funções da lista ordenada.
+ * 
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include "listavet.hpp"
+ * 
+ * using namespace std;
+ *
+ * int main() {
+ *     ListaVet *li = criar_lista();
+ *     int v[] = {5, -1, 4, 1, 3};
+ *     inserir_intervalo(li, 0, v, v + 5);
+ *     ordenar(li);
+ *     for (int i = 0; i < obter_tamanho(li); i++) {
+ *         cout << obter(li, i) << " ";
+ *     }
+ *     cout << endl << buscar(li, 4) << endl;
+ *     liberar_lista(li);
+ *     return EXIT_SUCCESS;
+ * }  
+ * \endcode
+ * 
+ * Saída esperada:
+ * \code {.unparsed}
+ *     -1 1 3 4 5
+ *     3
+ * \endcode
+ * 
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * 
+ * \param *li representa um ponteiro para a lista.
+ * 
+ * \return void
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+void ordenar(ListaVet* li);
+
+/** 
+ * \brief Faz o mesmo que \p ordenar, usando até \p qtd_threads threads.
+ * 
+ * A primeira distribuição do radix sort é feita pela thread que chamou a função; em seguida, os
+ * baldes, que não dependem uns dos outros, são ordenados pelas threads ao mesmo tempo. Como cada
+ * elemento já está no seu balde, não é preciso intercalar os resultados.
+ * 
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * 
+ * \param *li representa um ponteiro para a lista.
+ * \param qtd_threads representa a quantidade máxima de threads (1 ou menos: o mesmo que \p ordenar).
+ * 
+ * \return void
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+void ordenar_paralelo(ListaVet* li, int qtd_threads);
+
+/** 
+ * \brief Retorna a posição da primeira ocorrência de \p item na lista, percorrendo-a do início.
+ * 
+ * Ao contrário de buscar, não exige que os elementos estejam em ordem. Esta e as demais consultas
+ * em bloco (contar_ocorrencias, somar, minimo, maximo e filtrar) leem os elementos direto do
+ * vetor, em até dois trechos no modo lacuna, em vez de chamar obter para cada posição, e usam
+ * instruções SIMD (AVX2 ou AVX-512) quando o processador as suporta (veja varredura.hpp).
+ * 
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * 
+ * \param *li representa um ponteiro para a lista.
+ * \param item representa o item procurado.
+ * 
+ * \return A posição de \p item ou -1, se ele não estiver na lista.
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+int buscar_primeiro(ListaVet* li, int item);
+
+/** 
+ * \brief Retorna a quantidade de ocorrências de \p item na lista.
+ * 
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * 
+ * \param *li representa um ponteiro para a lista.
+ * \param item representa o item procurado.
+ * 
+ * \return A quantidade de elementos iguais a \p item.
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+int contar_ocorrencias(ListaVet* li, int item);
+
+/** 
+ * \brief Retorna a soma dos elementos da lista.
+ * 
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * 
+ * \param *li representa um ponteiro para a lista.
+ * 
+ * \return A soma dos elementos (0, se a lista estiver vazia), calculada em 64 bits, sem estouro.
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+long long somar(ListaVet* li);
+
+/** 
+ * \brief Retorna o menor elemento da lista.
+ * 
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre A lista não pode estar vazia.
+ * 
+ * \param *li representa um ponteiro para a lista.
+ * 
+ * \return O menor elemento.
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL ou
+ * 			caso a lista esteja vazia.
+ */
+int minimo(ListaVet* li);
+
+/** 
+ * \brief Retorna o maior elemento da lista.
+ * 
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre A lista não pode estar vazia.
+ * 
+ * \param *li representa um ponteiro para a lista.
+ * 
+ * \return O maior elemento.
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL ou
+ * 			caso a lista esteja vazia.
+ */
+int maximo(ListaVet* li);
+
+/** 
+ * \brief Copia para \p saida, na ordem da lista, os elementos do intervalo [menor, maior].
+ * 
+ * \code {.cpp}
+ *     int saida[TAM_MAX_LISTAVET];
+ *     int n = filtrar(li, 10, 20, saida); // saida[0, n) contém os elementos x com 10 <= x <= 20
+ * \endcode
+ * 
+ * \pre Os ponteiros \p *li e \p *saida devem ser diferentes de \p NULL.
+ * \pre menor <= maior.
+ * 
+ * \param *li representa um ponteiro para a lista.
+ * \param menor representa o menor valor aceito.
+ * \param maior representa o maior valor aceito.
+ * \param *saida representa o vetor que receberá os elementos. Ele deve ter uma posição para cada
+ * 		elemento da lista, mesmo que poucos sejam copiados: as posições após os copiados podem
+ * 		ser sobrescritas.
+ * 
+ * \return A quantidade de elementos copiados.
+ * 
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL ou
+ * 			caso menor > maior.
+ */
+int filtrar(ListaVet* li, int menor, int maior, int* saida);
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+/**
+ * \brief Retorna os contadores de uso da lista.
+ *
+ * Disponível apenas quando a macro ESTRUTURAS_ESTATISTICAS é definida na compilação. Os contadores
+ * continuam sendo atualizados pelas operações seguintes; veja o arquivo estatisticas.hpp.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista.
+ *
+ * \return O endereço dos contadores da lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+const Estatisticas* obter_estatisticas(ListaVet* li);
+#endif
 
 #endif
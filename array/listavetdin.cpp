@@ -0,0 +1,244 @@
+#include <assert.h> /**< Necessário para uso da macro "assert". */
+#include <climits> /**< Necessário para uso do INT_MAX. */
+#include <cstdio> /**< Necessário para uso de fprintf. */
+#include <cstdlib> /**< Necessário para uso do NULL e de abort. */
+#include <cstring> /**< Necessário para uso das funções "memcpy" e "memmove". */
+#include "listavetdin.hpp"
+
+using namespace std;
+
+struct ListaVetDin {
+	int* itens; /**< Arranjo alocado dinamicamente que armazena os elementos da lista. */
+	int ultimo; /**< Variável que indica a próxima posição vazia da lista. */
+	int capacidade; /**< Quantidade de posições alocadas no arranjo "itens". */
+	bool encolher_auto; /**< Indica se o arranjo deve encolher automaticamente nas remoções. */
+#ifdef ESTRUTURAS_ESTATISTICAS
+	Estatisticas estat; /**< Contadores de uso (veja estatisticas.hpp). */
+#endif
+};
+
+/*
+ * Realoca o arranjo da lista para que ele tenha exatamente "capacidade" posições,
+ * copiando os elementos atuais para o novo arranjo.
+ * A palavra-chave "static" na assinatura desta função garante que ela só estará disponível
+ * para uso dentro deste arquivo.
+ */
+static void realocar(ListaVetDin* lista, int capacidade) {
+	assert(capacidade >= lista->ultimo);
+
+	int* novos_itens = NULL;
+	if (capacidade > 0) {
+		novos_itens = new int[capacidade];
+		ESTATISTICA(contar_alocacoes(&lista->estat, 1));
+		if (lista->ultimo > 0) {
+			memcpy(novos_itens, lista->itens, lista->ultimo * sizeof(int));
+		}
+	}
+	delete[] lista->itens;
+
+	lista->itens = novos_itens;
+	lista->capacidade = capacidade;
+}
+
+/*
+ * Retorna a capacidade para a qual o arranjo deve crescer para guardar pelo menos "minimo"
+ * elementos: o dobro da capacidade atual, limitado a INT_MAX, ou o próprio "minimo", se maior.
+ * Como os índices são do tipo int, a lista não pode ter mais de INT_MAX elementos; a verificação
+ * não usa assert para que o programa não continue com a capacidade errada quando NDEBUG é definida.
+ */
+static int calcular_capacidade(ListaVetDin* lista, long long minimo) {
+	if (minimo > INT_MAX) {
+		fprintf(stderr, "ListaVetDin: a lista não pode ter mais de %d elementos\n", INT_MAX);
+		abort();
+	}
+
+	long long capacidade = (lista->capacidade == 0) ? CAPACIDADE_INICIAL_DIN : 2LL * lista->capacidade;
+	if (capacidade > INT_MAX) {
+		capacidade = INT_MAX;
+	}
+	if (capacidade < minimo) {
+		capacidade = minimo;
+	}
+	return (int) capacidade;
+}
+
+ListaVetDin* criar_lista_din() {
+	/*
+	 * Caso não seja possível alocar o espaço solicitado, o próprio operador "new"
+	 * irá lançar uma exceção abortando a execução do programa.
+	 */
+	ListaVetDin* lista = new ListaVetDin;
+
+	lista->itens = NULL;
+	lista->ultimo = 0;
+	lista->capacidade = 0;
+	lista->encolher_auto = false;
+	ESTATISTICA(zerar_estatisticas(&lista->estat));
+	return lista;
+}
+
+void liberar_lista(ListaVetDin* lista) {
+	/*
+	 * Macro da biblioteca \file assert.h. Aborta a execução do programa e envia uma mensagem
+	 * de erro para a saída de erro padrão, caso a expressão entre parênteses seja avaliada
+	 * como false.
+	 */
+	assert(lista != NULL);
+
+	delete[] lista->itens;
+	delete lista;
+}
+
+bool estah_vazia(ListaVetDin* lista) {
+	assert(lista != NULL);
+
+	return (lista->ultimo == 0);
+}
+
+void inserir(ListaVetDin* lista, int item, int pos) {
+	assert(lista != NULL);
+
+	/* Garante que a posição passada por parâmetro seja válida. */
+	assert((pos >= 0) && (pos <= lista->ultimo));
+
+	/* Crescimento geométrico: dobrar a capacidade garante custo O(1) amortizado por inserção. */
+	if (lista->ultimo == lista->capacidade) {
+		realocar(lista, calcular_capacidade(lista, lista->ultimo + 1LL));
+	}
+
+	/* Desloca os elementos da lista uma posição para a direita, com uma única cópia de bloco. */
+	memmove(lista->itens + pos + 1, lista->itens + pos, (lista->ultimo - pos) * sizeof(int));
+	ESTATISTICA(contar_deslocamento(&lista->estat, lista->ultimo - pos, sizeof(int)));
+
+	lista->itens[pos] = item;
+	lista->ultimo++;
+	ESTATISTICA(contar_insercoes(&lista->estat, 1));
+}
+
+int remover(ListaVetDin* lista, int pos) {
+	assert(lista != NULL);
+	assert(!estah_vazia(lista));
+
+	/* Garante que a posição passada por parâmetro seja válida. */
+	assert((pos >= 0) && (pos < lista->ultimo));
+
+	int item = lista->itens[pos];
+
+	/* Desloca os elementos da lista uma posição para a esquerda, com uma única cópia de bloco. */
+	memmove(lista->itens + pos, lista->itens + pos + 1, (lista->ultimo - pos - 1) * sizeof(int));
+	ESTATISTICA(contar_deslocamento(&lista->estat, lista->ultimo - pos - 1, sizeof(int)));
+
+	lista->ultimo--;
+	ESTATISTICA(contar_remocoes(&lista->estat, 1));
+
+	/*
+	 * Histerese: o arranjo só encolhe quando fica com 1/4 de ocupação e, mesmo assim,
+	 * apenas para a metade. Logo após encolher, a lista fica com 1/2 de ocupação e
+	 * precisa de muitas operações para atingir novamente qualquer um dos limiares.
+	 */
+	if (lista->encolher_auto && (lista->capacidade > CAPACIDADE_INICIAL_DIN) &&
+		(lista->ultimo <= lista->capacidade / 4)) {
+		realocar(lista, lista->capacidade / 2);
+	}
+
+	return item;
+}
+
+int obter(ListaVetDin* lista, int pos) {
+	assert(lista != NULL);
+	assert(!estah_vazia(lista));
+
+	/* Garante que a posição passada por parâmetro seja válida. */
+	assert((pos >= 0) && (pos < lista->ultimo));
+
+	ESTATISTICA(contar_consulta(&lista->estat));
+	return lista->itens[pos];
+}
+
+int obter_tamanho(ListaVetDin* lista) {
+	assert(lista != NULL);
+
+	return lista->ultimo;
+}
+
+int obter_capacidade(ListaVetDin* lista) {
+	assert(lista != NULL);
+
+	return lista->capacidade;
+}
+
+void reservar(ListaVetDin* lista, int capacidade) {
+	assert(lista != NULL);
+	assert(capacidade >= 0);
+
+	if (capacidade > lista->capacidade) {
+		realocar(lista, capacidade);
+	}
+}
+
+void encolher(ListaVetDin* lista) {
+	assert(lista != NULL);
+
+	if (lista->capacidade > lista->ultimo) {
+		realocar(lista, lista->ultimo);
+	}
+}
+
+void definir_encolhimento_automatico(ListaVetDin* lista, bool ativado) {
+	assert(lista != NULL);
+
+	lista->encolher_auto = ativado;
+}
+
+void inserir_intervalo(ListaVetDin* lista, int pos, const int* primeiro, const int* ultimo) {
+	assert((lista != NULL) && (primeiro != NULL) && (ultimo != NULL));
+	assert(primeiro <= ultimo);
+
+	/* Garante que a posição passada por parâmetro seja válida. */
+	assert((pos >= 0) && (pos <= lista->ultimo));
+
+	/* Cresce uma única vez, o suficiente para todo o bloco (mantendo o crescimento geométrico). */
+	long long total = lista->ultimo + (long long) (ultimo - primeiro);
+	if (total > lista->capacidade) {
+		realocar(lista, calcular_capacidade(lista, total));
+	}
+	int n = (int) (ultimo - primeiro);
+
+	/* Desloca o final da lista "n" posições para a direita, com uma única cópia de bloco. */
+	memmove(lista->itens + pos + n, lista->itens + pos, (lista->ultimo - pos) * sizeof(int));
+	ESTATISTICA(contar_deslocamento(&lista->estat, lista->ultimo - pos, sizeof(int)));
+	memcpy(lista->itens + pos, primeiro, n * sizeof(int));
+	lista->ultimo += n;
+	ESTATISTICA(contar_insercoes(&lista->estat, n));
+}
+
+void remover_intervalo(ListaVetDin* lista, int pos, int n, int* saida) {
+	assert(lista != NULL);
+
+	/* Garante que o intervalo [pos, pos + n - 1] esteja dentro da lista. */
+	assert((pos >= 0) && (n >= 0) && (pos + n <= lista->ultimo));
+
+	if (saida != NULL) {
+		memcpy(saida, lista->itens + pos, n * sizeof(int));
+	}
+
+	/* Desloca o final da lista "n" posições para a esquerda, com uma única cópia de bloco. */
+	memmove(lista->itens + pos, lista->itens + pos + n, (lista->ultimo - pos - n) * sizeof(int));
+	ESTATISTICA(contar_deslocamento(&lista->estat, lista->ultimo - pos - n, sizeof(int)));
+	lista->ultimo -= n;
+	ESTATISTICA(contar_remocoes(&lista->estat, n));
+
+	/* Mesma histerese de remover. */
+	if (lista->encolher_auto && (lista->capacidade > CAPACIDADE_INICIAL_DIN) &&
+		(lista->ultimo <= lista->capacidade / 4)) {
+		realocar(lista, lista->capacidade / 2);
+	}
+}
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+const Estatisticas* obter_estatisticas(ListaVetDin* lista) {
+	assert(lista != NULL);
+
+	return &lista->estat;
+}
+#endif
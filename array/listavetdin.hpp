@@ -0,0 +1,371 @@
+/**
+ * \file listavetdin.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Interface do TAD ListaVetDin
+ *
+ * Disponibiliza as funções necessárias para manipulação da estrutura de dados Lista,
+ * implementada com um arranjo que cresce (e, opcionalmente, encolhe) conforme a necessidade.
+ * Diferentemente da ListaVet, não existe o limite TAM_MAX: a capacidade do arranjo é dobrada
+ * sempre que ele fica cheio, de modo que a inserção no final da lista tem custo O(1) amortizado.
+ * O único limite é o do tipo dos índices: a lista pode ter até INT_MAX elementos.
+ */
+
+#ifndef LISTAVETDIN_HPP
+#define LISTAVETDIN_HPP
+
+#include "../comum/estatisticas.hpp"
+
+/**
+ * \def CAPACIDADE_INICIAL_DIN
+ * \brief Define a capacidade do arranjo alocado na primeira inserção da lista.
+ * \hideinitializer
+ */
+#define CAPACIDADE_INICIAL_DIN 16
+
+/**
+ * \struct ListaVetDin
+ * \brief Declaração opaca da estrutura da lista.
+ *
+ * Isso significa que os detalhes de implementação desta estrutura estão escondidos do usuário do TAD.
+ * A definição da estrutura ListaVetDin encontra-se no arquivo \file listavetdin.cpp.
+ */
+struct ListaVetDin;
+
+/**
+ * \brief Cria dinamicamente uma lista vazia e retorna o endereço onde ela se encontra alocada.
+ *
+ * A lista é criada sem nenhum espaço reservado para os elementos. O arranjo só é alocado
+ * na primeira inserção (ou na primeira chamada a \p reservar).
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include "listavetdin.hpp"
+
+ * int main() {
+ *     ListaVetDin *li = criar_lista_din();
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * \return O endereço de memória da lista alocada dinamicamente.
+ */
+ListaVetDin* criar_lista_din();
+
+/**
+ * \brief Libera o espaço de memória anteriormente reservado para a lista e para os seus elementos.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include "listavetdin.hpp"
+ *
+ * int main() {
+ *     ListaVetDin *li = criar_lista_din();
+ *     liberar_lista(li);
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista a ser liberada da memória.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+void liberar_lista(ListaVetDin* li);
+
+/**
+ * \brief Verifica se a lista está vazia.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista cuja situação será consultada.
+ *
+ * \return \p true, se a lista estiver vazia e \p false, caso contrário.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+*/
+bool estah_vazia(ListaVetDin* li);
+
+/**
+ * \brief Insere um novo elemento na lista.
+ *
+ * Funciona como a função \p inserir da ListaVet: a posição informada deve estar no intervalo
+ * [0, tamanho_da_lista]. Caso o arranjo esteja cheio, sua capacidade é dobrada antes da inserção.
+ * Assim, inserções no final da lista (posição "tamanho_da_lista") custam O(1) amortizado.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include "listavetdin.hpp"
+ *
+ * using namespace std;
+ *
+ * int main() {
+ *     ListaVetDin *li = criar_lista_din();
+ *     for (int i = 0; i < 1000; i++) {
+ *         inserir(li, i, obter_tamanho(li));
+ *     }
+ *     cout << obter_tamanho(li) << endl;
+ *     liberar_lista(li);
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * Saída esperada:
+ * \code {.unparsed}
+ * 		1000
+ * \endcode
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre A posição \p pos deve ser válida.
+ *
+ * \param *li representa um ponteiro para a lista onde o elemento será inserido.
+ * \param item representa o item a ser inserido na lista.
+ * \param pos representa a posição onde o \p item deve ser inserido na lista.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado:
+ * 			1. caso o ponteiro \p *li seja igual a \p NULL;
+ * 			2. caso a posição informada seja inválida; ou
+ * 			3. caso a lista já tenha INT_MAX elementos.
+ */
+void inserir(ListaVetDin* li, int item, int pos);
+
+/**
+ * \brief Remove e retorna um elemento da lista.
+ *
+ * Funciona como a função \p remover da ListaVet. Caso o encolhimento automático esteja ativado
+ * (veja \p definir_encolhimento_automatico), o arranjo tem sua capacidade reduzida à metade
+ * quando a lista passa a ocupar apenas um quarto dele.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre A lista não deve estar vazia.
+ * \pre A posição \p pos deve ser válida.
+ *
+ * \param *li representa um ponteiro para a lista de onde o elemento será removido.
+ * \param pos representa a posição de onde o elemento deve ser removido da lista.
+ *
+ * \return O elemento removido da lista.
+ *
+ * \warning O programa será abortado:
+ * 			1. caso o ponteiro \p *li seja igual a \p NULL;
+ * 			2. caso a lista esteja vazia; ou
+ * 			3. caso a posição informada seja inválida.
+ */
+int remover(ListaVetDin* li, int pos);
+
+/**
+ * \brief Retorna um elemento da lista.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre A lista não deve estar vazia.
+ * \pre A posição \p pos deve ser válida.
+ *
+ * \param *li representa um ponteiro para a lista de onde o elemento será obtido.
+ * \param pos representa a posição de onde o elemento deve ser obtido da lista.
+ *
+ * \return O elemento obtido da lista.
+ *
+ * \warning O programa será abortado:
+ * 			1. caso o ponteiro \p *li seja igual a \p NULL;
+ * 			2. caso a lista esteja vazia; ou
+ * 			3. caso a posição informada seja inválida.
+ */
+int obter(ListaVetDin* li, int pos);
+
+/**
+ * \brief Retorna a quantidade de elementos da lista.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista.
+ *
+ * \return A quantidade de elementos da lista.
+ *
+ * \warning O programa será abortado caso o ponteiro \p *li seja igual a \p NULL.
+ */
+int obter_tamanho(ListaVetDin* li);
+
+/**
+ * \brief Retorna a quantidade de elementos que a lista comporta sem precisar realocar o arranjo.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista.
+ *
+ * \return A capacidade atual do arranjo da lista.
+ *
+ * \warning O programa será abortado caso o ponteiro \p *li seja igual a \p NULL.
+ */
+int obter_capacidade(ListaVetDin* li);
+
+/**
+ * \brief Garante que a lista comporte pelo menos \p capacidade elementos sem realocações.
+ *
+ * Útil quando a quantidade de elementos a ser inserida é conhecida de antemão, pois evita
+ * as sucessivas cópias do arranjo durante o crescimento. Se a capacidade atual já for
+ * suficiente, nada é feito.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include "listavetdin.hpp"
+ *
+ * using namespace std;
+ *
+ * int main() {
+ *     ListaVetDin *li = criar_lista_din();
+ *     reservar(li, 1000);
+ *     cout << (obter_capacidade(li) >= 1000) << endl;
+ *     liberar_lista(li);
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * Saída esperada:
+ * \code {.unparsed}
+ * 		1
+ * \endcode
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre \p capacidade deve ser maior ou igual a zero.
+ *
+ * \param *li representa um ponteiro para a lista.
+ * \param capacidade representa a quantidade mínima de elementos que a lista deve comportar.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado caso o ponteiro \p *li seja igual a \p NULL ou caso
+ *          \p capacidade seja negativa.
+ */
+void reservar(ListaVetDin* li, int capacidade);
+
+/**
+ * \brief Reduz a capacidade do arranjo ao tamanho atual da lista, devolvendo a memória excedente.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado caso o ponteiro \p *li seja igual a \p NULL.
+ */
+void encolher(ListaVetDin* li);
+
+/**
+ * \brief Ativa ou desativa o encolhimento automático do arranjo nas remoções.
+ *
+ * Quando ativado, a capacidade é reduzida à metade sempre que a lista passa a ocupar
+ * no máximo um quarto do arranjo. A folga entre o limiar de crescimento (arranjo cheio)
+ * e o de encolhimento (um quarto) evita realocações sucessivas quando inserções e remoções
+ * se alternam perto do limite. Por padrão, o encolhimento automático fica desativado.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista.
+ * \param ativado indica se o encolhimento automático deve ser ativado (\p true) ou desativado (\p false).
+ *
+ * \return void
+ *
+ * \warning O programa será abortado caso o ponteiro \p *li seja igual a \p NULL.
+ */
+void definir_encolhimento_automatico(ListaVetDin* li, bool ativado);
+
+/** 
+ * \brief Insere, de uma só vez, os elementos do intervalo [primeiro, ultimo) a partir da posição \p pos.
+ * 
+ * Após a operação, *primeiro ocupa a posição \p pos, *(primeiro + 1) a posição pos + 1 e assim por
+ * diante. Os elementos que estavam a partir de \p pos são deslocados com uma única chamada a
+ * memmove, em vez de um deslocamento por elemento inserido.
+ * 
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include "listavetdin.hpp"
+ * 
+ * using namespace std;
+ *
+ * int main() {
+ *     ListaVetDin *li = criar_lista_din();
+ *     int v[] = {2, 3, 4};
+ *     inserir(li, 1, 0);
+ *     inserir(li, 5, 1);
+ *     inserir_intervalo(li, 1, v, v + 3);
+ *     remover_intervalo(li, 0, 2, NULL);
+ *     for (int i = 0; i < obter_tamanho(li); i++) {
+ *         cout << obter(li, i) << " ";
+ *     }
+ *     cout << endl;
+ *     liberar_lista(li);
+ *     return EXIT_SUCCESS;
+ * }  
+ * \endcode
+ * 
+ * Saída esperada:
+ * \code {.unparsed}
+ *     3 4 5
+ * \endcode
+ * 
+ * \pre Os ponteiros \p *li, \p *primeiro e \p *ultimo devem ser diferentes de \p NULL, com primeiro <= ultimo.
+ * \pre A posição \p pos deve estar no intervalo [0, tamanho_da_lista].
+ * 
+ * \param *li representa um ponteiro para a lista.
+ * \param pos representa a posição onde o primeiro elemento do intervalo será inserido.
+ * \param *primeiro representa o endereço do primeiro elemento a ser inserido.
+ * \param *ultimo representa o endereço seguinte ao último elemento a ser inserido.
+ * 
+ * \return void
+ * 
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL, caso a posição
+ * 			informada seja inválida ou caso a lista passe a ter mais de INT_MAX elementos.
+ */
+void inserir_intervalo(ListaVetDin* li, int pos, const int* primeiro, const int* ultimo);
+
+/** 
+ * \brief Remove, de uma só vez, os \p n elementos a partir da posição \p pos.
+ * 
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre O intervalo [pos, pos + n - 1] deve estar contido em [0, tamanho_da_lista - 1].
+ * 
+ * \param *li representa um ponteiro para a lista.
+ * \param pos representa a posição do primeiro elemento a ser removido.
+ * \param n representa a quantidade de elementos a serem removidos.
+ * \param *saida representa o vetor, com pelo menos \p n posições, que receberá os elementos removidos,
+ * 		  na ordem em que estavam na lista. Se for \p NULL, os elementos são apenas descartados.
+ * 
+ * \return void
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL ou
+ * 			caso o intervalo seja inválido.
+ */
+void remover_intervalo(ListaVetDin* li, int pos, int n, int* saida);
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+/**
+ * \brief Retorna os contadores de uso da lista.
+ *
+ * Disponível apenas quando a macro ESTRUTURAS_ESTATISTICAS é definida na compilação. Os contadores
+ * continuam sendo atualizados pelas operações seguintes; veja o arquivo estatisticas.hpp.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista.
+ *
+ * \return O endereço dos contadores da lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+const Estatisticas* obter_estatisticas(ListaVetDin* li);
+#endif
+
+#endif
@@ -0,0 +1,264 @@
+#include <assert.h> /**< Necessário para uso da macro "assert". */
+#include <atomic> /**< Necessário para uso do tipo "std::atomic". */
+#include <thread> /**< Necessário para uso da classe "std::thread". */
+#include <vector> /**< Necessário para uso da classe "std::vector". */
+#include "ordenacao.hpp"
+
+using namespace std;
+
+/* Trechos com até esta quantidade de elementos são ordenados por inserção. */
+static const int LIMIAR_INSERCAO = 16;
+
+static inline void trocar(int* a, int* b) {
+	int aux = *a;
+	*a = *b;
+	*b = aux;
+}
+
+static void ordenar_insercao(int* v, int n) {
+	for (int i = 1; i < n; i++) {
+		int item = v[i];
+		int j = i;
+		while ((j > 0) and (v[j - 1] > item)) {
+			v[j] = v[j - 1];
+			j--;
+		}
+		v[j] = item;
+	}
+}
+
+/* Desce o elemento da posição "i" até restaurar a propriedade do heap de máximo v[0, n). */
+static void peneirar(int* v, int n, int i) {
+	int item = v[i];
+	while (2 * i + 1 < n) {
+		int filho = 2 * i + 1;
+		if ((filho + 1 < n) and (v[filho + 1] > v[filho])) {
+			filho++;
+		}
+		if (v[filho] <= item) {
+			break;
+		}
+		v[i] = v[filho];
+		i = filho;
+	}
+	v[i] = item;
+}
+
+static void ordenar_heap(int* v, int n) {
+	for (int i = n / 2 - 1; i >= 0; i--) {
+		peneirar(v, n, i);
+	}
+	for (int i = n - 1; i > 0; i--) {
+		trocar(&v[0], &v[i]);
+		peneirar(v, i, 0);
+	}
+}
+
+static void introsort(int* v, int n, int profundidade) {
+	while (n > LIMIAR_INSERCAO) {
+		if (profundidade == 0) {
+			ordenar_heap(v, n);
+			return;
+		}
+		profundidade--;
+
+		/*
+		 * Coloca em ordem o primeiro, o do meio e o último elemento e usa o do meio como pivô.
+		 * Assim, v[0] <= pivô <= v[n - 1] servem de sentinelas para os laços da partição.
+		 */
+		int meio = n / 2;
+		if (v[meio] < v[0]) {
+			trocar(&v[meio], &v[0]);
+		}
+		if (v[n - 1] < v[meio]) {
+			trocar(&v[n - 1], &v[meio]);
+			if (v[meio] < v[0]) {
+				trocar(&v[meio], &v[0]);
+			}
+		}
+		int pivo = v[meio];
+
+		// Partição de Hoare: ao final, v[0, j] <= pivô <= v[j + 1, n), com os dois trechos não vazios.
+		int i = 0;
+		int j = n - 1;
+		while (true) {
+			do {
+				i++;
+			} while (v[i] < pivo);
+			do {
+				j--;
+			} while (v[j] > pivo);
+			if (i >= j) {
+				break;
+			}
+			trocar(&v[i], &v[j]);
+		}
+
+		// Ordena o trecho menor com uma chamada recursiva e continua com o maior, limitando a pilha.
+		int n_esquerda = j + 1;
+		if (n_esquerda < n - n_esquerda) {
+			introsort(v, n_esquerda, profundidade);
+			v += n_esquerda;
+			n -= n_esquerda;
+		} else {
+			introsort(v + n_esquerda, n - n_esquerda, profundidade);
+			n = n_esquerda;
+		}
+	}
+	ordenar_insercao(v, n);
+}
+
+void ordenar_introsort(int* v, int n) {
+	assert((v != NULL) or (n == 0));
+	assert(n >= 0);
+
+	int profundidade = 0;
+	for (int m = n; m > 1; m /= 2) {
+		profundidade += 2;
+	}
+	introsort(v, n, profundidade);
+}
+
+/*
+ * O radix sort compara os elementos como inteiros sem sinal. Inverter o bit de sinal faz com que
+ * os negativos venham antes dos positivos, como na comparação de int.
+ */
+static inline unsigned digito(int item, int deslocamento) {
+	return ((static_cast<unsigned>(item) ^ 0x80000000u) >> deslocamento) & 0xFFu;
+}
+
+/*
+ * Distribui os elementos de v[0, n) nos 256 baldes do byte que começa no bit "deslocamento".
+ * Ao final, o balde b ocupa as posições [inicio[b], inicio[b + 1]).
+ */
+static void distribuir(int* v, int n, int deslocamento, int inicio[257]) {
+	int contagem[256] = {0};
+	for (int i = 0; i < n; i++) {
+		contagem[digito(v[i], deslocamento)]++;
+	}
+	int proximo[256];
+	inicio[0] = 0;
+	for (int b = 0; b < 256; b++) {
+		proximo[b] = inicio[b];
+		inicio[b + 1] = inicio[b] + contagem[b];
+	}
+
+	/*
+	 * Cada elemento fora do lugar é trocado para a próxima posição livre do seu balde, e o elemento
+	 * que estava lá passa a ser o da vez, até que chegue um que pertença ao balde percorrido.
+	 */
+	for (int b = 0; b < 256; b++) {
+		while (proximo[b] < inicio[b + 1]) {
+			int item = v[proximo[b]];
+			unsigned d = digito(item, deslocamento);
+			while (d != static_cast<unsigned>(b)) {
+				int aux = v[proximo[d]];
+				v[proximo[d]++] = item;
+				item = aux;
+				d = digito(item, deslocamento);
+			}
+			v[proximo[b]++] = item;
+		}
+	}
+}
+
+static void radix(int* v, int n, int deslocamento) {
+	if (n < LIMIAR_RADIX) {
+		ordenar_introsort(v, n);
+		return;
+	}
+	int inicio[257];
+	distribuir(v, n, deslocamento, inicio);
+	if (deslocamento == 0) {
+		return;
+	}
+	for (int b = 0; b < 256; b++) {
+		int tam = inicio[b + 1] - inicio[b];
+		if (tam > 1) {
+			radix(v + inicio[b], tam, deslocamento - 8);
+		}
+	}
+}
+
+void ordenar_radix(int* v, int n) {
+	assert((v != NULL) or (n == 0));
+	assert(n >= 0);
+
+	radix(v, n, 24);
+}
+
+/* Retorna true se v[0, n) já está em ordem crescente; se estiver em ordem estritamente decrescente, inverte-o. */
+static bool tratar_ordenados(int* v, int n) {
+	int i = 1;
+	while ((i < n) and (v[i - 1] <= v[i])) {
+		i++;
+	}
+	if (i >= n) {
+		return true;
+	}
+	if (i > 1) {
+		return false;
+	}
+	while ((i < n) and (v[i - 1] > v[i])) {
+		i++;
+	}
+	if (i < n) {
+		return false;
+	}
+	for (int a = 0, b = n - 1; a < b; a++, b--) {
+		trocar(&v[a], &v[b]);
+	}
+	return true;
+}
+
+void ordenar_vetor(int* v, int n, int qtd_threads) {
+	assert((v != NULL) or (n == 0));
+	assert(n >= 0);
+
+	if (tratar_ordenados(v, n)) {
+		return;
+	}
+	if ((qtd_threads <= 1) or (n < LIMIAR_RADIX)) {
+		radix(v, n, 24);
+		return;
+	}
+
+	/*
+	 * Distribui pelo primeiro byte que separa os elementos: se todos caem no mesmo balde (valores
+	 * próximos entre si), não haveria o que repartir entre as threads.
+	 */
+	int inicio[257];
+	int deslocamento = 24;
+	while (true) {
+		distribuir(v, n, deslocamento, inicio);
+		unsigned b = digito(v[0], deslocamento);
+		bool um_balde = (inicio[b + 1] - inicio[b] == n);
+		if (!um_balde or (deslocamento == 0)) {
+			break;
+		}
+		deslocamento -= 8;
+	}
+	if (deslocamento == 0) {
+		return;
+	}
+
+	// Cada thread pega o próximo balde ainda não ordenado, até que não reste nenhum.
+	atomic<int> proximo_balde(0);
+	auto ordenar_baldes = [&]() {
+		int b;
+		while ((b = proximo_balde.fetch_add(1)) < 256) {
+			int tam = inicio[b + 1] - inicio[b];
+			if (tam > 1) {
+				radix(v + inicio[b], tam, deslocamento - 8);
+			}
+		}
+	};
+	vector<thread> threads;
+	for (int t = 1; t < qtd_threads; t++) {
+		threads.emplace_back(ordenar_baldes);
+	}
+	ordenar_baldes();
+	for (thread& t : threads) {
+		t.join();
+	}
+}
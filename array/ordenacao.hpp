@@ -0,0 +1,61 @@
+/**
+ * \file ordenacao.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Interface das rotinas de ordenação de vetores de int
+ *
+ * Disponibiliza as rotinas usadas internamente por \p ordenar e \p ordenar_paralelo da ListaVet.
+ * Todas ordenam o vetor no próprio lugar, sem alocar memória:
+ *  - \p ordenar_introsort: quicksort com mediana de três, que passa para o heapsort quando a
+ *    recursão fica profunda demais (o que garante O(n log n) no pior caso) e usa a ordenação por
+ *    inserção nos trechos pequenos;
+ *  - \p ordenar_radix: radix sort MSD no próprio lugar ("American flag sort"), que distribui os
+ *    elementos em 256 baldes pelo byte mais significativo, troca cada elemento diretamente para o
+ *    seu balde e repete o processo em cada balde com o byte seguinte;
+ *  - \p ordenar_vetor: escolhe entre as duas conforme o tamanho e, antes, reconhece em O(n) os
+ *    vetores já ordenados ou em ordem estritamente decrescente.
+ */
+
+#ifndef ORDENACAO_HPP
+#define ORDENACAO_HPP
+
+/**
+ * \def LIMIAR_RADIX
+ * \brief Define o tamanho a partir do qual os vetores (e os baldes do radix sort) são ordenados
+ * pelo radix sort; os menores são ordenados pelo introsort.
+ * \hideinitializer
+ */
+#ifndef LIMIAR_RADIX
+#define LIMIAR_RADIX 2048
+#endif
+
+/**
+ * \brief Ordena os \p n elementos de \p v em ordem crescente com o introsort.
+ *
+ * \param *v representa o vetor a ser ordenado.
+ * \param n representa a quantidade de elementos do vetor.
+ */
+void ordenar_introsort(int* v, int n);
+
+/**
+ * \brief Ordena os \p n elementos de \p v em ordem crescente com o radix sort MSD no próprio lugar.
+ *
+ * \param *v representa o vetor a ser ordenado.
+ * \param n representa a quantidade de elementos do vetor.
+ */
+void ordenar_radix(int* v, int n);
+
+/**
+ * \brief Ordena os \p n elementos de \p v em ordem crescente, usando até \p qtd_threads threads.
+ *
+ * Com mais de uma thread (e pelo menos LIMIAR_RADIX elementos), a primeira distribuição do radix
+ * sort é feita pela thread que chamou a função e os baldes resultantes, que são independentes
+ * entre si, são ordenados pelas threads ao mesmo tempo. Não há intercalação no final.
+ *
+ * \param *v representa o vetor a ser ordenado.
+ * \param n representa a quantidade de elementos do vetor.
+ * \param qtd_threads representa a quantidade máxima de threads (1 ou menos: apenas a que chamou).
+ */
+void ordenar_vetor(int* v, int n, int qtd_threads);
+
+#endif
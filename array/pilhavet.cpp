@@ -1,13 +1,19 @@
 #include <assert.h> /**< Necessário para uso da macro "assert". */
 #include <cstdlib> /**< Necessário para uso do NULL. */
+#include <cstring> /**< Necessário para uso das funções "memcpy". */
 #include "pilhavet.hpp"
 
-using namespace std;
+/*
+ * A estrutura e as operações curtas (estah_vazia, empilhar, obter_topo etc.) ficam em
+ * pilhavet_em_linha.hpp, que também é usado pelo modo em linha de pilhavet.hpp. Sem esse modo, elas
+ * são definidas aqui como funções comuns.
+ */
+#ifndef ESTRUTURAS_EM_LINHA
+#define PILHAVET_EM_LINHA
+#include "pilhavet_em_linha.hpp"
+#endif
 
-struct PilhaVet {
-	int itens[TAM_MAX]; /**< Vetor que armazena os elementos da pilha. */        
-	int topo; /**< Variável que indica a próxima posição vazia da pilha. */
-};
+using namespace std;
 
 PilhaVet* criar_pilha() {
 	/* 
@@ -17,6 +23,7 @@ PilhaVet* criar_pilha() {
 	PilhaVet* pilha = new PilhaVet;
     
 	pilha->topo = 0;
+	ESTATISTICA(zerar_estatisticas(&pilha->estat));
 	return pilha;
 }
 
@@ -31,38 +38,29 @@ void liberar_pilha(PilhaVet* pilha) {
 	delete pilha;		
 }
 
-bool estah_cheia(PilhaVet* pilha) {
-	assert(pilha != NULL);	
-    
-	return (pilha->topo == TAM_MAX);
-}
+void empilhar_varios(PilhaVet* pilha, const int* itens, int n) {
+	assert((pilha != NULL) && (itens != NULL));
+	assert((n >= 0) && (pilha->topo + n <= TAM_MAX_PILHAVET));
 
-bool estah_vazia(PilhaVet* pilha) {
-	assert(pilha != NULL);	
-	
-	return (pilha->topo == 0);
+	/* Uma única cópia de bloco substitui "n" chamadas de empilhar, com suas verificações. */
+	memcpy(pilha->itens + pilha->topo, itens, n * sizeof(int));
+	pilha->topo += n;
+	ESTATISTICA(contar_insercoes(&pilha->estat, n));
 }
 
-void empilhar(PilhaVet* pilha, int item) {
-	assert(pilha != NULL);
-	assert(!estah_cheia(pilha));    
-    
-	pilha->itens[pilha->topo] = item;
-	pilha->topo++;
-}
+void desempilhar_varios(PilhaVet* pilha, int* saida, int n) {
+	assert((pilha != NULL) && (saida != NULL));
+	assert((n >= 0) && (n <= pilha->topo));
 
-int desempilhar(PilhaVet* pilha) {
-	assert(pilha != NULL);
-	assert(!estah_vazia(pilha));    
-        
-	int item = pilha->itens[pilha->topo - 1];
-	pilha->topo--;
-	return item;    
+	pilha->topo -= n;
+	memcpy(saida, pilha->itens + pilha->topo, n * sizeof(int));
+	ESTATISTICA(contar_remocoes(&pilha->estat, n));
 }
 
-int obter_topo(PilhaVet* pilha) {
+#ifdef ESTRUTURAS_ESTATISTICAS
+const Estatisticas* obter_estatisticas(PilhaVet* pilha) {
 	assert(pilha != NULL);
-	assert(!estah_vazia(pilha));    
-    
-	return pilha->itens[pilha->topo - 1];
+
+	return &pilha->estat;
 }
+#endif
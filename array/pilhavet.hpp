@@ -10,19 +10,45 @@
 #ifndef PILHAVET_HPP
 #define PILHAVET_HPP
 
+#include "../comum/estatisticas.hpp"
+
 /**
- * \def TAM_MAX 
+ * \def TAM_MAX_PILHAVET
  * \brief Define a quantidade máxima de elementos suportada pela pilha.
+ *
+ * Pode ser redefinida na compilação (por exemplo, com -DTAM_MAX_PILHAVET=1024).
  * \hideinitializer
  */
-#define TAM_MAX 1000000 
+#ifndef TAM_MAX_PILHAVET
+#define TAM_MAX_PILHAVET 1000000
+#endif
+
+/**
+ * \def TAM_MAX
+ * \brief Nome antigo de TAM_MAX_PILHAVET, mantido por compatibilidade.
+ *
+ * Como todos os cabeçalhos de array/ definiam TAM_MAX, incluir dois deles no mesmo arquivo
+ * redefinia a macro. Agora, ela só é definida pelo primeiro cabeçalho incluído e, por isso,
+ * pode não corresponder a esta pilha: prefira TAM_MAX_PILHAVET.
+ * \hideinitializer
+ */
+#ifndef TAM_MAX
+#define TAM_MAX TAM_MAX_PILHAVET
+#endif
 
 /** 
  * \struct PilhaVet
  * \brief Declaração opaca da estrutura de uma pilha.
  * 
  * Isso significa que os detalhes de implementação desta estrutura estão escondidos do usuário do TAD. 
- * A definição da estrutura PilhaVet encontra-se no arquivo \file pilhavet.cpp.
+ * A definição da estrutura PilhaVet encontra-se no arquivo \file pilhavet_em_linha.hpp.
+ *
+ * Quando a macro ESTRUTURAS_EM_LINHA é definida na compilação (por exemplo, com
+ * -DESTRUTURAS_EM_LINHA), este cabeçalho inclui a definição da estrutura e as versões "inline" de
+ * estah_vazia, estah_cheia, empilhar, desempilhar e obter_topo. Assim, o compilador pode expandir
+ * essas operações no código de quem as chama, sem o custo de uma chamada de função. Em troca,
+ * qualquer mudança na estrutura exige recompilar esse código. Todos os arquivos do programa,
+ * inclusive pilhavet.cpp, devem ser compilados no mesmo modo.
  */
 struct PilhaVet;
 
@@ -270,4 +296,92 @@ int desempilhar(PilhaVet* p);
  */
 int obter_topo(PilhaVet* p);
 
+/** 
+ * \brief Empilha, de uma só vez, os \p n elementos do vetor \p itens.
+ * 
+ * O resultado é o mesmo de chamar empilhar(p, itens[i]) para i = 0, 1, ..., n - 1 (ou seja,
+ * itens[n - 1] fica no topo), mas os elementos são copiados com uma única chamada a memcpy.
+ * 
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include "pilhavet.hpp"
+ * 
+ * using namespace std;
+ *
+ * int main() {
+ *     PilhaVet *p = criar_pilha();
+ *     int v[] = {1, 2, 3, 4};
+ *     empilhar_varios(p, v, 4);
+ *     int topo[2];
+ *     desempilhar_varios(p, topo, 2);
+ *     cout << topo[0] << " " << topo[1] << " " << obter_topo(p) << endl;
+ *     liberar_pilha(p);
+ *     return EXIT_SUCCESS;
+ * }  
+ * \endcode
+ * 
+ * Saída esperada:
+ * \code {.unparsed}
+ *     3 4 2
+ * \endcode
+ * 
+ * \pre Os ponteiros \p *p e \p *itens devem ser diferentes de \p NULL.
+ * \pre A pilha deve ter espaço para mais \p n elementos.
+ * 
+ * \param *p representa um ponteiro para a pilha.
+ * \param *itens representa o vetor com os elementos a serem empilhados.
+ * \param n representa a quantidade de elementos a serem empilhados.
+ * 
+ * \return void
+ * 
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL ou
+ * 			caso não haja espaço para os \p n elementos.
+ */
+void empilhar_varios(PilhaVet* p, const int* itens, int n);
+
+/** 
+ * \brief Desempilha, de uma só vez, os \p n elementos do topo da pilha.
+ * 
+ * Os elementos são armazenados em \p saida na ordem em que estavam na pilha, de baixo para cima:
+ * saida[n - 1] é o antigo topo. Assim, empilhar_varios(p, saida, n) desfaz a operação.
+ * 
+ * \pre Os ponteiros \p *p e \p *saida devem ser diferentes de \p NULL.
+ * \pre A pilha deve ter pelo menos \p n elementos.
+ * 
+ * \param *p representa um ponteiro para a pilha.
+ * \param *saida representa o vetor, com pelo menos \p n posições, que receberá os elementos.
+ * \param n representa a quantidade de elementos a serem desempilhados.
+ * 
+ * \return void
+ * 
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL ou
+ * 			caso a pilha tenha menos do que \p n elementos.
+ */
+void desempilhar_varios(PilhaVet* p, int* saida, int n);
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+/**
+ * \brief Retorna os contadores de uso da pilha.
+ *
+ * Disponível apenas quando a macro ESTRUTURAS_ESTATISTICAS é definida na compilação. Os contadores
+ * continuam sendo atualizados pelas operações seguintes; veja o arquivo estatisticas.hpp.
+ *
+ * \pre O ponteiro \p *p deve ser diferente de \p NULL.
+ *
+ * \param *p representa um ponteiro para a pilha.
+ *
+ * \return O endereço dos contadores da pilha.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *p seja igual a \p NULL.
+ */
+const Estatisticas* obter_estatisticas(PilhaVet* p);
+#endif
+
+#ifdef ESTRUTURAS_EM_LINHA
+#define PILHAVET_EM_LINHA inline
+#include "pilhavet_em_linha.hpp"
+#endif
+
 #endif
@@ -0,0 +1,68 @@
+/**
+ * \file pilhavet_em_linha.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Definição da estrutura PilhaVet e das operações curtas da pilha
+ *
+ * Este arquivo não deve ser incluído diretamente. Ele é incluído por pilhavet.cpp, que gera as
+ * versões comuns (fora de linha) das operações, e por pilhavet.hpp quando a macro
+ * ESTRUTURAS_EM_LINHA está definida. Nesse caso, a macro PILHAVET_EM_LINHA vale "inline" e o
+ * compilador pode expandir as operações diretamente no código de quem as chama.
+ */
+
+#ifndef PILHAVET_EM_LINHA_HPP
+#define PILHAVET_EM_LINHA_HPP
+
+#include <assert.h> /**< Necessário para uso da macro "assert". */
+#include <cstdlib> /**< Necessário para uso do NULL. */
+#include "pilhavet.hpp"
+
+struct PilhaVet {
+	int itens[TAM_MAX_PILHAVET]; /**< Vetor que armazena os elementos da pilha. */
+	int topo; /**< Variável que indica a próxima posição vazia da pilha. */
+#ifdef ESTRUTURAS_ESTATISTICAS
+	Estatisticas estat; /**< Contadores de uso (veja estatisticas.hpp). */
+#endif
+};
+
+PILHAVET_EM_LINHA bool estah_cheia(PilhaVet* pilha) {
+	assert(pilha != NULL);
+
+	return (pilha->topo == TAM_MAX_PILHAVET);
+}
+
+PILHAVET_EM_LINHA bool estah_vazia(PilhaVet* pilha) {
+	assert(pilha != NULL);
+
+	return (pilha->topo == 0);
+}
+
+PILHAVET_EM_LINHA void empilhar(PilhaVet* pilha, int item) {
+	assert(pilha != NULL);
+	assert(!estah_cheia(pilha));
+
+	pilha->itens[pilha->topo] = item;
+	pilha->topo++;
+	ESTATISTICA(contar_insercoes(&pilha->estat, 1));
+}
+
+PILHAVET_EM_LINHA int desempilhar(PilhaVet* pilha) {
+	assert(pilha != NULL);
+	assert(!estah_vazia(pilha));
+
+	int item = pilha->itens[pilha->topo - 1];
+	pilha->topo--;
+	ESTATISTICA(contar_remocoes(&pilha->estat, 1));
+	return item;
+}
+
+PILHAVET_EM_LINHA int obter_topo(PilhaVet* pilha) {
+	assert(pilha != NULL);
+	assert(!estah_vazia(pilha));
+
+	ESTATISTICA(contar_consulta(&pilha->estat));
+	return pilha->itens[pilha->topo - 1];
+}
+
+#endif
+
@@ -0,0 +1,429 @@
+#include <assert.h> /**< Necessário para uso da macro "assert". */
+#include <cstdlib> /**< Necessário para uso do NULL. */
+#include "varredura.hpp"
+
+/*
+ * As versões vetorizadas usam o atributo "target" e as funções "__builtin_cpu_*", do GCC e do
+ * Clang, e só fazem sentido em processadores x86.
+ */
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define VARREDURA_X86
+#include <immintrin.h> /**< Necessário para uso das instruções AVX2 e AVX-512 ("intrinsics"). */
+#endif
+
+using namespace std;
+
+/* Rotinas de um nível, para um único trecho contíguo. */
+struct Kernels {
+	int (*primeiro)(const int* v, int n, int item);
+	int (*ocorrencias)(const int* v, int n, int item);
+	long long (*soma)(const int* v, int n);
+	int (*minimo)(const int* v, int n);
+	int (*maximo)(const int* v, int n);
+	int (*filtro)(const int* v, int n, int menor, int maior, int* saida);
+};
+
+/*
+ * Versões escalares. Elas também processam o final dos vetores nas versões vetorizadas, quando
+ * sobram menos elementos que os de um bloco.
+ */
+
+static int primeiro_escalar(const int* v, int n, int item) {
+	for (int i = 0; i < n; i++) {
+		if (v[i] == item) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+static int ocorrencias_escalar(const int* v, int n, int item) {
+	int qtd = 0;
+	for (int i = 0; i < n; i++) {
+		qtd += (v[i] == item);
+	}
+	return qtd;
+}
+
+static long long soma_escalar(const int* v, int n) {
+	long long soma = 0;
+	for (int i = 0; i < n; i++) {
+		soma += v[i];
+	}
+	return soma;
+}
+
+static int minimo_escalar(const int* v, int n) {
+	int menor = v[0];
+	for (int i = 1; i < n; i++) {
+		menor = (v[i] < menor) ? v[i] : menor;
+	}
+	return menor;
+}
+
+static int maximo_escalar(const int* v, int n) {
+	int maior = v[0];
+	for (int i = 1; i < n; i++) {
+		maior = (v[i] > maior) ? v[i] : maior;
+	}
+	return maior;
+}
+
+/*
+ * O teste menor <= x <= maior é feito com uma única comparação sem sinal: x - menor, visto como
+ * unsigned, só é menor ou igual a maior - menor se x estiver no intervalo (os valores abaixo de
+ * "menor" dão a volta e viram números muito grandes).
+ */
+static int filtro_escalar(const int* v, int n, int menor, int maior, int* saida) {
+	unsigned limite = (unsigned) maior - (unsigned) menor;
+	int qtd = 0;
+	for (int i = 0; i < n; i++) {
+		if ((unsigned) v[i] - (unsigned) menor <= limite) {
+			saida[qtd++] = v[i];
+		}
+	}
+	return qtd;
+}
+
+#ifdef VARREDURA_X86
+
+/* Versões AVX2: blocos de 8 elementos (256 bits). */
+
+#define AVX2 __attribute__((target("avx2,popcnt,bmi")))
+
+AVX2 static int primeiro_avx2(const int* v, int n, int item) {
+	__m256i alvo = _mm256_set1_epi32(item);
+	int i = 0;
+
+	/* Compara 32 elementos por iteração e só procura a posição exata no bloco onde houve igualdade. */
+	for (; i + 32 <= n; i += 32) {
+		__m256i c0 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*) (v + i)), alvo);
+		__m256i c1 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*) (v + i + 8)), alvo);
+		__m256i c2 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*) (v + i + 16)), alvo);
+		__m256i c3 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*) (v + i + 24)), alvo);
+		__m256i algum = _mm256_or_si256(_mm256_or_si256(c0, c1), _mm256_or_si256(c2, c3));
+		if (!_mm256_testz_si256(algum, algum)) {
+			break;
+		}
+	}
+	for (; i + 8 <= n; i += 8) {
+		__m256i iguais = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*) (v + i)), alvo);
+		int mascara = _mm256_movemask_ps(_mm256_castsi256_ps(iguais));
+		if (mascara != 0) {
+			return i + __builtin_ctz(mascara);
+		}
+	}
+	int pos = primeiro_escalar(v + i, n - i, item);
+	return (pos < 0) ? -1 : i + pos;
+}
+
+/* Soma os 8 inteiros de 32 bits de "x". */
+AVX2 static int somar_faixas_avx2(__m256i x) {
+	__m128i s = _mm_add_epi32(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1));
+	s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(1, 0, 3, 2)));
+	s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(2, 3, 0, 1)));
+	return _mm_cvtsi128_si32(s);
+}
+
+AVX2 static int ocorrencias_avx2(const int* v, int n, int item) {
+	__m256i alvo = _mm256_set1_epi32(item);
+	__m256i qtd0 = _mm256_setzero_si256();
+	__m256i qtd1 = _mm256_setzero_si256();
+	int i = 0;
+
+	/* Cada igualdade vale -1 (todos os bits 1) e é subtraída do contador da sua faixa. */
+	for (; i + 16 <= n; i += 16) {
+		qtd0 = _mm256_sub_epi32(qtd0, _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*) (v + i)), alvo));
+		qtd1 = _mm256_sub_epi32(qtd1, _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*) (v + i + 8)), alvo));
+	}
+	return somar_faixas_avx2(_mm256_add_epi32(qtd0, qtd1)) + ocorrencias_escalar(v + i, n - i, item);
+}
+
+AVX2 static long long soma_avx2(const int* v, int n) {
+	/* Cada bloco é estendido para 64 bits antes da soma, de modo que ela não estoura. */
+	__m256i soma0 = _mm256_setzero_si256();
+	__m256i soma1 = _mm256_setzero_si256();
+	int i = 0;
+	for (; i + 8 <= n; i += 8) {
+		__m256i x = _mm256_loadu_si256((const __m256i*) (v + i));
+		soma0 = _mm256_add_epi64(soma0, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(x)));
+		soma1 = _mm256_add_epi64(soma1, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(x, 1)));
+	}
+	long long faixas[4];
+	_mm256_storeu_si256((__m256i*) faixas, _mm256_add_epi64(soma0, soma1));
+	return faixas[0] + faixas[1] + faixas[2] + faixas[3] + soma_escalar(v + i, n - i);
+}
+
+AVX2 static int minimo_avx2(const int* v, int n) {
+	if (n < 8) {
+		return minimo_escalar(v, n);
+	}
+	__m256i menor = _mm256_loadu_si256((const __m256i*) v);
+	int i = 8;
+	for (; i + 8 <= n; i += 8) {
+		menor = _mm256_min_epi32(menor, _mm256_loadu_si256((const __m256i*) (v + i)));
+	}
+	/* O último bloco (que pode repetir elementos já vistos) cobre o final do vetor. */
+	menor = _mm256_min_epi32(menor, _mm256_loadu_si256((const __m256i*) (v + n - 8)));
+	int faixas[8];
+	_mm256_storeu_si256((__m256i*) faixas, menor);
+	return minimo_escalar(faixas, 8);
+}
+
+AVX2 static int maximo_avx2(const int* v, int n) {
+	if (n < 8) {
+		return maximo_escalar(v, n);
+	}
+	__m256i maior = _mm256_loadu_si256((const __m256i*) v);
+	int i = 8;
+	for (; i + 8 <= n; i += 8) {
+		maior = _mm256_max_epi32(maior, _mm256_loadu_si256((const __m256i*) (v + i)));
+	}
+	maior = _mm256_max_epi32(maior, _mm256_loadu_si256((const __m256i*) (v + n - 8)));
+	int faixas[8];
+	_mm256_storeu_si256((__m256i*) faixas, maior);
+	return maximo_escalar(faixas, 8);
+}
+
+/*
+ * Tabela de compactação do AVX2: para cada máscara de 8 bits (os elementos aprovados de um bloco),
+ * a linha correspondente lista as faixas aprovadas, em ordem, e é usada para juntá-las no início do
+ * bloco com uma única permutação. Preenchida na detecção do nível.
+ */
+alignas(32) static int compactacao[256][8];
+
+static void preencher_compactacao() {
+	for (int mascara = 0; mascara < 256; mascara++) {
+		int k = 0;
+		for (int faixa = 0; faixa < 8; faixa++) {
+			if (mascara & (1 << faixa)) {
+				compactacao[mascara][k++] = faixa;
+			}
+		}
+		while (k < 8) {
+			compactacao[mascara][k++] = 0;
+		}
+	}
+}
+
+AVX2 static int filtro_avx2(const int* v, int n, int menor, int maior, int* saida) {
+	__m256i base = _mm256_set1_epi32(menor);
+	__m256i limite = _mm256_set1_epi32((int) ((unsigned) maior - (unsigned) menor));
+	int qtd = 0;
+	int i = 0;
+	for (; i + 8 <= n; i += 8) {
+		__m256i x = _mm256_loadu_si256((const __m256i*) (v + i));
+
+		/* Mesmo teste da versão escalar: x - menor <= maior - menor, sem sinal (a <= b se min(a, b) == a). */
+		__m256i d = _mm256_sub_epi32(x, base);
+		__m256i aprovados = _mm256_cmpeq_epi32(_mm256_min_epu32(d, limite), d);
+		int mascara = _mm256_movemask_ps(_mm256_castsi256_ps(aprovados));
+
+		/* Grava o bloco inteiro, com os aprovados no início; os demais são sobrescritos depois. */
+		__m256i ordem = _mm256_load_si256((const __m256i*) compactacao[mascara]);
+		_mm256_storeu_si256((__m256i*) (saida + qtd), _mm256_permutevar8x32_epi32(x, ordem));
+		qtd += __builtin_popcount(mascara);
+	}
+	return qtd + filtro_escalar(v + i, n - i, menor, maior, saida + qtd);
+}
+
+/* Versões AVX-512: blocos de 16 elementos (512 bits), com as comparações gerando máscaras de bits. */
+
+#define AVX512 __attribute__((target("avx512f,popcnt,bmi")))
+
+AVX512 static int primeiro_avx512(const int* v, int n, int item) {
+	__m512i alvo = _mm512_set1_epi32(item);
+	int i = 0;
+	for (; i + 64 <= n; i += 64) {
+		__mmask16 m0 = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(v + i), alvo);
+		__mmask16 m1 = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(v + i + 16), alvo);
+		__mmask16 m2 = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(v + i + 32), alvo);
+		__mmask16 m3 = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(v + i + 48), alvo);
+		if ((m0 | m1 | m2 | m3) != 0) {
+			break;
+		}
+	}
+	for (; i + 16 <= n; i += 16) {
+		__mmask16 mascara = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(v + i), alvo);
+		if (mascara != 0) {
+			return i + __builtin_ctz(mascara);
+		}
+	}
+	int pos = primeiro_escalar(v + i, n - i, item);
+	return (pos < 0) ? -1 : i + pos;
+}
+
+AVX512 static int ocorrencias_avx512(const int* v, int n, int item) {
+	__m512i alvo = _mm512_set1_epi32(item);
+	int qtd = 0;
+	int i = 0;
+	for (; i + 16 <= n; i += 16) {
+		qtd += __builtin_popcount(_mm512_cmpeq_epi32_mask(_mm512_loadu_si512(v + i), alvo));
+	}
+	return qtd + ocorrencias_escalar(v + i, n - i, item);
+}
+
+AVX512 static long long soma_avx512(const int* v, int n) {
+	__m512i soma0 = _mm512_setzero_si512();
+	__m512i soma1 = _mm512_setzero_si512();
+	int i = 0;
+	for (; i + 16 <= n; i += 16) {
+		__m512i x = _mm512_loadu_si512(v + i);
+		soma0 = _mm512_add_epi64(soma0, _mm512_cvtepi32_epi64(_mm512_castsi512_si256(x)));
+		soma1 = _mm512_add_epi64(soma1, _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(x, 1)));
+	}
+	return _mm512_reduce_add_epi64(_mm512_add_epi64(soma0, soma1)) + soma_escalar(v + i, n - i);
+}
+
+AVX512 static int minimo_avx512(const int* v, int n) {
+	if (n < 16) {
+		return minimo_escalar(v, n);
+	}
+	__m512i menor = _mm512_loadu_si512(v);
+	for (int i = 16; i + 16 <= n; i += 16) {
+		menor = _mm512_min_epi32(menor, _mm512_loadu_si512(v + i));
+	}
+	menor = _mm512_min_epi32(menor, _mm512_loadu_si512(v + n - 16));
+	return _mm512_reduce_min_epi32(menor);
+}
+
+AVX512 static int maximo_avx512(const int* v, int n) {
+	if (n < 16) {
+		return maximo_escalar(v, n);
+	}
+	__m512i maior = _mm512_loadu_si512(v);
+	for (int i = 16; i + 16 <= n; i += 16) {
+		maior = _mm512_max_epi32(maior, _mm512_loadu_si512(v + i));
+	}
+	maior = _mm512_max_epi32(maior, _mm512_loadu_si512(v + n - 16));
+	return _mm512_reduce_max_epi32(maior);
+}
+
+AVX512 static int filtro_avx512(const int* v, int n, int menor, int maior, int* saida) {
+	__m512i base = _mm512_set1_epi32(menor);
+	__m512i limite = _mm512_set1_epi32((int) ((unsigned) maior - (unsigned) menor));
+	int qtd = 0;
+	int i = 0;
+	for (; i + 16 <= n; i += 16) {
+		__m512i x = _mm512_loadu_si512(v + i);
+		__mmask16 mascara = _mm512_cmple_epu32_mask(_mm512_sub_epi32(x, base), limite);
+
+		/*
+		 * Junta os aprovados em um registrador e grava o bloco inteiro. A gravação compactada direto
+		 * na memória (vpcompressd com destino na memória) é bem mais lenta em alguns processadores.
+		 */
+		_mm512_storeu_si512(saida + qtd, _mm512_maskz_compress_epi32(mascara, x));
+		qtd += __builtin_popcount(mascara);
+	}
+	return qtd + filtro_escalar(v + i, n - i, menor, maior, saida + qtd);
+}
+
+#endif
+
+static const Kernels KERNELS[] = {
+	{primeiro_escalar, ocorrencias_escalar, soma_escalar, minimo_escalar, maximo_escalar, filtro_escalar},
+#ifdef VARREDURA_X86
+	{primeiro_avx2, ocorrencias_avx2, soma_avx2, minimo_avx2, maximo_avx2, filtro_avx2},
+	{primeiro_avx512, ocorrencias_avx512, soma_avx512, minimo_avx512, maximo_avx512, filtro_avx512},
+#endif
+};
+
+/* Retorna o maior nível suportado pelo processador, já preparando as tabelas que ele usa. */
+static NivelSimd detectar_nivel() {
+#ifdef VARREDURA_X86
+	__builtin_cpu_init();
+	bool avx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt") && __builtin_cpu_supports("bmi");
+	if (avx2) {
+		preencher_compactacao();
+		return __builtin_cpu_supports("avx512f") ? SIMD_AVX512 : SIMD_AVX2;
+	}
+#endif
+	return SIMD_ESCALAR;
+}
+
+/*
+ * Nível suportado e rotinas em uso. As variáveis locais estáticas são inicializadas na primeira
+ * chamada, de forma segura mesmo com várias threads, e antes de qualquer uso, ao contrário das
+ * globais, cuja ordem de inicialização entre arquivos não é definida.
+ */
+static NivelSimd nivel_maximo() {
+	static const NivelSimd nivel = detectar_nivel();
+	return nivel;
+}
+
+static NivelSimd& nivel_atual() {
+	static NivelSimd nivel = nivel_maximo();
+	return nivel;
+}
+
+bool nivel_simd_suportado(NivelSimd nivel) {
+	return (nivel <= nivel_maximo());
+}
+
+NivelSimd obter_nivel_simd() {
+	return nivel_atual();
+}
+
+void definir_nivel_simd(NivelSimd nivel) {
+	assert(nivel_simd_suportado(nivel));
+
+	nivel_atual() = nivel;
+}
+
+int varrer_primeiro(Trechos t, int item) {
+	const Kernels* k = &KERNELS[nivel_atual()];
+	int pos = k->primeiro(t.a, t.na, item);
+	if ((pos >= 0) || (t.nb == 0)) {
+		return pos;
+	}
+	pos = k->primeiro(t.b, t.nb, item);
+	return (pos < 0) ? -1 : t.na + pos;
+}
+
+int varrer_ocorrencias(Trechos t, int item) {
+	const Kernels* k = &KERNELS[nivel_atual()];
+	return k->ocorrencias(t.a, t.na, item) + k->ocorrencias(t.b, t.nb, item);
+}
+
+long long varrer_soma(Trechos t) {
+	const Kernels* k = &KERNELS[nivel_atual()];
+	return k->soma(t.a, t.na) + k->soma(t.b, t.nb);
+}
+
+int varrer_minimo(Trechos t) {
+	assert(t.na + t.nb > 0);
+
+	const Kernels* k = &KERNELS[nivel_atual()];
+	if (t.nb == 0) {
+		return k->minimo(t.a, t.na);
+	}
+	if (t.na == 0) {
+		return k->minimo(t.b, t.nb);
+	}
+	int menor_a = k->minimo(t.a, t.na);
+	int menor_b = k->minimo(t.b, t.nb);
+	return (menor_a < menor_b) ? menor_a : menor_b;
+}
+
+int varrer_maximo(Trechos t) {
+	assert(t.na + t.nb > 0);
+
+	const Kernels* k = &KERNELS[nivel_atual()];
+	if (t.nb == 0) {
+		return k->maximo(t.a, t.na);
+	}
+	if (t.na == 0) {
+		return k->maximo(t.b, t.nb);
+	}
+	int maior_a = k->maximo(t.a, t.na);
+	int maior_b = k->maximo(t.b, t.nb);
+	return (maior_a > maior_b) ? maior_a : maior_b;
+}
+
+int varrer_filtro(Trechos t, int menor, int maior, int* saida) {
+	assert(menor <= maior);
+
+	const Kernels* k = &KERNELS[nivel_atual()];
+	int qtd = k->filtro(t.a, t.na, menor, maior, saida);
+	return qtd + k->filtro(t.b, t.nb, menor, maior, saida + qtd);
+}
@@ -0,0 +1,119 @@
+/**
+ * \file varredura.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Interface das varreduras vetorizadas (SIMD) de vetores de int
+ *
+ * Disponibiliza as rotinas usadas internamente pelas consultas em bloco da ListaVet, da FilaVet e
+ * da FilaDVet (buscar_primeiro, contar_ocorrencias, somar, minimo, maximo e filtrar). Cada rotina
+ * percorre até dois trechos contíguos de um vetor, como se fossem um só: o vetor circular das filas
+ * e o vetor da ListaVet no modo lacuna guardam os elementos em dois trechos.
+ *
+ * Há três versões de cada rotina: uma escalar, em C++ comum, e duas que processam 8 (AVX2) ou 16
+ * (AVX-512) elementos por instrução. As versões vetorizadas só são compiladas com o GCC ou o Clang
+ * em processadores x86 e são escolhidas na primeira chamada, conforme as instruções que o
+ * processador suporta. Como cada uma é compilada com o atributo "target", a biblioteca não precisa
+ * de opções como -mavx2 e continua funcionando em processadores sem essas instruções.
+ */
+
+#ifndef VARREDURA_HPP
+#define VARREDURA_HPP
+
+/**
+ * \enum NivelSimd
+ * \brief Conjuntos de instruções que as varreduras podem usar.
+ */
+enum NivelSimd {
+	SIMD_ESCALAR, /**< Versões em C++ comum, disponíveis em qualquer processador. */
+	SIMD_AVX2, /**< Versões com instruções AVX2 (8 elementos por instrução). */
+	SIMD_AVX512 /**< Versões com instruções AVX-512 (16 elementos por instrução). */
+};
+
+/**
+ * \struct Trechos
+ * \brief Sequência formada pelos elementos a[0, na) seguidos dos elementos b[0, nb).
+ *
+ * Quando os elementos estão em um único trecho, b é ignorado e nb deve ser 0.
+ */
+struct Trechos {
+	const int* a; /**< Primeiro trecho. */
+	int na; /**< Quantidade de elementos do primeiro trecho. */
+	const int* b; /**< Segundo trecho. */
+	int nb; /**< Quantidade de elementos do segundo trecho. */
+};
+
+/**
+ * \brief Indica se o processador (e a compilação) permitem usar o nível informado.
+ *
+ * \param nivel representa o nível consultado.
+ *
+ * \return \p true, se as versões do nível puderem ser usadas, ou \p false, caso contrário.
+ */
+bool nivel_simd_suportado(NivelSimd nivel);
+
+/**
+ * \brief Retorna o nível usado pelas varreduras: o maior suportado, a menos que outro tenha sido
+ * escolhido com \p definir_nivel_simd.
+ *
+ * \return O nível em uso.
+ */
+NivelSimd obter_nivel_simd();
+
+/**
+ * \brief Escolhe o nível usado pelas varreduras, por exemplo, para comparar as versões.
+ *
+ * A escolha vale para todas as EDs e não deve ser feita enquanto outras threads as consultam.
+ *
+ * \pre O nível deve ser suportado (veja \p nivel_simd_suportado).
+ *
+ * \param nivel representa o nível a ser usado.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado, caso o nível não seja suportado.
+ */
+void definir_nivel_simd(NivelSimd nivel);
+
+/**
+ * \brief Retorna a posição da primeira ocorrência de \p item em \p t.
+ *
+ * \return A posição (no intervalo [0, t.na + t.nb - 1]) ou -1, se \p item não for encontrado.
+ */
+int varrer_primeiro(Trechos t, int item);
+
+/**
+ * \brief Retorna a quantidade de ocorrências de \p item em \p t.
+ */
+int varrer_ocorrencias(Trechos t, int item);
+
+/**
+ * \brief Retorna a soma dos elementos de \p t, sem estouro.
+ */
+long long varrer_soma(Trechos t);
+
+/**
+ * \brief Retorna o menor elemento de \p t.
+ *
+ * \pre A sequência não deve estar vazia (t.na + t.nb > 0).
+ */
+int varrer_minimo(Trechos t);
+
+/**
+ * \brief Retorna o maior elemento de \p t.
+ *
+ * \pre A sequência não deve estar vazia (t.na + t.nb > 0).
+ */
+int varrer_maximo(Trechos t);
+
+/**
+ * \brief Copia para \p saida, na ordem, os elementos de \p t que estão no intervalo [menor, maior].
+ *
+ * \pre menor <= maior, e \p saida deve ter espaço para t.na + t.nb elementos: as versões vetorizadas
+ * 		gravam blocos inteiros, e as posições após os elementos copiados podem ser sobrescritas.
+ *
+ * \return A quantidade de elementos copiados.
+ */
+int varrer_filtro(Trechos t, int menor, int maior, int* saida);
+
+#endif
+
@@ -0,0 +1,42 @@
+/**
+ * \file auxiliares.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Funções auxiliares comuns a todos os programas de medição de desempenho das EDs
+ *
+ * Ao contrário de medicao.hpp, este arquivo não substitui os operadores globais "new" e "delete",
+ * por isso pode ser incluído também pelos programas que fazem a sua própria contagem de memória.
+ */
+
+#ifndef AUXILIARES_HPP
+#define AUXILIARES_HPP
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+namespace medicao {
+
+/** \brief Variável onde as medições devem acumular os resultados, para que o compilador não descarte as operações. */
+inline volatile long long sumidouro;
+
+/** \brief Retorna o instante atual, em nanossegundos, de um relógio monotônico. */
+inline double agora_ns() {
+	return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/** \brief Informa, na saída de erro, que uma conferência falhou e encerra o programa. */
+[[noreturn]] inline void falhar(const char* mensagem) {
+	fprintf(stderr, "%s\n", mensagem);
+	exit(EXIT_FAILURE);
+}
+
+/** \brief Informa, na saída de erro, que uma conferência da ED \p nome falhou e encerra o programa. */
+[[noreturn]] inline void falhar(const char* nome, const char* mensagem) {
+	fprintf(stderr, "%s: %s\n", nome, mensagem);
+	exit(EXIT_FAILURE);
+}
+
+}
+
+#endif
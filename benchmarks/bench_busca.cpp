@@ -0,0 +1,228 @@
+/**
+ * \file bench_busca.cpp
+ * \brief Compara as buscas na ListaVet ordenada com a busca linear e com std::lower_bound.
+ *
+ * Compilação (a partir da raiz do repositório):
+ * \code {.unparsed}
+ *     g++ -O2 -DNDEBUG -DTAM_MAX_LISTAVET=134217728 -Iarray benchmarks/bench_busca.cpp array/listavet.cpp \
+ *         array/ordenacao.cpp array/varredura.cpp -o bench_busca
+ * \endcode
+ *
+ * Uso: bench_busca [--tam-max=N] (padrão: 100 milhões, limitado por TAM_MAX_LISTAVET). Com 100
+ * milhões de elementos, o programa usa cerca de 1,6 GB de memória: a lista, o índice de Eytzinger
+ * (valores e posições) e o std::vector da comparação.
+ *
+ * Para cada tamanho, de 100 elementos até o máximo, a lista recebe os números pares 0, 2, 4, ... e
+ * cada método responde às mesmas 2^20 consultas aleatórias (metade delas, em média, de números
+ * presentes), cujo resultado é o limite inferior do número consultado:
+ * - linear: percorre a lista com obter até encontrar um elemento não menor (como antes, sem as
+ *   funções de busca); por ser O(n), usa menos consultas e só é medida até 1 milhão de elementos;
+ * - std::lower_bound: sobre uma cópia dos elementos em um std::vector;
+ * - binaria: limite_inferior, com a busca binária sem desvios;
+ * - eytzinger: limite_inferior com o índice de Eytzinger ativado (construído antes da medição).
+ *
+ * Enquanto a lista cabe nas caches, a busca binária sem desvios é a mais rápida, pois não erra
+ * previsões de desvio. Nas listas com milhões de elementos, o tempo passa a ser dominado pelas faltas
+ * de cache: a busca sem desvios chega a perder para std::lower_bound, cujos desvios permitem ao
+ * processador antecipar leituras especulativamente, e o índice de Eytzinger, que pede os nós dos
+ * próximos níveis antes de precisar deles, é o mais rápido.
+ *
+ * Antes das medições, a ListaVet (alternando os modos lacuna e o índice) recebe uma sequência
+ * aleatória de operações ordenadas, conferidas com um std::vector; qualquer divergência encerra o
+ * programa. Nas medições, a soma dos resultados de cada método é conferida com a de std::lower_bound.
+ */
+
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "auxiliares.hpp"
+#include "listavet.hpp"
+
+using namespace std;
+using medicao::agora_ns;
+using medicao::falhar;
+using medicao::sumidouro;
+
+static const int QTD_CONSULTAS = 1 << 20;
+static const int TAM_CONFERENCIA = (TAM_MAX_LISTAVET < 2000) ? TAM_MAX_LISTAVET : 2000;
+static const long TAM_MAX_LINEAR = 1000000;
+
+static unsigned semente = 2026;
+
+static int sortear(int n) {
+	semente = semente * 1103515245u + 12345u;
+	return (int) ((semente >> 8) % (unsigned) n);
+}
+
+/* Sorteia um número de 0 a n - 1 para n maior que 2^24, que sortear não alcança. */
+static int sortear_grande(int n) {
+	return (int) (((long long) sortear(1 << 16) << 16 | sortear(1 << 16)) % n);
+}
+
+/* Sorteia um item para a conferência, incluindo de vez em quando os extremos de int. */
+static int sortear_item() {
+	int op = sortear(100);
+	if (op == 0) {
+		return INT_MAX;
+	}
+	if (op == 1) {
+		return INT_MIN;
+	}
+	return sortear(101) - 50;
+}
+
+static void conferir() {
+	ListaVet* li = criar_lista();
+	vector<int> v;
+	for (int i = 0; i < 200000; i++) {
+		if (i % 5000 == 0) {
+			definir_modo_lacuna(li, sortear(2) == 0);
+			definir_indice_eytzinger(li, sortear(2) == 0);
+		}
+
+		int item = sortear_item();
+		int op = sortear(6);
+		int inf = (int) (lower_bound(v.begin(), v.end(), item) - v.begin());
+		int sup = (int) (upper_bound(v.begin(), v.end(), item) - v.begin());
+		bool presente = (inf < sup);
+
+		if (op == 0 && (int) v.size() < TAM_CONFERENCIA) {
+			if (inserir_ordenado(li, item) != sup) {
+				falhar("inserir_ordenado: posicao divergente");
+			}
+			v.insert(v.begin() + sup, item);
+		} else if (op == 1) {
+			if (remover_valor(li, item) != presente) {
+				falhar("remover_valor divergente");
+			}
+			if (presente) {
+				v.erase(v.begin() + inf);
+			}
+		} else if (op == 2) {
+			if (buscar(li, item) != (presente ? inf : -1) || contem(li, item) != presente) {
+				falhar("buscar/contem divergente");
+			}
+		} else if (op == 3) {
+			if (limite_inferior(li, item) != inf || limite_superior(li, item) != sup) {
+				falhar("limite_inferior/limite_superior divergente");
+			}
+		} else if (op == 4 && !v.empty()) {
+			/* Remoção por posição, que também desatualiza o índice. */
+			int pos = sortear((int) v.size());
+			if (remover(li, pos) != v[pos]) {
+				falhar("remover divergente");
+			}
+			v.erase(v.begin() + pos);
+		}
+
+		if (obter_tamanho(li) != (int) v.size()) {
+			falhar("Tamanho divergente");
+		}
+	}
+	for (int i = 0; i < obter_tamanho(li); i++) {
+		if (obter(li, i) != v[i]) {
+			falhar("Elementos divergentes");
+		}
+	}
+	liberar_lista(li);
+	printf("Conferencia das operacoes ordenadas da ListaVet: sem divergencias.\n\n");
+}
+
+static long long buscar_linear(ListaVet* li, const vector<int>& consultas, int qtd) {
+	long long soma = 0;
+	int n = obter_tamanho(li);
+	for (int q = 0; q < qtd; q++) {
+		int pos = 0;
+		while (pos < n && obter(li, pos) < consultas[q]) {
+			pos++;
+		}
+		soma += pos;
+	}
+	return soma;
+}
+
+static long long buscar_std(const vector<int>& v, const vector<int>& consultas, int qtd) {
+	long long soma = 0;
+	for (int q = 0; q < qtd; q++) {
+		soma += lower_bound(v.begin(), v.end(), consultas[q]) - v.begin();
+	}
+	return soma;
+}
+
+static long long buscar_lista(ListaVet* li, const vector<int>& consultas, int qtd) {
+	long long soma = 0;
+	for (int q = 0; q < qtd; q++) {
+		soma += limite_inferior(li, consultas[q]);
+	}
+	return soma;
+}
+
+/* Mede um método e confere a soma dos resultados; retorna o tempo médio por consulta. */
+template <typename Metodo>
+static double medir(Metodo metodo, long long esperado, int qtd, const char* nome) {
+	double t0 = agora_ns();
+	long long soma = metodo();
+	double t = agora_ns() - t0;
+	if (soma != esperado) {
+		falhar(nome);
+	}
+	sumidouro = soma;
+	return t / qtd;
+}
+
+int main(int argc, char** argv) {
+	long tam_max = 100000000;
+	for (int i = 1; i < argc; i++) {
+		if (strncmp(argv[i], "--tam-max=", 10) == 0) {
+			tam_max = atol(argv[i] + 10);
+		} else {
+			fprintf(stderr, "Uso: %s [--tam-max=N]\n", argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+	if (tam_max > TAM_MAX_LISTAVET) {
+		tam_max = TAM_MAX_LISTAVET;
+	}
+
+	conferir();
+
+	printf("%12s %14s %14s %14s %14s   (ns por busca)\n", "tamanho", "linear", "lower_bound", "binaria", "eytzinger");
+	for (long n = 100; n <= tam_max; n *= 10) {
+		ListaVet* li = criar_lista();
+		vector<int> v(n);
+		for (long i = 0; i < n; i++) {
+			v[i] = (int) (2 * i);
+		}
+		inserir_intervalo(li, 0, v.data(), v.data() + n);
+
+		vector<int> consultas(QTD_CONSULTAS);
+		for (int q = 0; q < QTD_CONSULTAS; q++) {
+			consultas[q] = sortear_grande((int) (2 * n + 1));
+		}
+		long long esperado = buscar_std(v, consultas, QTD_CONSULTAS);
+
+		char linear[32] = "-";
+		if (n <= TAM_MAX_LINEAR) {
+			int qtd = (int) min((long) QTD_CONSULTAS, max(1000L, 200000000L / n));
+			double t = medir([&] { return buscar_linear(li, consultas, qtd); }, buscar_std(v, consultas, qtd),
+				qtd, "linear divergente");
+			snprintf(linear, sizeof(linear), "%.2f", t);
+		}
+		double t_std = medir([&] { return buscar_std(v, consultas, QTD_CONSULTAS); }, esperado,
+			QTD_CONSULTAS, "lower_bound divergente");
+		double t_binaria = medir([&] { return buscar_lista(li, consultas, QTD_CONSULTAS); }, esperado,
+			QTD_CONSULTAS, "binaria divergente");
+
+		definir_indice_eytzinger(li, true);
+		limite_inferior(li, 0);
+		double t_eytzinger = medir([&] { return buscar_lista(li, consultas, QTD_CONSULTAS); }, esperado,
+			QTD_CONSULTAS, "eytzinger divergente");
+
+		printf("%12ld %14s %14.2f %14.2f %14.2f\n", n, linear, t_std, t_binaria, t_eytzinger);
+		liberar_lista(li);
+	}
+	return EXIT_SUCCESS;
+}
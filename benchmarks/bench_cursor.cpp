@@ -0,0 +1,187 @@
+/**
+ * \file bench_cursor.cpp
+ * \brief Compara a soma de todos os elementos da ListaEnc e da ListaDEnc por índice e por cursor.
+ *
+ * Compilação (a partir da raiz do repositório):
+ * \code {.unparsed}
+ *     g++ -O2 -Iencadeada benchmarks/bench_cursor.cpp encadeada/listaenc.cpp \
+ *         encadeada/listadenc.cpp encadeada/poolnoh.cpp -o bench_cursor
+ * \endcode
+ *
+ * Antes das medições, as operações de cursor (inserção, remoção, retrocesso) e os iteradores
+ * (laço "for" e algoritmos da biblioteca padrão) são conferidos em listas pequenas; qualquer
+ * divergência encerra o programa.
+ *
+ * A soma é medida para 1 milhão de elementos de quatro formas: obter_elemento(li, i) em um laço,
+ * cursor (avancar/valor), laço "for (int x : li)" e std::accumulate. Na ListaEnc, o laço por índice
+ * é O(n^2): ele é medido com 20 mil elementos e o tempo para 1 milhão é estimado multiplicando-o
+ * por (1000000 / 20000)^2. Na ListaDEnc, o laço por índice aproveita o dedo e já é O(n).
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include "auxiliares.hpp"
+#include "listadenc.hpp"
+#include "listaenc.hpp"
+
+using namespace std;
+using medicao::agora_ns;
+using medicao::falhar;
+using medicao::sumidouro;
+
+static void conferir_listaenc() {
+	ListaEnc* li = criar_lista();
+	CursorEnc c = iniciar_cursor(li);
+	for (int i = 0; i < 10; i++) {
+		inserir_no_cursor(&c, i);
+	}
+	// Remove os pares: 1 3 5 7 9
+	for (c = iniciar_cursor(li); !cursor_no_fim(&c);) {
+		if (valor(&c) % 2 == 0) {
+			remover_no_cursor(&c);
+		} else {
+			avancar(&c);
+		}
+	}
+	// Insere 100 antes do 5: 1 3 100 5 7 9
+	c = iniciar_cursor(li);
+	avancar(&c);
+	avancar(&c);
+	inserir_no_cursor(&c, 100);
+	const int esperado[] = {1, 3, 100, 5, 7, 9};
+	if (obter_tamanho(li) != 6 || !equal(begin(li), end(li), esperado)) {
+		falhar("ListaEnc: cursor divergente");
+	}
+	fill(begin(li), end(li), 7);
+	if (count(begin(li), end(li), 7) != 6 || find(begin(li), end(li), 100) != end(li)) {
+		falhar("ListaEnc: iteradores divergentes");
+	}
+	while (!estah_vazia(li)) {
+		c = iniciar_cursor(li);
+		remover_no_cursor(&c);
+	}
+	liberar_lista(li);
+}
+
+static void conferir_listadenc() {
+	ListaDEnc* li = criar_listad();
+	CursorDEnc c = iniciar_cursor(li);
+	for (int i = 0; i < 10; i++) {
+		inserir_no_cursor(&c, i);
+	}
+	for (c = iniciar_cursor(li); !cursor_no_fim(&c);) {
+		if (valor(&c) % 2 == 0) {
+			remover_no_cursor(&c);
+		} else {
+			avancar(&c);
+		}
+	}
+	c = cursor_no_fim_da_lista(li);
+	retroceder(&c);
+	retroceder(&c);
+	inserir_no_cursor(&c, 100);
+	// 1 3 5 100 7 9; o acesso por posição deve continuar coerente com o dedo
+	const int esperado[] = {1, 3, 5, 100, 7, 9};
+	for (int i = 0; i < 6; i++) {
+		if (obter_elemento(li, i) != esperado[i]) {
+			falhar("ListaDEnc: cursor divergente do acesso por posição");
+		}
+	}
+	reverse(begin(li), end(li));
+	int i = 5;
+	for (int x : li) {
+		if (x != esperado[i--]) {
+			falhar("ListaDEnc: iteradores divergentes");
+		}
+	}
+	c = cursor_no_fim_da_lista(li);
+	i = 0;
+	while (retroceder(&c)) {
+		if (valor(&c) != esperado[i++]) {
+			falhar("ListaDEnc: retroceder divergente");
+		}
+	}
+	if (i != 6 || obter_inicio(li) != 9 || obter_fim(li) != 1) {
+		falhar("ListaDEnc: extremidades divergentes");
+	}
+	liberar_lista(li);
+}
+
+template <typename Lista>
+static double somar_por_indice(Lista* li, int n) {
+	double t0 = agora_ns();
+	long long soma = 0;
+	for (int i = 0; i < n; i++) {
+		soma += obter_elemento(li, i);
+	}
+	sumidouro = soma;
+	return (agora_ns() - t0) / 1e6;
+}
+
+template <typename Lista, typename Cursor>
+static double somar_por_cursor(Lista* li) {
+	double t0 = agora_ns();
+	long long soma = 0;
+	for (Cursor c = iniciar_cursor(li); !cursor_no_fim(&c); avancar(&c)) {
+		soma += valor(&c);
+	}
+	sumidouro = soma;
+	return (agora_ns() - t0) / 1e6;
+}
+
+template <typename Lista>
+static double somar_por_for(Lista* li) {
+	double t0 = agora_ns();
+	long long soma = 0;
+	for (int x : li) {
+		soma += x;
+	}
+	sumidouro = soma;
+	return (agora_ns() - t0) / 1e6;
+}
+
+template <typename Lista>
+static double somar_por_accumulate(Lista* li) {
+	double t0 = agora_ns();
+	sumidouro = accumulate(begin(li), end(li), 0LL);
+	return (agora_ns() - t0) / 1e6;
+}
+
+int main() {
+	conferir_listaenc();
+	conferir_listadenc();
+	printf("Conferencia dos cursores e iteradores: sem divergencias.\n\n");
+
+	const int n = 1000000;
+	const int n_indice = 20000;
+
+	ListaEnc* enc = criar_lista();
+	CursorEnc ce = iniciar_cursor(enc);
+	for (int i = 0; i < n_indice; i++) {
+		inserir_no_cursor(&ce, i);
+	}
+	double t_pequeno = somar_por_indice(enc, n_indice);
+	double fator = ((double) n / n_indice) * ((double) n / n_indice);
+	for (int i = n_indice; i < n; i++) {
+		inserir_no_cursor(&ce, i);
+	}
+
+	ListaDEnc* denc = criar_listad();
+	for (int i = 0; i < n; i++) {
+		inserir_no_fim(denc, i);
+	}
+
+	printf("Soma de %d elementos (ms)\n", n);
+	printf("%-10s | %14s %10s %10s %12s\n", "lista", "indice", "cursor", "for", "accumulate");
+	printf("%-10s | %10.0f (*) %10.2f %10.2f %12.2f\n", "ListaEnc", t_pequeno * fator,
+		   somar_por_cursor<ListaEnc, CursorEnc>(enc), somar_por_for(enc), somar_por_accumulate(enc));
+	printf("%-10s | %14.2f %10.2f %10.2f %12.2f\n", "ListaDEnc", somar_por_indice(denc, n),
+		   somar_por_cursor<ListaDEnc, CursorDEnc>(denc), somar_por_for(denc), somar_por_accumulate(denc));
+	printf("(*) estimado a partir de %.2f ms medidos com %d elementos.\n", t_pequeno, n_indice);
+
+	liberar_lista(enc);
+	liberar_lista(denc);
+	return EXIT_SUCCESS;
+}
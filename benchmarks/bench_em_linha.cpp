@@ -0,0 +1,221 @@
+/**
+ * \file bench_em_linha.cpp
+ * \brief Mede os laços curtos da PilhaVet, da FilaVet e da FilaDVet nos modos opaco e em linha.
+ *
+ * Compilação (a partir da raiz do repositório), uma vez em cada modo:
+ * \code {.unparsed}
+ *     g++ -O2 -DNDEBUG -Iarray benchmarks/bench_em_linha.cpp array/pilhavet.cpp array/filavet.cpp \
+ *         array/filadvet.cpp array/varredura.cpp -o bench_opaco
+ *     g++ -O2 -DNDEBUG -DESTRUTURAS_EM_LINHA -Iarray benchmarks/bench_em_linha.cpp array/pilhavet.cpp \
+ *         array/filavet.cpp array/filadvet.cpp array/varredura.cpp -o bench_em_linha
+ * \endcode
+ *
+ * No modo opaco (padrão), cada empilhar, inserir, obter_topo etc. é uma chamada a uma função de
+ * outro arquivo, que o compilador não consegue expandir sem otimização na ligação (LTO). No modo
+ * em linha (ESTRUTURAS_EM_LINHA), essas operações são expandidas nos laços e os acessos aos campos
+ * das EDs podem ser mantidos em registradores; em alguns laços, o compilador chega a eliminar
+ * leituras de elementos que acabaram de ser gravados. Por isso, no CMake, o programa do modo
+ * opaco (bench_opaco) é compilado sem LTO.
+ *
+ * Antes das medições, as EDs recebem uma sequência aleatória de operações e são conferidas com EDs
+ * da biblioteca padrão; qualquer divergência encerra o programa. Cada medição executa 2^24
+ * operações com a ED contendo no máximo 64 elementos (o que cabe nas capacidades padrão).
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <vector>
+#include "auxiliares.hpp"
+#include "filadvet.hpp"
+#include "filavet.hpp"
+#include "pilhavet.hpp"
+
+using namespace std;
+using medicao::agora_ns;
+using medicao::falhar;
+using medicao::sumidouro;
+
+static const int TOTAL = 1 << 24;
+static const int OCUPACAO = 64;
+
+static unsigned semente = 2026;
+
+static int sortear(int n) {
+	semente = semente * 1103515245u + 12345u;
+	return (int) ((semente >> 8) % (unsigned) n);
+}
+
+static void conferir() {
+	PilhaVet* p = criar_pilha();
+	FilaVet* f = criar_fila();
+	FilaDVet* d = criar_fila_d();
+	vector<int> pilha;
+	deque<int> fila;
+	deque<int> fila_d;
+	for (int i = 0; i < 200000; i++) {
+		bool inserir_agora = (sortear(2) == 0);
+
+		if (inserir_agora && !estah_cheia(p)) {
+			empilhar(p, i);
+			pilha.push_back(i);
+		} else if (!estah_vazia(p)) {
+			if (obter_topo(p) != pilha.back() || desempilhar(p) != pilha.back()) {
+				falhar("PilhaVet divergente");
+			}
+			pilha.pop_back();
+		}
+
+		if (inserir_agora && !estah_cheia(f)) {
+			inserir(f, i);
+			fila.push_back(i);
+		} else if (!estah_vazia(f)) {
+			if (obter_inicio(f) != fila.front() || remover(f) != fila.front()) {
+				falhar("FilaVet divergente");
+			}
+			fila.pop_front();
+		}
+
+		int op = sortear(4);
+		if (op < 2 && !estah_cheia(d)) {
+			if (op == 0) {
+				inserir_no_fim(d, i);
+				fila_d.push_back(i);
+			} else {
+				inserir_no_inicio(d, i);
+				fila_d.push_front(i);
+			}
+		} else if (op >= 2 && !estah_vazia(d)) {
+			if (obter_inicio(d) != fila_d.front() || obter_fim(d) != fila_d.back()) {
+				falhar("FilaDVet divergente (extremidades)");
+			}
+			if (op == 2) {
+				if (remover_do_inicio(d) != fila_d.front()) {
+					falhar("FilaDVet divergente (inicio)");
+				}
+				fila_d.pop_front();
+			} else {
+				if (remover_do_fim(d) != fila_d.back()) {
+					falhar("FilaDVet divergente (fim)");
+				}
+				fila_d.pop_back();
+			}
+		}
+
+		if (estah_vazia(p) != pilha.empty() || estah_vazia(f) != fila.empty() || estah_vazia(d) != fila_d.empty()) {
+			falhar("Estado divergente (vazia)");
+		}
+	}
+	liberar_pilha(p);
+	liberar_fila(f);
+	liberar_fila(d);
+	printf("Conferencia da PilhaVet, da FilaVet e da FilaDVet: sem divergencias.\n\n");
+}
+
+/* Empilha e desempilha blocos de OCUPACAO elementos. */
+static double pilha_empilhar_desempilhar() {
+	PilhaVet* p = criar_pilha();
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int k = 0; k < TOTAL; k += 2 * OCUPACAO) {
+		for (int j = 0; j < OCUPACAO; j++) {
+			empilhar(p, j);
+		}
+		while (!estah_vazia(p)) {
+			soma += desempilhar(p);
+		}
+	}
+	double t = agora_ns() - t0;
+	sumidouro = soma;
+	liberar_pilha(p);
+	return t / TOTAL;
+}
+
+/*
+ * Nas consultas, o endereço da ED é lido de uma variável "volatile" a cada iteração. Sem isso, no
+ * modo em linha, o compilador percebe que o laço não altera a ED e faz a leitura uma única vez.
+ */
+static double pilha_obter_topo() {
+	PilhaVet* p = criar_pilha();
+	empilhar(p, 1);
+	PilhaVet* volatile endereco = p;
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int k = 0; k < TOTAL; k++) {
+		soma += obter_topo(endereco);
+	}
+	double t = agora_ns() - t0;
+	sumidouro = soma;
+	liberar_pilha(p);
+	return t / TOTAL;
+}
+
+/* Insere um elemento e remove outro, com a fila mantendo OCUPACAO elementos. */
+static double fila_inserir_remover() {
+	FilaVet* f = criar_fila();
+	for (int j = 0; j < OCUPACAO; j++) {
+		inserir(f, j);
+	}
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int k = 0; k < TOTAL; k += 2) {
+		inserir(f, k);
+		soma += remover(f);
+	}
+	double t = agora_ns() - t0;
+	sumidouro = soma;
+	liberar_fila(f);
+	return t / TOTAL;
+}
+
+static double fila_d_inserir_inicio_remover_fim() {
+	FilaDVet* d = criar_fila_d();
+	for (int j = 0; j < OCUPACAO; j++) {
+		inserir_no_fim(d, j);
+	}
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int k = 0; k < TOTAL; k += 2) {
+		inserir_no_inicio(d, k);
+		soma += remover_do_fim(d);
+	}
+	double t = agora_ns() - t0;
+	sumidouro = soma;
+	liberar_fila(d);
+	return t / TOTAL;
+}
+
+static double fila_d_obter_extremidades() {
+	FilaDVet* d = criar_fila_d();
+	for (int j = 0; j < OCUPACAO; j++) {
+		inserir_no_fim(d, j);
+	}
+	FilaDVet* volatile endereco = d;
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int k = 0; k < TOTAL; k += 2) {
+		FilaDVet* atual = endereco;
+		soma += obter_inicio(atual) + obter_fim(atual);
+	}
+	double t = agora_ns() - t0;
+	sumidouro = soma;
+	liberar_fila(d);
+	return t / TOTAL;
+}
+
+int main() {
+	conferir();
+
+#ifdef ESTRUTURAS_EM_LINHA
+	printf("Modo em linha (ESTRUTURAS_EM_LINHA definida)\n");
+#else
+	printf("Modo opaco\n");
+#endif
+	printf("%-46s %8.2f ns/op\n", "PilhaVet: empilhar/desempilhar", pilha_empilhar_desempilhar());
+	printf("%-46s %8.2f ns/op\n", "PilhaVet: obter_topo", pilha_obter_topo());
+	printf("%-46s %8.2f ns/op\n", "FilaVet: inserir + remover", fila_inserir_remover());
+	printf("%-46s %8.2f ns/op\n", "FilaDVet: inserir_no_inicio + remover_do_fim", fila_d_inserir_inicio_remover_fim());
+	printf("%-46s %8.2f ns/op\n", "FilaDVet: obter_inicio + obter_fim", fila_d_obter_extremidades());
+	return EXIT_SUCCESS;
+}
+
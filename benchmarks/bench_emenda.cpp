@@ -0,0 +1,307 @@
+/**
+ * \file bench_emenda.cpp
+ * \brief Compara a junção de listas e filas encadeadas elemento por elemento com as operações que
+ * apenas religam os nós (concatenar, dividir e transferir).
+ *
+ * Compilação (a partir da raiz do repositório):
+ * \code {.unparsed}
+ *     g++ -O2 -DNDEBUG -Iencadeada benchmarks/bench_emenda.cpp encadeada/poolnoh.cpp encadeada/filaenc.cpp \
+ *         encadeada/listaenc.cpp encadeada/listadenc.cpp -o bench_emenda
+ * \endcode
+ *
+ * Antes das medições, a ListaEnc, a ListaDEnc e a FilaEnc recebem uma sequência aleatória de
+ * operações, que inclui concatenar, dividir e transferir entre várias estruturas (algumas com pools
+ * compartilhados, para exercitar também a cópia feita quando os pools não podem ser unidos), e o
+ * resultado é conferido com uma ED da biblioteca padrão; qualquer divergência encerra o programa.
+ *
+ * Em seguida, são juntadas duas estruturas com 1 milhão de elementos cada: elemento por elemento
+ * (removendo do início de uma e inserindo no fim da outra), com remover_intervalo/inserir_intervalo
+ * (nas listas) e com concatenar. Também são medidos dividir no meio e transferir de um intervalo do
+ * meio. Cada medição é repetida e o menor tempo é informado.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <vector>
+#include "auxiliares.hpp"
+#include "filaenc.hpp"
+#include "listadenc.hpp"
+#include "listaenc.hpp"
+
+using namespace std;
+using medicao::agora_ns;
+using medicao::falhar;
+using medicao::sumidouro;
+
+static const int TAM_MEDICAO = 1000000;
+static const int REPETICOES = 5;
+static const int QTD_ESTRUTURAS = 4;
+
+static unsigned semente = 2026;
+
+static int sortear(int n) {
+	semente = semente * 1103515245u + 12345u;
+	return (int) ((semente >> 8) % (unsigned) n);
+}
+
+template <typename Lista>
+static void conferir_elementos(const char* nome, Lista* li, const vector<int>& v) {
+	if (obter_tamanho(li) != (int) v.size()) {
+		falhar(nome, "tamanho divergente");
+	}
+	if (!equal(begin(li), end(li), v.begin())) {
+		falhar(nome, "elementos divergentes");
+	}
+}
+
+/*
+ * Sequência aleatória de operações sobre QTD_ESTRUTURAS listas. Uma lista pode ser liberada e
+ * recriada vazia ou como o resultado de dividir outra lista, o que faz com que os pools passem a ser
+ * compartilhados de formas variadas.
+ */
+template <typename Lista>
+static void conferir_lista(const char* nome, Lista* (*criar)()) {
+	Lista* li[QTD_ESTRUTURAS];
+	vector<int> v[QTD_ESTRUTURAS];
+	for (int i = 0; i < QTD_ESTRUTURAS; i++) {
+		li[i] = criar();
+	}
+	int proximo = 0;
+	for (int passo = 0; passo < 100000; passo++) {
+		int a = sortear(QTD_ESTRUTURAS);
+		int b = (a + 1 + sortear(QTD_ESTRUTURAS - 1)) % QTD_ESTRUTURAS;
+		int tam_a = (int) v[a].size();
+		int tam_b = (int) v[b].size();
+		int op = sortear(8);
+		if (op <= 2 && tam_a < 2000) {
+			int pos = (sortear(2) == 0) ? tam_a : sortear(tam_a + 1);
+			inserir(li[a], proximo, pos);
+			v[a].insert(v[a].begin() + pos, proximo++);
+		} else if (op == 3 && tam_a > 0) {
+			int pos = (sortear(2) == 0) ? tam_a - 1 : sortear(tam_a);
+			if (remover(li[a], pos) != v[a][pos]) {
+				falhar(nome, "remover divergente");
+			}
+			v[a].erase(v[a].begin() + pos);
+		} else if (op == 4) {
+			concatenar(li[a], li[b]);
+			v[a].insert(v[a].end(), v[b].begin(), v[b].end());
+			v[b].clear();
+		} else if (op == 5) {
+			int pos = sortear(tam_a + 1);
+			liberar_lista(li[b]);
+			li[b] = dividir(li[a], pos);
+			v[b].assign(v[a].begin() + pos, v[a].end());
+			v[a].resize(pos);
+		} else if (op == 6) {
+			int pos = sortear(tam_a + 1);
+			int de = sortear(tam_b + 1);
+			int ate = de + sortear(tam_b - de + 1);
+			transferir(li[a], pos, li[b], de, ate);
+			v[a].insert(v[a].begin() + pos, v[b].begin() + de, v[b].begin() + ate);
+			v[b].erase(v[b].begin() + de, v[b].begin() + ate);
+		} else if (op == 7 && sortear(8) == 0) {
+			liberar_lista(li[a]);
+			li[a] = criar();
+			v[a].clear();
+		}
+		if (!v[a].empty() && obter_elemento(li[a], (int) v[a].size() - 1) != v[a].back()) {
+			falhar(nome, "ultimo elemento divergente");
+		}
+		if (passo % 64 == 0) {
+			conferir_elementos(nome, li[a], v[a]);
+			conferir_elementos(nome, li[b], v[b]);
+		}
+	}
+	for (int i = 0; i < QTD_ESTRUTURAS; i++) {
+		conferir_elementos(nome, li[i], v[i]);
+		liberar_lista(li[i]);
+	}
+}
+
+static void conferir_fila() {
+	FilaEnc* f[QTD_ESTRUTURAS];
+	deque<int> d[QTD_ESTRUTURAS];
+	for (int i = 0; i < QTD_ESTRUTURAS; i++) {
+		f[i] = criar_fila();
+	}
+	int proximo = 0;
+	for (int passo = 0; passo < 100000; passo++) {
+		int a = sortear(QTD_ESTRUTURAS);
+		int b = (a + 1 + sortear(QTD_ESTRUTURAS - 1)) % QTD_ESTRUTURAS;
+		int op = sortear(6);
+		if (op <= 2 && d[a].size() < 2000) {
+			inserir(f[a], proximo);
+			d[a].push_back(proximo++);
+		} else if (op == 3 && !d[a].empty()) {
+			if (remover(f[a]) != d[a].front()) {
+				falhar("FilaEnc", "remover divergente");
+			}
+			d[a].pop_front();
+		} else if (op == 4) {
+			concatenar(f[a], f[b]);
+			d[a].insert(d[a].end(), d[b].begin(), d[b].end());
+			d[b].clear();
+		} else if (op == 5 && sortear(8) == 0) {
+			liberar_fila(f[a]);
+			f[a] = criar_fila();
+			d[a].clear();
+		}
+		if (estah_vazia(f[a]) != d[a].empty() || (!d[a].empty() && obter_inicio(f[a]) != d[a].front())) {
+			falhar("FilaEnc", "inicio divergente");
+		}
+	}
+	// Esvazia as filas, conferindo todos os elementos
+	for (int i = 0; i < QTD_ESTRUTURAS; i++) {
+		while (!d[i].empty()) {
+			if (remover(f[i]) != d[i].front()) {
+				falhar("FilaEnc", "elementos divergentes");
+			}
+			d[i].pop_front();
+		}
+		if (!estah_vazia(f[i])) {
+			falhar("FilaEnc", "fila deveria estar vazia");
+		}
+		liberar_fila(f[i]);
+	}
+}
+
+static void conferir() {
+	conferir_lista("ListaEnc", criar_lista);
+	conferir_lista("ListaDEnc", criar_listad);
+	conferir_fila();
+	printf("Conferencia da ListaEnc, da ListaDEnc e da FilaEnc: sem divergencias.\n\n");
+}
+
+static vector<int> buffer(TAM_MEDICAO);
+
+template <typename Lista>
+static Lista* criar_preenchida(Lista* (*criar)(), int n) {
+	Lista* li = criar();
+	for (int i = 0; i < n; i++) {
+		buffer[i] = i;
+	}
+	inserir_intervalo(li, 0, buffer.data(), buffer.data() + n);
+	return li;
+}
+
+/* Modos de juntar duas listas medidos por medir_juncao. */
+enum Juncao { POR_ELEMENTO, POR_INTERVALO, CONCATENAR };
+
+/* Menor tempo, em ns, de juntar duas listas com TAM_MEDICAO elementos cada. */
+template <typename Lista>
+static double medir_juncao(Lista* (*criar)(), Juncao modo) {
+	double melhor = 1e300;
+	for (int r = 0; r < REPETICOES; r++) {
+		Lista* a = criar_preenchida(criar, TAM_MEDICAO);
+		Lista* b = criar_preenchida(criar, TAM_MEDICAO);
+		double t0 = agora_ns();
+		if (modo == POR_ELEMENTO) {
+			while (!estah_vazia(b)) {
+				inserir(a, remover(b, 0), obter_tamanho(a));
+			}
+		} else if (modo == POR_INTERVALO) {
+			int n = obter_tamanho(b);
+			remover_intervalo(b, 0, n, buffer.data());
+			inserir_intervalo(a, obter_tamanho(a), buffer.data(), buffer.data() + n);
+		} else {
+			concatenar(a, b);
+		}
+		melhor = min(melhor, agora_ns() - t0);
+		sumidouro = obter_tamanho(a);
+		liberar_lista(a);
+		liberar_lista(b);
+	}
+	return melhor;
+}
+
+/* Menor tempo, em ns, de dividir no meio uma lista com 2 * TAM_MEDICAO elementos. */
+template <typename Lista>
+static double medir_divisao(Lista* (*criar)()) {
+	double melhor = 1e300;
+	for (int r = 0; r < REPETICOES; r++) {
+		Lista* a = criar_preenchida(criar, TAM_MEDICAO);
+		Lista* b = criar_preenchida(criar, TAM_MEDICAO);
+		concatenar(a, b);
+		double t0 = agora_ns();
+		Lista* c = dividir(a, TAM_MEDICAO);
+		melhor = min(melhor, agora_ns() - t0);
+		sumidouro = obter_tamanho(c);
+		liberar_lista(a);
+		liberar_lista(b);
+		liberar_lista(c);
+	}
+	return melhor;
+}
+
+/* Menor tempo, em ns, de transferir os elementos [n/4, 3n/4) de uma lista para o meio de outra. */
+template <typename Lista>
+static double medir_transferencia(Lista* (*criar)()) {
+	double melhor = 1e300;
+	for (int r = 0; r < REPETICOES; r++) {
+		Lista* a = criar_preenchida(criar, TAM_MEDICAO);
+		Lista* b = criar_preenchida(criar, TAM_MEDICAO);
+		double t0 = agora_ns();
+		transferir(a, TAM_MEDICAO / 2, b, TAM_MEDICAO / 4, 3 * TAM_MEDICAO / 4);
+		melhor = min(melhor, agora_ns() - t0);
+		sumidouro = obter_tamanho(a);
+		liberar_lista(a);
+		liberar_lista(b);
+	}
+	return melhor;
+}
+
+static FilaEnc* criar_fila_preenchida(int n) {
+	FilaEnc* f = criar_fila();
+	for (int i = 0; i < n; i++) {
+		inserir(f, i);
+	}
+	return f;
+}
+
+static double medir_juncao_fila(bool por_elemento) {
+	double melhor = 1e300;
+	for (int r = 0; r < REPETICOES; r++) {
+		FilaEnc* a = criar_fila_preenchida(TAM_MEDICAO);
+		FilaEnc* b = criar_fila_preenchida(TAM_MEDICAO);
+		double t0 = agora_ns();
+		if (por_elemento) {
+			while (!estah_vazia(b)) {
+				inserir(a, remover(b));
+			}
+		} else {
+			concatenar(a, b);
+		}
+		melhor = min(melhor, agora_ns() - t0);
+		sumidouro = obter_inicio(a);
+		liberar_fila(a);
+		liberar_fila(b);
+	}
+	return melhor;
+}
+
+static void imprimir(const char* ed, const char* operacao, double ns) {
+	printf("%-10s %-36s %14.3f\n", ed, operacao, ns / 1e6);
+}
+
+int main() {
+	conferir();
+
+	printf("Tempo, em ms, com duas estruturas de %d elementos (menor de %d repeticoes):\n", TAM_MEDICAO, REPETICOES);
+	printf("%-10s %-36s %14s\n", "ED", "operacao", "ms");
+	imprimir("ListaEnc", "juntar elemento por elemento", medir_juncao(criar_lista, POR_ELEMENTO));
+	imprimir("ListaEnc", "juntar com remover/inserir_intervalo", medir_juncao(criar_lista, POR_INTERVALO));
+	imprimir("ListaEnc", "concatenar", medir_juncao(criar_lista, CONCATENAR));
+	imprimir("ListaEnc", "dividir no meio", medir_divisao(criar_lista));
+	imprimir("ListaEnc", "transferir metade para o meio", medir_transferencia(criar_lista));
+	imprimir("ListaDEnc", "juntar elemento por elemento", medir_juncao(criar_listad, POR_ELEMENTO));
+	imprimir("ListaDEnc", "juntar com remover/inserir_intervalo", medir_juncao(criar_listad, POR_INTERVALO));
+	imprimir("ListaDEnc", "concatenar", medir_juncao(criar_listad, CONCATENAR));
+	imprimir("ListaDEnc", "dividir no meio", medir_divisao(criar_listad));
+	imprimir("ListaDEnc", "transferir metade para o meio", medir_transferencia(criar_listad));
+	imprimir("FilaEnc", "juntar elemento por elemento", medir_juncao_fila(true));
+	imprimir("FilaEnc", "concatenar", medir_juncao_fila(false));
+	return EXIT_SUCCESS;
+}
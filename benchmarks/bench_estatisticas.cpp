@@ -0,0 +1,221 @@
+/**
+ * \file bench_estatisticas.cpp
+ * \brief Mede o custo dos contadores de uso (ESTRUTURAS_ESTATISTICAS) em operações curtas de array/.
+ *
+ * Compilação (a partir da raiz do repositório), uma vez em cada modo:
+ * \code {.unparsed}
+ *     g++ -O2 -DNDEBUG -Iarray benchmarks/bench_estatisticas.cpp array/pilhavet.cpp array/filadvet.cpp \
+ *         array/listacirc.cpp array/listavetdin.cpp array/varredura.cpp -o bench_sem_estatisticas
+ *     g++ -O2 -DNDEBUG -DESTRUTURAS_ESTATISTICAS -Iarray benchmarks/bench_estatisticas.cpp array/pilhavet.cpp \
+ *         array/filadvet.cpp array/listacirc.cpp array/listavetdin.cpp array/varredura.cpp -o bench_com_estatisticas
+ * \endcode
+ *
+ * Sem a macro, os arquivos das EDs geram exatamente o mesmo código de máquina das versões sem
+ * contadores, e bench_sem_estatisticas serve de referência. Com a macro, cada operação também
+ * atualiza os contadores da ED; ao final, o programa grava os contadores de cada ED em JSON, uma
+ * linha por ED.
+ *
+ * Antes das medições, as EDs recebem uma sequência aleatória de operações e são conferidas com EDs
+ * da biblioteca padrão; com os contadores, também são conferidos os totais de inserções, remoções
+ * e o tamanho. Qualquer divergência encerra o programa.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <vector>
+#include "auxiliares.hpp"
+#include "filadvet.hpp"
+#include "listacirc.hpp"
+#include "listavetdin.hpp"
+#include "pilhavet.hpp"
+
+using namespace std;
+using medicao::agora_ns;
+using medicao::falhar;
+using medicao::sumidouro;
+
+static const int TOTAL = 1 << 22;
+static const int OCUPACAO = 64;
+
+static unsigned semente = 2026;
+
+static int sortear(int n) {
+	semente = semente * 1103515245u + 12345u;
+	return (int) ((semente >> 8) % (unsigned) n);
+}
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+/* Confere os contadores com as quantidades de inserções e remoções feitas pela conferência. */
+static void conferir_contadores(const Estatisticas* e, long long insercoes, long long remocoes, const char* nome) {
+	if (e->insercoes != insercoes || e->remocoes != remocoes || e->tamanho != insercoes - remocoes ||
+		e->maior_tamanho < e->tamanho) {
+		falhar(nome);
+	}
+}
+#endif
+
+static void conferir() {
+	PilhaVet* p = criar_pilha();
+	ListaCirc* c = criar_lista_circ();
+	ListaVetDin* d = criar_lista_din();
+	vector<int> pilha;
+	deque<int> lista_c;
+	vector<int> lista_d;
+	long long insercoes[3] = {0, 0, 0};
+	long long remocoes[3] = {0, 0, 0};
+	for (int i = 0; i < 200000; i++) {
+		bool inserir_agora = (sortear(2) == 0);
+
+		if (inserir_agora && !estah_cheia(p)) {
+			empilhar(p, i);
+			pilha.push_back(i);
+			insercoes[0]++;
+		} else if (!estah_vazia(p)) {
+			if (desempilhar(p) != pilha.back()) {
+				falhar("PilhaVet divergente");
+			}
+			pilha.pop_back();
+			remocoes[0]++;
+		}
+
+		if (inserir_agora && !estah_cheia(c)) {
+			int pos = sortear(obter_tamanho(c) + 1);
+			inserir(c, i, pos);
+			lista_c.insert(lista_c.begin() + pos, i);
+			insercoes[1]++;
+		} else if (!estah_vazia(c)) {
+			int pos = sortear(obter_tamanho(c));
+			if (remover(c, pos) != lista_c[pos]) {
+				falhar("ListaCirc divergente");
+			}
+			lista_c.erase(lista_c.begin() + pos);
+			remocoes[1]++;
+		}
+
+		if (inserir_agora || lista_d.empty()) {
+			int pos = sortear(obter_tamanho(d) + 1);
+			inserir(d, i, pos);
+			lista_d.insert(lista_d.begin() + pos, i);
+			insercoes[2]++;
+		} else {
+			int pos = sortear(obter_tamanho(d));
+			if (obter(d, pos) != lista_d[pos] || remover(d, pos) != lista_d[pos]) {
+				falhar("ListaVetDin divergente");
+			}
+			lista_d.erase(lista_d.begin() + pos);
+			remocoes[2]++;
+		}
+	}
+#ifdef ESTRUTURAS_ESTATISTICAS
+	conferir_contadores(obter_estatisticas(p), insercoes[0], remocoes[0], "PilhaVet: contadores divergentes");
+	conferir_contadores(obter_estatisticas(c), insercoes[1], remocoes[1], "ListaCirc: contadores divergentes");
+	conferir_contadores(obter_estatisticas(d), insercoes[2], remocoes[2], "ListaVetDin: contadores divergentes");
+#endif
+	liberar_pilha(p);
+	liberar_lista(c);
+	liberar_lista(d);
+	printf("Conferencia da PilhaVet, da ListaCirc e da ListaVetDin: sem divergencias.\n\n");
+}
+
+/* Empilha e desempilha blocos de OCUPACAO elementos. */
+static double pilha_empilhar_desempilhar(PilhaVet* p) {
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int k = 0; k < TOTAL; k += 2 * OCUPACAO) {
+		for (int j = 0; j < OCUPACAO; j++) {
+			empilhar(p, j);
+		}
+		while (!estah_vazia(p)) {
+			soma += desempilhar(p);
+		}
+	}
+	double t = agora_ns() - t0;
+	sumidouro = soma;
+	return t / TOTAL;
+}
+
+/* Insere um elemento no início e remove outro do fim, com a fila mantendo OCUPACAO elementos. */
+static double fila_d_inserir_inicio_remover_fim(FilaDVet* f) {
+	for (int j = 0; j < OCUPACAO; j++) {
+		inserir_no_fim(f, j);
+	}
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int k = 0; k < TOTAL; k += 2) {
+		inserir_no_inicio(f, k);
+		soma += remover_do_fim(f);
+	}
+	double t = agora_ns() - t0;
+	sumidouro = soma;
+	return t / TOTAL;
+}
+
+/* Insere e remove em posições aleatórias, com a lista mantendo OCUPACAO elementos. */
+static double lista_circ_inserir_remover(ListaCirc* c) {
+	for (int j = 0; j < OCUPACAO; j++) {
+		inserir(c, j, j);
+	}
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int k = 0; k < TOTAL; k += 2) {
+		inserir(c, k, sortear(OCUPACAO + 1));
+		soma += remover(c, sortear(OCUPACAO + 1));
+	}
+	double t = agora_ns() - t0;
+	sumidouro = soma;
+	return t / TOTAL;
+}
+
+/* Insere no fim (com realocações) e consulta cada elemento; depois, esvazia a lista pelo fim. */
+static double lista_din_inserir_obter_remover(ListaVetDin* d) {
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int k = 0; k < TOTAL; k += 3 * 4096) {
+		for (int j = 0; j < 4096; j++) {
+			inserir(d, j, j);
+		}
+		for (int j = 0; j < 4096; j++) {
+			soma += obter(d, j);
+		}
+		for (int j = 4095; j >= 0; j--) {
+			soma += remover(d, j);
+		}
+	}
+	double t = agora_ns() - t0;
+	sumidouro = soma;
+	return t / TOTAL;
+}
+
+int main() {
+	conferir();
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+	printf("Com contadores (ESTRUTURAS_ESTATISTICAS definida)\n");
+#else
+	printf("Sem contadores\n");
+#endif
+	PilhaVet* p = criar_pilha();
+	FilaDVet* f = criar_fila_d();
+	ListaCirc* c = criar_lista_circ();
+	ListaVetDin* d = criar_lista_din();
+	definir_encolhimento_automatico(d, true);
+
+	printf("%-46s %8.2f ns/op\n", "PilhaVet: empilhar/desempilhar", pilha_empilhar_desempilhar(p));
+	printf("%-46s %8.2f ns/op\n", "FilaDVet: inserir_no_inicio + remover_do_fim", fila_d_inserir_inicio_remover_fim(f));
+	printf("%-46s %8.2f ns/op\n", "ListaCirc: inserir + remover (aleatorias)", lista_circ_inserir_remover(c));
+	printf("%-46s %8.2f ns/op\n", "ListaVetDin: inserir + obter + remover", lista_din_inserir_obter_remover(d));
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+	printf("\n");
+	escrever_estatisticas_json(obter_estatisticas(p), "PilhaVet", stdout);
+	escrever_estatisticas_json(obter_estatisticas(f), "FilaDVet", stdout);
+	escrever_estatisticas_json(obter_estatisticas(c), "ListaCirc", stdout);
+	escrever_estatisticas_json(obter_estatisticas(d), "ListaVetDin", stdout);
+#endif
+	liberar_pilha(p);
+	liberar_fila(f);
+	liberar_lista(c);
+	liberar_lista(d);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,124 @@
+/**
+ * \file bench_filaconc.cpp
+ * \brief Teste de estresse e escalabilidade da FilaConc, comparada a uma FilaEnc protegida por um std::mutex.
+ *
+ * Compilação (a partir da raiz do repositório):
+ * \code {.unparsed}
+ *     g++ -O2 -DNDEBUG -pthread -Iencadeada benchmarks/bench_filaconc.cpp encadeada/filaconc.cpp \
+ *         encadeada/riscos.cpp encadeada/filaenc.cpp encadeada/poolnoh.cpp -o bench_filaconc
+ * \endcode
+ *
+ * Para cada quantidade de threads (de 2 a 64, metade produtoras e metade consumidoras), cada
+ * produtora insere uma faixa exclusiva de valores e as consumidoras removem até esgotar o total.
+ * Ao final, confere-se que cada valor foi removido exatamente uma vez (sem perdas ou duplicações).
+ * Com 1 thread, a mesma thread insere e remove todos os valores.
+ */
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "auxiliares.hpp"
+#include "filaconc.hpp"
+#include "filaenc.hpp"
+
+using namespace std;
+using medicao::agora_ns;
+using medicao::falhar;
+
+/* FilaEnc compartilhada por meio de uma trava global, como era feito antes da FilaConc. */
+struct FilaTravada {
+	FilaEnc* fila;
+	mutex trava;
+};
+
+static void inserir(FilaTravada* f, int item) {
+	lock_guard<mutex> guarda(f->trava);
+	inserir(f->fila, item);
+}
+
+static bool remover(FilaTravada* f, int* item) {
+	lock_guard<mutex> guarda(f->trava);
+	if (estah_vazia(f->fila)) {
+		return false;
+	}
+	*item = remover(f->fila);
+	return true;
+}
+
+template <typename Fila>
+static void executar(const char* nome, Fila* f, int qtd_threads, int total) {
+	int produtoras = (qtd_threads == 1) ? 1 : qtd_threads / 2;
+	int consumidoras = (qtd_threads == 1) ? 1 : qtd_threads - produtoras;
+	int por_produtora = total / produtoras;
+	total = por_produtora * produtoras;
+
+	vector<atomic<int> > vistos(total);
+	for (int i = 0; i < total; i++) vistos[i].store(0, memory_order_relaxed);
+	atomic<int> removidos(0);
+
+	double t0 = agora_ns();
+	if (qtd_threads == 1) {
+		for (int i = 0; i < total; i++) {
+			inserir(f, i);
+			int item;
+			if (!remover(f, &item)) {
+				falhar(nome, "a fila ficou vazia logo após uma inserção");
+			}
+			vistos[item]++;
+		}
+		removidos = total;
+	} else {
+		vector<thread> threads;
+		for (int p = 0; p < produtoras; p++) {
+			threads.push_back(thread([f, p, por_produtora]() {
+				for (int i = 0; i < por_produtora; i++) {
+					inserir(f, p * por_produtora + i);
+				}
+			}));
+		}
+		for (int c = 0; c < consumidoras; c++) {
+			threads.push_back(thread([f, total, &vistos, &removidos]() {
+				int item;
+				while (removidos.load(memory_order_relaxed) < total) {
+					if (remover(f, &item)) {
+						vistos[item].fetch_add(1, memory_order_relaxed);
+						removidos.fetch_add(1, memory_order_relaxed);
+					} else {
+						this_thread::yield();
+					}
+				}
+			}));
+		}
+		for (size_t i = 0; i < threads.size(); i++) {
+			threads[i].join();
+		}
+	}
+	double t1 = agora_ns();
+
+	for (int i = 0; i < total; i++) {
+		if (vistos[i].load() != 1) {
+			fprintf(stderr, "%s: o valor %d foi removido %d vezes\n", nome, i, vistos[i].load());
+			exit(EXIT_FAILURE);
+		}
+	}
+	printf("%-18s threads=%-3d %8.2f Mops/s (insercao+remocao)\n", nome, qtd_threads, total / (t1 - t0) * 1e3);
+}
+
+int main() {
+	const int total = 2000000;
+	for (int qtd_threads = 1; qtd_threads <= 64; qtd_threads *= 2) {
+		FilaTravada travada;
+		travada.fila = criar_fila();
+		executar("FilaEnc + mutex", &travada, qtd_threads, total);
+		liberar_fila(travada.fila);
+
+		FilaConc* f = criar_fila_conc();
+		executar("FilaConc", f, qtd_threads, total);
+		liberar_fila(f);
+	}
+	printf("Nenhuma perda ou duplicacao encontrada.\n");
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,182 @@
+/**
+ * \file bench_filadconc.cpp
+ * \brief Escalonador fork-join simples sobre a FilaDConc e medição de roubos e aceleração (speedup).
+ *
+ * Compilação (a partir da raiz do repositório):
+ * \code {.unparsed}
+ *     g++ -O2 -DNDEBUG -pthread -Iarray benchmarks/bench_filadconc.cpp array/filadconc.cpp -o bench_filadconc
+ * \endcode
+ *
+ * Cada thread trabalhadora é dona de uma FilaDConc. Uma tarefa é um int: ao executá-la, a
+ * trabalhadora pode criar novas tarefas (inseridas no fim da própria fila). Quando a própria fila
+ * esvazia, a trabalhadora rouba tarefas do início da fila de outra trabalhadora escolhida ao acaso.
+ *
+ * Cargas de trabalho:
+ *  - fib: a tarefa n cria as tarefas n-1 e n-2 (abaixo de um corte, calcula fib(n) sequencialmente);
+ *  - soma em árvore: a tarefa k é um nó de uma árvore binária implícita sobre um vetor; as folhas
+ *    somam um bloco do vetor.
+ *
+ * Uso: bench_filadconc [max_trabalhadoras]   (padrão: 8)
+ */
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include "auxiliares.hpp"
+#include "filadconc.hpp"
+
+using namespace std;
+using medicao::agora_ns;
+
+/*
+ * Escalonador: "executar" recebe a tarefa e a função "criar" para gerar subtarefas, e retorna a
+ * contribuição da tarefa para o resultado (as contribuições são somadas ao final).
+ */
+struct Escalonador {
+	vector<FilaDConc*> filas;
+	atomic<long long> pendentes;
+	atomic<long long> roubos;
+};
+
+struct Trabalhadora {
+	Escalonador* esc;
+	int id;
+	unsigned semente;
+
+	void criar(int tarefa) {
+		esc->pendentes.fetch_add(1, memory_order_relaxed);
+		inserir_no_fim(esc->filas[id], tarefa);
+	}
+};
+
+template <typename Carga>
+static long long rodar(Escalonador* esc, int id, Carga& carga) {
+	Trabalhadora t = {esc, id, (unsigned) id * 2654435761u + 1};
+	long long resultado = 0, roubos = 0;
+	int n = (int) esc->filas.size();
+	while (esc->pendentes.load(memory_order_acquire) > 0) {
+		int tarefa;
+		bool obteve = remover_do_fim(esc->filas[id], &tarefa);
+		if (!obteve && n > 1) {
+			t.semente = t.semente * 1103515245u + 12345u;
+			int vitima = (int) ((t.semente >> 16) % (unsigned) n);
+			if (vitima != id && remover_do_inicio(esc->filas[vitima], &tarefa)) {
+				obteve = true;
+				roubos++;
+			}
+		}
+		if (obteve) {
+			resultado += carga.executar(tarefa, t);
+			esc->pendentes.fetch_sub(1, memory_order_release);
+		} else {
+			this_thread::yield();
+		}
+	}
+	esc->roubos += roubos;
+	return resultado;
+}
+
+template <typename Carga>
+static double executar(const char* nome, Carga& carga, int raiz, int qtd, long long esperado, double base_ns) {
+	Escalonador esc;
+	for (int i = 0; i < qtd; i++) {
+		esc.filas.push_back(criar_fila_d_conc(64));
+	}
+	esc.pendentes.store(1);
+	esc.roubos.store(0);
+	inserir_no_fim(esc.filas[0], raiz);
+
+	vector<long long> parciais(qtd, 0);
+	double t0 = agora_ns();
+	vector<thread> threads;
+	for (int i = 1; i < qtd; i++) {
+		threads.push_back(thread([&esc, &carga, &parciais, i]() { parciais[i] = rodar(&esc, i, carga); }));
+	}
+	parciais[0] = rodar(&esc, 0, carga);
+	for (size_t i = 0; i < threads.size(); i++) {
+		threads[i].join();
+	}
+	double t1 = agora_ns();
+
+	long long total = 0;
+	for (int i = 0; i < qtd; i++) {
+		total += parciais[i];
+		liberar_fila(esc.filas[i]);
+	}
+	if (total != esperado) {
+		fprintf(stderr, "%s: resultado incorreto (%lld != %lld)\n", nome, total, esperado);
+		exit(EXIT_FAILURE);
+	}
+	double ns = t1 - t0;
+	printf("%-14s trabalhadoras=%-3d %9.2f ms  roubos=%-8lld speedup=%5.2f\n", nome, qtd, ns / 1e6,
+		esc.roubos.load(), (base_ns > 0) ? base_ns / ns : 1.0);
+	return ns;
+}
+
+#define CORTE_FIB 16
+
+static long long fib_seq(int n) {
+	return (n < 2) ? n : fib_seq(n - 1) + fib_seq(n - 2);
+}
+
+struct CargaFib {
+	long long executar(int n, Trabalhadora& t) {
+		if (n < CORTE_FIB) {
+			return fib_seq(n);
+		}
+		t.criar(n - 1);
+		t.criar(n - 2);
+		return 0;
+	}
+};
+
+#define TAM_BLOCO 4096
+
+struct CargaSoma {
+	vector<int> dados;
+	int folhas; /* Quantidade de folhas (potência de dois); a raiz é o nó 1. */
+
+	long long executar(int k, Trabalhadora& t) {
+		if (k >= folhas) {
+			long long soma = 0;
+			int inicio = (k - folhas) * TAM_BLOCO;
+			for (int i = inicio; i < inicio + TAM_BLOCO; i++) {
+				soma += dados[i];
+			}
+			return soma;
+		}
+		t.criar(2 * k);
+		t.criar(2 * k + 1);
+		return 0;
+	}
+};
+
+int main(int argc, char** argv) {
+	int max_trabalhadoras = (argc > 1) ? atoi(argv[1]) : 8;
+
+	CargaFib fib;
+	const int n = 32;
+	long long esperado_fib = fib_seq(n);
+	double base = 0;
+	for (int qtd = 1; qtd <= max_trabalhadoras; qtd *= 2) {
+		double ns = executar("fib(32)", fib, n, qtd, esperado_fib, base);
+		if (qtd == 1) base = ns;
+	}
+
+	CargaSoma soma;
+	soma.folhas = 4096;
+	soma.dados.resize((size_t) soma.folhas * TAM_BLOCO);
+	long long esperado_soma = 0;
+	for (size_t i = 0; i < soma.dados.size(); i++) {
+		soma.dados[i] = (int) (i % 1000);
+		esperado_soma += soma.dados[i];
+	}
+	base = 0;
+	for (int qtd = 1; qtd <= max_trabalhadoras; qtd *= 2) {
+		double ns = executar("soma-arvore", soma, 1, qtd, esperado_soma, base);
+		if (qtd == 1) base = ns;
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,163 @@
+/**
+ * \file bench_filaspsc.cpp
+ * \brief Compara a FilaSPSC com uma FilaVet protegida por um std::mutex, com uma thread produtora e uma consumidora.
+ *
+ * Compilação (a partir da raiz do repositório):
+ * \code {.unparsed}
+ *     g++ -O2 -DNDEBUG -pthread -Iarray benchmarks/bench_filaspsc.cpp array/filavet.cpp array/filaspsc.cpp \
+ *         array/varredura.cpp -o bench_filaspsc
+ * \endcode
+ *
+ * São medidos:
+ *  - vazão: a produtora insere N elementos e a consumidora os remove, conferindo a ordem;
+ *  - latência: duas filas formam um "pingue-pongue" entre as threads e mede-se o tempo médio de ida e volta.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include "auxiliares.hpp"
+#include "filavet.hpp"
+#include "filaspsc.hpp"
+
+using namespace std;
+using medicao::agora_ns;
+
+/* FilaVet compartilhada por meio de uma trava, como era feito antes da FilaSPSC. */
+struct FilaTravada {
+	FilaVet* fila;
+	mutex trava;
+};
+
+static bool inserir(FilaTravada* f, int item) {
+	lock_guard<mutex> guarda(f->trava);
+	if (estah_cheia(f->fila)) {
+		return false;
+	}
+	inserir(f->fila, item);
+	return true;
+}
+
+static bool remover(FilaTravada* f, int* item) {
+	lock_guard<mutex> guarda(f->trava);
+	if (estah_vazia(f->fila)) {
+		return false;
+	}
+	*item = remover(f->fila);
+	return true;
+}
+
+template <typename Fila>
+static void vazao(const char* nome, Fila* f, int n) {
+	double t0 = agora_ns();
+	thread produtora([f, n]() {
+		for (int i = 0; i < n; i++) {
+			while (!inserir(f, i)) {
+				this_thread::yield();
+			}
+		}
+	});
+	for (int i = 0; i < n; i++) {
+		int item;
+		while (!remover(f, &item)) {
+			this_thread::yield();
+		}
+		if (item != i) {
+			fprintf(stderr, "%s: ordem incorreta (%d != %d)\n", nome, item, i);
+			exit(EXIT_FAILURE);
+		}
+	}
+	produtora.join();
+	double t1 = agora_ns();
+	printf("%-32s vazao:    %8.2f Mitens/s\n", nome, n / (t1 - t0) * 1e3);
+}
+
+static void vazao_lote(FilaSPSC* f, int n, int tam_lote) {
+	double t0 = agora_ns();
+	thread produtora([f, n, tam_lote]() {
+		int* lote = new int[tam_lote];
+		for (int i = 0; i < n; ) {
+			int qtd = (n - i < tam_lote) ? n - i : tam_lote;
+			for (int j = 0; j < qtd; j++) lote[j] = i + j;
+			int enviados = 0;
+			while (enviados < qtd) {
+				int k = inserir_lote(f, lote + enviados, qtd - enviados);
+				if (k == 0) this_thread::yield();
+				enviados += k;
+			}
+			i += qtd;
+		}
+		delete[] lote;
+	});
+	int* lote = new int[tam_lote];
+	for (int i = 0; i < n; ) {
+		int k = remover_lote(f, lote, tam_lote);
+		if (k == 0) {
+			this_thread::yield();
+		}
+		for (int j = 0; j < k; j++, i++) {
+			if (lote[j] != i) {
+				fprintf(stderr, "FilaSPSC (lote): ordem incorreta\n");
+				exit(EXIT_FAILURE);
+			}
+		}
+	}
+	delete[] lote;
+	produtora.join();
+	double t1 = agora_ns();
+	printf("FilaSPSC (lote de %-4d)          vazao:    %8.2f Mitens/s\n", tam_lote, n / (t1 - t0) * 1e3);
+}
+
+template <typename Fila>
+static void latencia(const char* nome, Fila* ida, Fila* volta, int rodadas) {
+	thread eco([ida, volta, rodadas]() {
+		for (int i = 0; i < rodadas; i++) {
+			int item;
+			while (!remover(ida, &item)) this_thread::yield();
+			while (!inserir(volta, item)) this_thread::yield();
+		}
+	});
+	double t0 = agora_ns();
+	for (int i = 0; i < rodadas; i++) {
+		int item;
+		while (!inserir(ida, i)) this_thread::yield();
+		while (!remover(volta, &item)) this_thread::yield();
+	}
+	double t1 = agora_ns();
+	eco.join();
+	printf("%-32s latencia: %8.1f ns/ida-e-volta\n", nome, (t1 - t0) / rodadas);
+}
+
+int main() {
+	const int n = 20000000;
+	const int rodadas = 200000;
+
+	FilaTravada travada;
+	travada.fila = criar_fila();
+	vazao("FilaVet + mutex", &travada, n);
+
+	FilaSPSC* f = criar_fila_spsc(TAM_MAX);
+	vazao("FilaSPSC (capacidade 128)", f, n);
+	liberar_fila(f);
+
+	f = criar_fila_spsc(4096);
+	vazao("FilaSPSC (capacidade 4096)", f, n);
+	for (int tam_lote = 16; tam_lote <= 1024; tam_lote *= 8) {
+		vazao_lote(f, n, tam_lote);
+	}
+	liberar_fila(f);
+
+	FilaTravada volta;
+	volta.fila = criar_fila();
+	latencia("FilaVet + mutex", &travada, &volta, rodadas);
+	liberar_fila(travada.fila);
+	liberar_fila(volta.fila);
+
+	FilaSPSC* ida_spsc = criar_fila_spsc(TAM_MAX);
+	FilaSPSC* volta_spsc = criar_fila_spsc(TAM_MAX);
+	latencia("FilaSPSC", ida_spsc, volta_spsc, rodadas);
+	liberar_fila(ida_spsc);
+	liberar_fila(volta_spsc);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,277 @@
+/**
+ * \file bench_generica.cpp
+ * \brief Compara as EDs genéricas guardando registros de 64 bytes diretamente e por meio de ponteiros.
+ *
+ * Compilação (a partir da raiz do repositório):
+ * \code {.unparsed}
+ *     g++ -O2 -I. -Iencadeada benchmarks/bench_generica.cpp encadeada/filaenc.cpp \
+ *         encadeada/poolnoh.cpp -o bench_generica
+ * \endcode
+ *
+ * Antes das medições, o programa confere, com um tipo que conta as próprias construções, cópias,
+ * movimentações e destruições, que as EDs genéricas não copiam elementos (as funções construir_*
+ * não copiam nem movem; as remoções apenas movem) e destroem todos os elementos que criam.
+ * Também confere que generica::FilaEnc<int> se comporta como a FilaEnc de inteiros original.
+ *
+ * Depois, mede-se a vazão de ciclos de inserção e remoção de registros de 64 bytes em duas
+ * formas: com o registro guardado no próprio nó/vetor da ED e com o registro alocado com "new"
+ * e apenas o ponteiro guardado na ED (o que se fazia antes, com as EDs de inteiros).
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include "auxiliares.hpp"
+#include "filaenc.hpp"
+#include "generica/filadvet.hpp"
+#include "generica/filaenc.hpp"
+#include "generica/filavet.hpp"
+#include "generica/listadenc.hpp"
+#include "generica/listaenc.hpp"
+#include "generica/listavet.hpp"
+#include "generica/pilhaenc.hpp"
+#include "generica/pilhavet.hpp"
+
+using namespace std;
+using medicao::agora_ns;
+using medicao::falhar;
+using medicao::sumidouro;
+
+/* Tipo que registra quantas vezes foi construído, copiado, movido e destruído. */
+struct Rastreado {
+	static int copias;
+	static int movimentos;
+	static int vivos;
+
+	int valor;
+	string texto;
+
+	Rastreado(int v, const char* t) : valor(v), texto(t) { vivos++; }
+	Rastreado(const Rastreado& o) : valor(o.valor), texto(o.texto) { copias++; vivos++; }
+	Rastreado(Rastreado&& o) : valor(o.valor), texto(std::move(o.texto)) { movimentos++; vivos++; }
+	Rastreado& operator=(const Rastreado& o) { valor = o.valor; texto = o.texto; copias++; return *this; }
+	Rastreado& operator=(Rastreado&& o) { valor = o.valor; texto = std::move(o.texto); movimentos++; return *this; }
+	~Rastreado() { vivos--; }
+};
+
+int Rastreado::copias = 0;
+int Rastreado::movimentos = 0;
+int Rastreado::vivos = 0;
+
+static void zerar_contadores() {
+	Rastreado::copias = 0;
+	Rastreado::movimentos = 0;
+}
+
+/* Confere que nenhuma cópia foi feita e que restam "vivos" objetos. */
+static void conferir(const char* ed, int vivos) {
+	if (Rastreado::copias != 0) {
+		fprintf(stderr, "%s: %d copias inesperadas\n", ed, Rastreado::copias);
+		exit(EXIT_FAILURE);
+	}
+	if (Rastreado::vivos != vivos) {
+		fprintf(stderr, "%s: %d objetos vivos (esperados %d)\n", ed, Rastreado::vivos, vivos);
+		exit(EXIT_FAILURE);
+	}
+}
+
+static void conferir_sem_copias() {
+	const char* texto = "um texto longo o bastante para nao caber no buffer interno da string";
+	{
+		generica::PilhaVet<Rastreado> p;
+		generica::PilhaEnc<Rastreado> pe;
+		zerar_contadores();
+		for (int i = 0; i < 10; i++) {
+			p.construir_no_topo(i, texto);
+			pe.construir_no_topo(i, texto);
+		}
+		if (Rastreado::movimentos != 0) {
+			falhar("Pilhas: construir_no_topo moveu elementos");
+		}
+		for (int i = 9; i >= 5; i--) {
+			if (p.desempilhar().valor != i || pe.desempilhar().valor != i) {
+				falhar("Pilhas: ordem de remocao divergente");
+			}
+		}
+		conferir("Pilhas", 10);
+	}
+	conferir("Pilhas (destruidas)", 0);
+	{
+		generica::FilaVet<Rastreado> f;
+		generica::FilaEnc<Rastreado> fe;
+		generica::FilaDVet<Rastreado> fd;
+		zerar_contadores();
+		for (int i = 0; i < 250; i++) {
+			f.construir(i, texto);
+			fe.construir(i, texto);
+			fd.construir_no_fim(i, texto);
+			if (f.remover().valor != i || fe.remover().valor != i || fd.remover_do_inicio().valor != i) {
+				falhar("Filas: ordem de remocao divergente");
+			}
+		}
+		for (int i = 0; i < 10; i++) {
+			f.construir(i, texto);
+			fe.construir(i, texto);
+			fd.construir_no_inicio(i, texto);
+		}
+		if (fd.remover_do_fim().valor != 0 || fd.obter_inicio().valor != 9) {
+			falhar("FilaDVet: extremidades divergentes");
+		}
+		conferir("Filas", 29);
+	}
+	conferir("Filas (destruidas)", 0);
+	{
+		generica::ListaVet<Rastreado> lv;
+		generica::ListaEnc<Rastreado> le;
+		generica::ListaDEnc<Rastreado> ld;
+		zerar_contadores();
+		for (int i = 0; i < 40; i++) {
+			int pos = (i * 7) % (i + 1);
+			lv.construir(pos, i, texto);
+			le.construir(pos, i, texto);
+			ld.construir(pos, i, texto);
+		}
+		for (int i = 0; i < 40; i++) {
+			if (lv.obter(i).valor != le.obter_elemento(i).valor || ld.obter_elemento(i).valor != le.obter_elemento(i).valor) {
+				falhar("Listas: conteudo divergente");
+			}
+		}
+		for (int i = 0; i < 20; i++) {
+			int pos = (i * 13) % (40 - i);
+			int a = lv.remover(pos).valor;
+			if (le.remover(pos).valor != a || ld.remover(pos).valor != a || lv.obter(0).texto != texto) {
+				falhar("Listas: remocao divergente");
+			}
+		}
+		conferir("Listas", 60);
+	}
+	conferir("Listas (destruidas)", 0);
+	printf("Conferencia de copias e destruicoes: sem divergencias.\n");
+}
+
+static void conferir_com_fila_int() {
+	FilaEnc* original = criar_fila();
+	generica::FilaEnc<int> nova;
+	unsigned semente = 7;
+	for (int i = 0; i < 100000; i++) {
+		semente = semente * 1103515245u + 12345u;
+		if (estah_vazia(original) || (semente >> 16) % 3 != 0) {
+			inserir(original, i);
+			nova.inserir(i);
+		} else if (remover(original) != nova.remover()) {
+			falhar("generica::FilaEnc<int> divergente da FilaEnc");
+		}
+		if (estah_vazia(original) != nova.estah_vazia()) {
+			falhar("generica::FilaEnc<int>: estah_vazia divergente");
+		}
+	}
+	liberar_fila(original);
+	printf("Conferencia de generica::FilaEnc<int> com a FilaEnc: sem divergencias.\n");
+}
+
+/* Registro de 64 bytes, como os que motivaram as EDs genéricas. */
+struct Registro {
+	long long chave;
+	double dados[7];
+
+	Registro(long long c) : chave(c) {
+		for (int i = 0; i < 7; i++) {
+			dados[i] = c + i;
+		}
+	}
+};
+
+static const int CICLOS = 200000;
+static const int RAJADA = 64;
+
+/* Cada ciclo insere uma rajada de registros e depois remove todos eles. */
+template <typename Fila>
+static double medir_fila_direta() {
+	Fila f;
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int c = 0; c < CICLOS; c++) {
+		for (int i = 0; i < RAJADA; i++) {
+			f.construir(c + i);
+		}
+		for (int i = 0; i < RAJADA; i++) {
+			Registro r = f.remover();
+			soma += r.chave + (long long) r.dados[6];
+		}
+	}
+	sumidouro = soma;
+	return (agora_ns() - t0) / ((double) CICLOS * RAJADA);
+}
+
+template <typename Fila>
+static double medir_fila_ponteiros() {
+	Fila f;
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int c = 0; c < CICLOS; c++) {
+		for (int i = 0; i < RAJADA; i++) {
+			f.inserir(new Registro(c + i));
+		}
+		for (int i = 0; i < RAJADA; i++) {
+			Registro* r = f.remover();
+			soma += r->chave + (long long) r->dados[6];
+			delete r;
+		}
+	}
+	sumidouro = soma;
+	return (agora_ns() - t0) / ((double) CICLOS * RAJADA);
+}
+
+template <typename Pilha>
+static double medir_pilha_direta() {
+	Pilha p;
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int c = 0; c < CICLOS; c++) {
+		for (int i = 0; i < RAJADA; i++) {
+			p.construir_no_topo(c + i);
+		}
+		for (int i = 0; i < RAJADA; i++) {
+			Registro r = p.desempilhar();
+			soma += r.chave + (long long) r.dados[6];
+		}
+	}
+	sumidouro = soma;
+	return (agora_ns() - t0) / ((double) CICLOS * RAJADA);
+}
+
+template <typename Pilha>
+static double medir_pilha_ponteiros() {
+	Pilha p;
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int c = 0; c < CICLOS; c++) {
+		for (int i = 0; i < RAJADA; i++) {
+			p.empilhar(new Registro(c + i));
+		}
+		for (int i = 0; i < RAJADA; i++) {
+			Registro* r = p.desempilhar();
+			soma += r->chave + (long long) r->dados[6];
+			delete r;
+		}
+	}
+	sumidouro = soma;
+	return (agora_ns() - t0) / ((double) CICLOS * RAJADA);
+}
+
+int main() {
+	conferir_sem_copias();
+	conferir_com_fila_int();
+
+	printf("\nns por insercao + remocao de um registro de %d bytes (rajadas de %d)\n", (int) sizeof(Registro), RAJADA);
+	printf("%-10s | %10s %10s\n", "ED", "direto", "ponteiro");
+	printf("%-10s | %10.2f %10.2f\n", "FilaVet", medir_fila_direta<generica::FilaVet<Registro>>(),
+		   medir_fila_ponteiros<generica::FilaVet<Registro*>>());
+	printf("%-10s | %10.2f %10.2f\n", "FilaEnc", medir_fila_direta<generica::FilaEnc<Registro>>(),
+		   medir_fila_ponteiros<generica::FilaEnc<Registro*>>());
+	printf("%-10s | %10.2f %10.2f\n", "PilhaVet", medir_pilha_direta<generica::PilhaVet<Registro>>(),
+		   medir_pilha_ponteiros<generica::PilhaVet<Registro*>>());
+	printf("%-10s | %10.2f %10.2f\n", "PilhaEnc", medir_pilha_direta<generica::PilhaEnc<Registro>>(),
+		   medir_pilha_ponteiros<generica::PilhaEnc<Registro*>>());
+	return EXIT_SUCCESS;
+}
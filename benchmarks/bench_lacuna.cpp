@@ -0,0 +1,220 @@
+/**
+ * \file bench_lacuna.cpp
+ * \brief Compara três estratégias de deslocamento da ListaVet em uma sessão de edição de texto.
+ *
+ * Compilação (a partir da raiz do repositório):
+ * \code {.unparsed}
+ *     g++ -O2 -DNDEBUG -DTAM_MAX_LISTAVET=262144 -Iarray benchmarks/bench_lacuna.cpp array/listavet.cpp \
+ *         array/ordenacao.cpp array/varredura.cpp -o bench_lacuna
+ * \endcode
+ *
+ * As estratégias são:
+ * - laço: réplica mínima da implementação anterior, que deslocava os elementos um a um;
+ * - memmove: a ListaVet no modo normal, que desloca o restante da lista com uma única cópia de bloco;
+ * - lacuna: a ListaVet no modo lacuna (gap buffer), em que o espaço livre acompanha o cursor.
+ *
+ * A sessão começa com um documento de 100 mil caracteres e executa 100 mil edições em um cursor:
+ * 80% são inserções no cursor (digitação) e 20% são remoções antes dele (backspace). Entre as
+ * edições, o cursor anda algumas posições e, a cada 200 edições em média, salta para uma posição
+ * aleatória do documento, como ao navegar para outro trecho.
+ *
+ * Com -O2, o GCC costuma reconhecer os laços de deslocamento e trocá-los por chamadas a memmove, e
+ * as duas primeiras colunas ficam próximas; com -O1 ou -fno-tree-loop-distribute-patterns, o laço
+ * fica de 4 a 8 vezes mais lento. A chamada explícita não depende dessa otimização.
+ *
+ * Antes das medições, a ListaVet nos dois modos (alternados durante a conferência) e a réplica
+ * recebem uma sequência aleatória de operações e são conferidas com um std::vector.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "auxiliares.hpp"
+#include "listavet.hpp"
+
+using namespace std;
+using medicao::agora_ns;
+using medicao::falhar;
+using medicao::sumidouro;
+
+static const int TAM_DOCUMENTO = 100000;
+static const int QTD_EDICOES = 100000;
+static const int TAM_CONFERENCIA = (TAM_MAX_LISTAVET < 2000) ? TAM_MAX_LISTAVET : 2000;
+
+static unsigned semente;
+
+static int sortear(int n) {
+	semente = semente * 1103515245u + 12345u;
+	return (int) ((semente >> 8) % (unsigned) n);
+}
+
+/* Réplica mínima da ListaVet anterior, que deslocava os elementos com laços. */
+struct ListaLaco {
+	int itens[TAM_MAX_LISTAVET];
+	int ultimo;
+};
+
+static void inserir(ListaLaco* lista, int item, int pos) {
+	for (int i = lista->ultimo; i > pos; i--) {
+		lista->itens[i] = lista->itens[i - 1];
+	}
+	lista->itens[pos] = item;
+	lista->ultimo++;
+}
+
+static int remover(ListaLaco* lista, int pos) {
+	int item = lista->itens[pos];
+	for (int i = pos; i < lista->ultimo - 1; i++) {
+		lista->itens[i] = lista->itens[i + 1];
+	}
+	lista->ultimo--;
+	return item;
+}
+
+static int obter(ListaLaco* lista, int pos) {
+	return lista->itens[pos];
+}
+
+static int obter_tamanho(ListaLaco* lista) {
+	return lista->ultimo;
+}
+
+static void conferir() {
+	ListaVet* normal = criar_lista();
+	ListaVet* lacuna = criar_lista();
+	ListaLaco* laco = new ListaLaco;
+	laco->ultimo = 0;
+	definir_modo_lacuna(lacuna, true);
+	vector<int> oraculo;
+	int bloco[16];
+	int saida[16];
+	semente = 7;
+
+	for (int i = 0; i < 200000; i++) {
+		int tam = (int) oraculo.size();
+		int op = sortear(10);
+		if (op < 5 && tam < TAM_CONFERENCIA) {
+			int pos = sortear(tam + 1);
+			inserir(normal, i, pos);
+			inserir(lacuna, i, pos);
+			inserir(laco, i, pos);
+			oraculo.insert(oraculo.begin() + pos, i);
+		} else if (op < 9 && tam > 0) {
+			int pos = sortear(tam);
+			int a = remover(normal, pos);
+			int b = remover(lacuna, pos);
+			int c = remover(laco, pos);
+			if (a != oraculo[pos] || b != oraculo[pos] || c != oraculo[pos]) {
+				falhar("Listas divergentes (remover)");
+			}
+			oraculo.erase(oraculo.begin() + pos);
+		} else if (op == 9) {
+			// Operações em lote e troca do modo da segunda lista
+			int n = sortear(16);
+			if (sortear(2) == 0 && tam + n <= TAM_CONFERENCIA) {
+				int pos = sortear(tam + 1);
+				for (int j = 0; j < n; j++) {
+					bloco[j] = -i - j;
+				}
+				inserir_intervalo(normal, pos, bloco, bloco + n);
+				inserir_intervalo(lacuna, pos, bloco, bloco + n);
+				for (int j = 0; j < n; j++) {
+					inserir(laco, bloco[j], pos + j);
+				}
+				oraculo.insert(oraculo.begin() + pos, bloco, bloco + n);
+			} else if (tam >= n) {
+				int pos = sortear(tam - n + 1);
+				remover_intervalo(normal, pos, n, NULL);
+				remover_intervalo(lacuna, pos, n, saida);
+				for (int j = 0; j < n; j++) {
+					if (saida[j] != oraculo[pos + j] || remover(laco, pos) != oraculo[pos + j]) {
+						falhar("Listas divergentes (remover_intervalo)");
+					}
+				}
+				oraculo.erase(oraculo.begin() + pos, oraculo.begin() + pos + n);
+			}
+			if (sortear(20) == 0) {
+				definir_modo_lacuna(lacuna, sortear(2) == 0);
+			}
+		}
+		if (i % 1000 == 0) {
+			tam = (int) oraculo.size();
+			if (obter_tamanho(normal) != tam || obter_tamanho(lacuna) != tam || obter_tamanho(laco) != tam) {
+				falhar("Listas divergentes (tamanho)");
+			}
+			for (int j = 0; j < tam; j++) {
+				if (obter(normal, j) != oraculo[j] || obter(lacuna, j) != oraculo[j] || obter(laco, j) != oraculo[j]) {
+					falhar("Listas divergentes (conteudo)");
+				}
+			}
+		}
+	}
+	liberar_lista(normal);
+	liberar_lista(lacuna);
+	delete laco;
+	printf("Conferencia dos modos normal e lacuna: sem divergencias.\n\n");
+}
+
+/* Executa a sessão de edição e retorna o tempo médio, em ns, por edição. */
+template <typename Lista>
+static double editar(Lista* li) {
+	for (int i = 0; i < TAM_DOCUMENTO; i++) {
+		inserir(li, 'a' + i % 26, i);
+	}
+	semente = 2026;
+	int cursor = TAM_DOCUMENTO / 2;
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int i = 0; i < QTD_EDICOES; i++) {
+		int tam = obter_tamanho(li);
+		if (sortear(200) == 0) {
+			cursor = sortear(tam + 1);
+		} else {
+			cursor += sortear(5) - 2;
+			cursor = (cursor < 0) ? 0 : (cursor > tam) ? tam : cursor;
+		}
+		if (sortear(5) > 0 || cursor == 0) {
+			inserir(li, 'a' + i % 26, cursor);
+			cursor++;
+		} else {
+			soma += remover(li, cursor - 1);
+			cursor--;
+		}
+	}
+	double t = agora_ns() - t0;
+	for (int i = 0; i < obter_tamanho(li); i += 97) {
+		soma += obter(li, i);
+	}
+	sumidouro = soma;
+	return t / QTD_EDICOES;
+}
+
+int main() {
+	conferir();
+
+	ListaLaco* laco = new ListaLaco;
+	laco->ultimo = 0;
+	double t_laco = editar(laco);
+	long long soma_laco = sumidouro;
+	delete laco;
+
+	ListaVet* normal = criar_lista();
+	double t_normal = editar(normal);
+	long long soma_normal = sumidouro;
+	liberar_lista(normal);
+
+	ListaVet* lacuna = criar_lista();
+	definir_modo_lacuna(lacuna, true);
+	double t_lacuna = editar(lacuna);
+	long long soma_lacuna = sumidouro;
+	liberar_lista(lacuna);
+
+	if (soma_laco != soma_normal || soma_laco != soma_lacuna) {
+		falhar("Sessoes de edicao divergentes");
+	}
+
+	printf("ns por edicao (documento com %d elementos)\n", TAM_DOCUMENTO);
+	printf("%10s %10s %10s\n", "laco", "memmove", "lacuna");
+	printf("%10.1f %10.1f %10.1f\n", t_laco, t_normal, t_lacuna);
+	return EXIT_SUCCESS;
+}
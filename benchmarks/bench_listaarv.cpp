@@ -0,0 +1,117 @@
+/**
+ * \file bench_listaarv.cpp
+ * \brief Confere a ListaArv contra a ListaDEnc e mede a escalabilidade das operações posicionais.
+ *
+ * Compilação (a partir da raiz do repositório):
+ * \code {.unparsed}
+ *     g++ -O2 -Iencadeada benchmarks/bench_listaarv.cpp encadeada/listaarv.cpp \
+ *         encadeada/listadenc.cpp encadeada/poolnoh.cpp -o bench_listaarv
+ * \endcode
+ *
+ * Primeiro, uma sequência aleatória de inserções, remoções e consultas é aplicada às duas listas,
+ * usando a ListaDEnc como referência (oráculo); qualquer divergência encerra o programa.
+ * Depois, mede-se o custo médio de inserir, obter e remover em posições aleatórias para listas
+ * de 1 mil a 10 milhões de elementos. A ListaDEnc só é medida nos tamanhos menores.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include "auxiliares.hpp"
+#include "listaarv.hpp"
+#include "listadenc.hpp"
+
+using namespace std;
+using medicao::agora_ns;
+using medicao::sumidouro;
+
+static unsigned semente = 12345;
+
+static int sortear(int n) {
+	semente = semente * 1103515245u + 12345u;
+	return (int) ((semente >> 4) % (unsigned) n);
+}
+
+static void conferir_com_oraculo(int operacoes) {
+	ListaArv* li = criar_lista_arv();
+	ListaDEnc* oraculo = criar_listad();
+	for (int i = 0; i < operacoes; i++) {
+		int tam = obter_tamanho(oraculo);
+		if (obter_tamanho(li) != tam) {
+			fprintf(stderr, "Tamanhos divergentes na operacao %d\n", i);
+			exit(EXIT_FAILURE);
+		}
+		int op = sortear(10);
+		if (tam == 0 || op < 5) {
+			int pos = sortear(tam + 1);
+			inserir(li, i, pos);
+			inserir(oraculo, i, pos);
+		} else if (op < 8) {
+			int pos = sortear(tam);
+			if (remover(li, pos) != remover(oraculo, pos)) {
+				fprintf(stderr, "remover divergente na operacao %d\n", i);
+				exit(EXIT_FAILURE);
+			}
+		} else {
+			int pos = sortear(tam);
+			if (obter_elemento(li, pos) != obter_elemento(oraculo, pos)) {
+				fprintf(stderr, "obter_elemento divergente na operacao %d\n", i);
+				exit(EXIT_FAILURE);
+			}
+		}
+	}
+	for (int i = 0; i < obter_tamanho(oraculo); i++) {
+		if (obter_elemento(li, i) != obter_elemento(oraculo, i)) {
+			fprintf(stderr, "Conteudo final divergente na posicao %d\n", i);
+			exit(EXIT_FAILURE);
+		}
+	}
+	printf("Conferencia com a ListaDEnc: %d operacoes sem divergencias.\n", operacoes);
+	liberar_lista(li);
+	liberar_lista(oraculo);
+}
+
+template <typename Lista>
+static void medir(const char* nome, Lista* li, int n) {
+	/* O preenchimento insere sempre no início, o que é O(1) na ListaDEnc e O(log n) na ListaArv. */
+	for (int i = 0; i < n; i++) {
+		inserir(li, i, 0);
+	}
+	const int ops = 20000;
+	long long soma = 0;
+
+	double t0 = agora_ns();
+	for (int i = 0; i < ops; i++) {
+		inserir(li, i, sortear(n + i + 1));
+	}
+	double t_inserir = (agora_ns() - t0) / ops;
+
+	t0 = agora_ns();
+	for (int i = 0; i < ops; i++) {
+		soma += obter_elemento(li, sortear(n + ops));
+	}
+	double t_obter = (agora_ns() - t0) / ops;
+
+	t0 = agora_ns();
+	for (int i = 0; i < ops; i++) {
+		soma += remover(li, sortear(n + ops - i));
+	}
+	double t_remover = (agora_ns() - t0) / ops;
+
+	sumidouro = soma;
+	printf("%-10s n=%-9d inserir=%10.1f ns  obter=%10.1f ns  remover=%10.1f ns\n", nome, n, t_inserir, t_obter, t_remover);
+}
+
+int main() {
+	conferir_com_oraculo(50000);
+	for (int n = 1000; n <= 10000000; n *= 10) {
+		if (n <= 100000) {
+			ListaDEnc* ld = criar_listad();
+			medir("ListaDEnc", ld, n);
+			liberar_lista(ld);
+		}
+		ListaArv* li = criar_lista_arv();
+		medir("ListaArv", li, n);
+		liberar_lista(li);
+	}
+	return EXIT_SUCCESS;
+}
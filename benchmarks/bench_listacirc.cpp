@@ -0,0 +1,132 @@
+/**
+ * \file bench_listacirc.cpp
+ * \brief Compara a ListaVet com a ListaCirc (arranjo circular) em diferentes padrões de inserção e remoção.
+ *
+ * Compilação (a partir da raiz do repositório):
+ * \code {.unparsed}
+ *     g++ -O2 -DNDEBUG -DTAM_MAX_LISTAVET=16384 -DTAM_MAX_LISTACIRC=16384 -Iarray \
+ *         benchmarks/bench_listacirc.cpp array/listavet.cpp array/listacirc.cpp \
+ *         array/ordenacao.cpp array/varredura.cpp -o bench_listacirc
+ * \endcode
+ *
+ * Antes das medições, as duas listas recebem sequências aleatórias de inserções e remoções (com
+ * tamanhos que fazem o início da ListaCirc dar várias voltas no vetor) e são comparadas elemento a
+ * elemento após cada operação; qualquer divergência encerra o programa. A conferência é feita com a
+ * capacidade usada na compilação; com os valores padrão (100, que não é potência de dois), ela
+ * exercita também o resto da divisão no lugar da máscara.
+ *
+ * Nas medições, cada lista começa com 10 mil elementos e executa 200 mil pares de inserção e
+ * remoção, cujas posições seguem um dos padrões: início, meio, final, aleatória (uniforme) e fila
+ * (inserção no final e remoção do início, como no uso de uma lista como fila).
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include "auxiliares.hpp"
+#include "listacirc.hpp"
+#include "listavet.hpp"
+
+using namespace std;
+using medicao::agora_ns;
+using medicao::falhar;
+using medicao::sumidouro;
+
+static const int OCUPACAO = 10000;
+static const int QTD_PARES = 200000;
+
+static unsigned semente;
+
+static int sortear(int n) {
+	semente = semente * 1103515245u + 12345u;
+	return (int) ((semente >> 8) % (unsigned) n);
+}
+
+static void comparar(ListaVet* lv, ListaCirc* lc) {
+	if (obter_tamanho(lv) != obter_tamanho(lc)) {
+		falhar("Listas divergentes (tamanho)");
+	}
+	for (int i = 0; i < obter_tamanho(lv); i++) {
+		if (obter(lv, i) != obter(lc, i)) {
+			falhar("Listas divergentes (conteudo)");
+		}
+	}
+}
+
+static void conferir() {
+	const int capacidade = (TAM_MAX_LISTAVET < TAM_MAX_LISTACIRC) ? TAM_MAX_LISTAVET : TAM_MAX_LISTACIRC;
+	const int limite = (capacidade < 300) ? capacidade : 300;
+	ListaVet* lv = criar_lista();
+	ListaCirc* lc = criar_lista_circ();
+	semente = 42;
+	for (int i = 0; i < 300000; i++) {
+		int tam = obter_tamanho(lv);
+		// Alterna fases de crescimento e de encolhimento, para que a lista fique cheia e vazia
+		bool crescendo = ((i / 5000) % 2 == 0);
+		bool inserir_agora = (tam == 0) || (tam < limite && sortear(10) < (crescendo ? 7 : 3));
+		int padrao = sortear(4);
+		if (inserir_agora) {
+			int pos = (padrao == 0) ? 0 : (padrao == 1) ? tam : sortear(tam + 1);
+			inserir(lv, i, pos);
+			inserir(lc, i, pos);
+		} else {
+			int pos = (padrao == 0) ? 0 : (padrao == 1) ? tam - 1 : sortear(tam);
+			if (remover(lv, pos) != remover(lc, pos)) {
+				falhar("Listas divergentes (remover)");
+			}
+		}
+		if (estah_cheia(lc) != (obter_tamanho(lc) == TAM_MAX_LISTACIRC) || estah_vazia(lc) != estah_vazia(lv)) {
+			falhar("Listas divergentes (estado)");
+		}
+		comparar(lv, lc);
+	}
+	liberar_lista(lv);
+	liberar_lista(lc);
+	printf("Conferencia da ListaCirc com a ListaVet: sem divergencias.\n\n");
+}
+
+enum Padrao { INICIO, MEIO, FINAL, ALEATORIO, FILA };
+
+template <typename Lista>
+static double medir(Lista* li, Padrao padrao) {
+	for (int i = 0; i < OCUPACAO; i++) {
+		inserir(li, i, i);
+	}
+	semente = 2026;
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int i = 0; i < QTD_PARES; i++) {
+		int pos_ins, pos_rem;
+		switch (padrao) {
+			case INICIO: pos_ins = 0; pos_rem = 0; break;
+			case MEIO: pos_ins = OCUPACAO / 2; pos_rem = OCUPACAO / 2; break;
+			case FINAL: pos_ins = OCUPACAO; pos_rem = OCUPACAO; break;
+			case ALEATORIO: pos_ins = sortear(OCUPACAO + 1); pos_rem = sortear(OCUPACAO + 1); break;
+			default: pos_ins = OCUPACAO; pos_rem = 0; break;
+		}
+		inserir(li, i, pos_ins);
+		soma += remover(li, pos_rem);
+	}
+	double t = agora_ns() - t0;
+	sumidouro = soma;
+	liberar_lista(li);
+	return t / QTD_PARES;
+}
+
+int main() {
+	conferir();
+
+	if (TAM_MAX_LISTAVET <= OCUPACAO || TAM_MAX_LISTACIRC <= OCUPACAO) {
+		printf("Capacidades pequenas demais para as medicoes: veja a linha de compilacao.\n");
+		return EXIT_SUCCESS;
+	}
+
+	const char* nomes[] = {"inicio", "meio", "final", "aleatorio", "fila"};
+	printf("ns por insercao + remocao (lista com %d elementos)\n", OCUPACAO);
+	printf("%-10s | %10s %10s\n", "padrao", "ListaVet", "ListaCirc");
+	for (int p = INICIO; p <= FILA; p++) {
+		double tv = medir(criar_lista(), (Padrao) p);
+		double tc = medir(criar_lista_circ(), (Padrao) p);
+		printf("%-10s | %10.1f %10.1f\n", nomes[p], tv, tc);
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,160 @@
+/**
+ * \file bench_listadenc_dedo.cpp
+ * \brief Mede o percurso por índice da ListaDEnc, que parte do ponto mais próximo (início, fim ou dedo).
+ *
+ * Compilação (a partir da raiz do repositório):
+ * \code {.unparsed}
+ *     g++ -O2 -Iencadeada benchmarks/bench_listadenc_dedo.cpp encadeada/listadenc.cpp \
+ *         encadeada/listaenc.cpp encadeada/poolnoh.cpp -o bench_listadenc_dedo
+ * \endcode
+ *
+ * Primeiro, uma sequência aleatória de inserções, remoções e consultas (misturando posições
+ * vizinhas e aleatórias, para exercitar o dedo) é aplicada à ListaDEnc e a um vetor de referência;
+ * qualquer divergência encerra o programa.
+ *
+ * Depois, mede-se o laço "for (i = 0; i < n; i++) soma += obter_elemento(li, i)", de frente para
+ * trás e de trás para frente, e o acesso repetido ao último elemento. Como referência do
+ * comportamento anterior (percurso sempre a partir do início), usa-se a ListaEnc, cuja função
+ * obter_elemento é idêntica à que a ListaDEnc tinha. O percurso por índice da ListaEnc é O(n^2),
+ * de modo que ela só é medida até 20 mil elementos.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "auxiliares.hpp"
+#include "listadenc.hpp"
+#include "listaenc.hpp"
+
+using namespace std;
+using medicao::agora_ns;
+using medicao::sumidouro;
+
+static unsigned semente = 12345;
+
+static int sortear(int n) {
+	semente = semente * 1103515245u + 12345u;
+	return (int) ((semente >> 4) % (unsigned) n);
+}
+
+/* Sorteia uma posição em [0, limite), em geral vizinha de "ultima" (metade das vezes). */
+static int sortear_posicao(int limite, int ultima) {
+	if (sortear(2) == 0) {
+		int pos = ultima + sortear(5) - 2;
+		if (pos >= 0 && pos < limite) {
+			return pos;
+		}
+	}
+	return sortear(limite);
+}
+
+static void conferir_com_vetor(int operacoes) {
+	ListaDEnc* li = criar_listad();
+	vector<int> oraculo;
+	int ultima = 0;
+	for (int i = 0; i < operacoes; i++) {
+		int tam = (int) oraculo.size();
+		int op = sortear(10);
+		if (tam == 0 || op < 4) {
+			int pos = sortear_posicao(tam + 1, ultima);
+			inserir(li, i, pos);
+			oraculo.insert(oraculo.begin() + pos, i);
+			ultima = pos;
+		} else if (op < 6) {
+			int pos = sortear_posicao(tam, ultima);
+			if (remover(li, pos) != oraculo[pos]) {
+				fprintf(stderr, "remover divergente na operacao %d\n", i);
+				exit(EXIT_FAILURE);
+			}
+			oraculo.erase(oraculo.begin() + pos);
+			ultima = pos;
+		} else {
+			int pos = sortear_posicao(tam, ultima);
+			if (obter_elemento(li, pos) != oraculo[pos]) {
+				fprintf(stderr, "obter_elemento divergente na operacao %d\n", i);
+				exit(EXIT_FAILURE);
+			}
+			ultima = pos;
+		}
+		if (obter_tamanho(li) != (int) oraculo.size()) {
+			fprintf(stderr, "Tamanhos divergentes na operacao %d\n", i);
+			exit(EXIT_FAILURE);
+		}
+	}
+	for (int i = (int) oraculo.size() - 1; i >= 0; i--) {
+		if (obter_elemento(li, i) != oraculo[i]) {
+			fprintf(stderr, "Conteudo final divergente na posicao %d\n", i);
+			exit(EXIT_FAILURE);
+		}
+	}
+	printf("Conferencia com um vetor: %d operacoes sem divergencias.\n", operacoes);
+	liberar_lista(li);
+}
+
+template <typename Lista>
+static double medir_crescente(Lista* li, int n) {
+	double t0 = agora_ns();
+	long long soma = 0;
+	for (int i = 0; i < n; i++) {
+		soma += obter_elemento(li, i);
+	}
+	sumidouro = soma;
+	return (agora_ns() - t0) / n;
+}
+
+template <typename Lista>
+static double medir_decrescente(Lista* li, int n) {
+	double t0 = agora_ns();
+	long long soma = 0;
+	for (int i = n - 1; i >= 0; i--) {
+		soma += obter_elemento(li, i);
+	}
+	sumidouro = soma;
+	return (agora_ns() - t0) / n;
+}
+
+template <typename Lista>
+static double medir_ultimo(Lista* li, int n) {
+	const int repeticoes = 1000;
+	double t0 = agora_ns();
+	long long soma = 0;
+	for (int i = 0; i < repeticoes; i++) {
+		soma += obter_elemento(li, n - 2);
+	}
+	sumidouro = soma;
+	return (agora_ns() - t0) / repeticoes;
+}
+
+int main() {
+	conferir_com_vetor(50000);
+
+	printf("\nns por acesso (antes = ListaEnc, que percorre sempre a partir do inicio)\n");
+	printf("%10s | %12s %12s | %12s %12s | %12s %12s\n", "n", "cresc antes", "cresc depois",
+		   "decr antes", "decr depois", "ult antes", "ult depois");
+	const int tamanhos[] = {1000, 5000, 20000, 100000, 1000000};
+	for (int n : tamanhos) {
+		ListaDEnc* depois = criar_listad();
+		for (int i = 0; i < n; i++) {
+			inserir(depois, i, i);
+		}
+		double cd = medir_crescente(depois, n);
+		double dd = medir_decrescente(depois, n);
+		double ud = medir_ultimo(depois, n);
+		liberar_lista(depois);
+
+		if (n <= 20000) {
+			ListaEnc* antes = criar_lista();
+			for (int i = n - 1; i >= 0; i--) {
+				inserir(antes, i, 0);
+			}
+			double ca = medir_crescente(antes, n);
+			double da = medir_decrescente(antes, n);
+			double ua = medir_ultimo(antes, n);
+			liberar_lista(antes);
+			printf("%10d | %12.1f %12.1f | %12.1f %12.1f | %12.1f %12.1f\n", n, ca, cd, da, dd, ua, ud);
+		} else {
+			printf("%10d | %12s %12.1f | %12s %12.1f | %12s %12.1f\n", n, "-", cd, "-", dd, "-", ud);
+		}
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,99 @@
+/**
+ * \file bench_listadesen.cpp
+ * \brief Compara a ListaDesen (com diferentes quantidades de elementos por nó) com a ListaEnc.
+ *
+ * Compilação (a partir da raiz do repositório):
+ * \code {.unparsed}
+ *     g++ -O2 -DNDEBUG -Iencadeada benchmarks/bench_listadesen.cpp encadeada/listadesen.cpp \
+ *         encadeada/listaenc.cpp encadeada/poolnoh.cpp -o bench_listadesen
+ * \endcode
+ *
+ * Para cada tamanho de lista são medidos:
+ *  - varredura: obter_elemento(li, i) para todo i (apenas em listas pequenas, pois o custo é quadrático);
+ *  - acesso aleatório: obter_elemento em posições sorteadas;
+ *  - inserção no meio: inserir(li, x, tam / 2) seguido de remover(li, tam / 2).
+ * A coluna "itens/no" igual a 1 corresponde à ListaEnc.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include "auxiliares.hpp"
+#include "listaenc.hpp"
+#include "listadesen.hpp"
+
+using namespace std;
+using medicao::agora_ns;
+using medicao::sumidouro;
+
+/* Posições sorteadas com um gerador congruencial simples, igual para todas as listas. */
+static int sortear(unsigned* semente, int n) {
+	*semente = *semente * 1103515245u + 12345u;
+	return (int) ((*semente >> 8) % (unsigned) n);
+}
+
+/* Na ListaEnc, inserir no final percorre a lista toda: por isso, ela é preenchida pelo início. */
+static void preencher(ListaEnc* li, int n) {
+	for (int i = n - 1; i >= 0; i--) {
+		inserir(li, i, 0);
+	}
+}
+
+static void preencher(ListaDesen* li, int n) {
+	for (int i = 0; i < n; i++) {
+		inserir(li, i, obter_tamanho(li));
+	}
+}
+
+template <typename Lista>
+static void medir(Lista* li, int n, int itens_por_noh) {
+	preencher(li, n);
+	long long soma = 0;
+
+	double varredura = -1;
+	if (n <= 20000) {
+		double t0 = agora_ns();
+		for (int i = 0; i < n; i++) {
+			soma += obter_elemento(li, i);
+		}
+		varredura = (agora_ns() - t0) / n;
+	}
+
+	const int acessos = 2000;
+	unsigned semente = 42;
+	double t0 = agora_ns();
+	for (int i = 0; i < acessos; i++) {
+		soma += obter_elemento(li, sortear(&semente, n));
+	}
+	double aleatorio = (agora_ns() - t0) / acessos;
+
+	const int insercoes = 500;
+	t0 = agora_ns();
+	for (int i = 0; i < insercoes; i++) {
+		inserir(li, i, n / 2);
+		soma += remover(li, n / 2);
+	}
+	double meio = (agora_ns() - t0) / insercoes;
+
+	sumidouro = soma;
+	char txt_varredura[32] = "         -";
+	if (varredura >= 0) {
+		snprintf(txt_varredura, sizeof(txt_varredura), "%10.1f", varredura);
+	}
+	printf("n=%-9d itens/no=%-4d varredura=%s ns/elem  aleatorio=%12.1f ns  meio=%12.1f ns\n",
+		n, itens_por_noh, txt_varredura, aleatorio, meio);
+}
+
+int main() {
+	const int fatores[] = {5, 13, 29, 61, 125};
+	for (int n = 1000; n <= 1000000; n *= 10) {
+		ListaEnc* enc = criar_lista();
+		medir(enc, n, 1);
+		liberar_lista(enc);
+		for (size_t f = 0; f < sizeof(fatores) / sizeof(fatores[0]); f++) {
+			ListaDesen* li = criar_lista_desen(fatores[f]);
+			medir(li, n, fatores[f]);
+			liberar_lista(li);
+		}
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,215 @@
+/**
+ * \file bench_listadind.cpp
+ * \brief Compara a memória ocupada e o tempo de percurso da ListaDInd (nós em um vetor, ligados por
+ * índices) com os da ListaDEnc (nós ligados por ponteiros, alocados pelo pool).
+ *
+ * Compilação (a partir da raiz do repositório):
+ * \code {.unparsed}
+ *     g++ -O2 -DNDEBUG -Iencadeada benchmarks/bench_listadind.cpp encadeada/listadind.cpp \
+ *         encadeada/listadenc.cpp encadeada/poolnoh.cpp -o bench_listadind
+ * \endcode
+ *
+ * Os operadores globais "new" e "delete" são substituídos para medir a memória em uso (com
+ * malloc_usable_size, da glibc, que inclui o arredondamento feito pelo alocador).
+ *
+ * Para cada tamanho, as duas listas recebem os mesmos elementos, inseridos no fim, e são medidos:
+ *  - bytes/elem: memória em uso pela lista, dividida pela quantidade de elementos;
+ *  - sequencial: percurso com obter_elemento(li, i), logo após as inserções;
+ *  - embaralhada: o mesmo percurso depois de rodadas que removem metade dos elementos e os inserem
+ *    de novo no fim, reaproveitando os nós livres, de modo que nós vizinhos na lista ficam
+ *    espalhados pela memória;
+ *  - compactada: o mesmo percurso após compactar (apenas ListaDInd);
+ *  - liberar: tempo de liberar_lista.
+ *
+ * Antes das medições, a ListaDInd recebe uma sequência aleatória de operações, conferida com uma
+ * std::deque; qualquer divergência encerra o programa.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <malloc.h>
+#include <new>
+#include "auxiliares.hpp"
+#include "listadenc.hpp"
+#include "listadind.hpp"
+
+using namespace std;
+using medicao::agora_ns;
+using medicao::falhar;
+using medicao::sumidouro;
+
+static long long bytes_em_uso = 0;
+
+void* operator new(size_t tam) {
+	void* p = malloc(tam ? tam : 1);
+	if (p == NULL) {
+		throw bad_alloc();
+	}
+	bytes_em_uso += malloc_usable_size(p);
+	return p;
+}
+
+void operator delete(void* p) noexcept {
+	if (p != NULL) {
+		bytes_em_uso -= malloc_usable_size(p);
+	}
+	free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+	operator delete(p);
+}
+
+static unsigned semente = 2026;
+
+static int sortear(int n) {
+	semente = semente * 1103515245u + 12345u;
+	return (int) ((semente >> 8) % (unsigned) n);
+}
+
+static void conferir() {
+	ListaDInd* li = criar_lista_dind();
+	deque<int> d;
+	for (int i = 0; i < 200000; i++) {
+		int op = sortear(8);
+		int item = sortear(1000);
+		int tam = (int) d.size();
+		if (op == 0) {
+			inserir_no_inicio(li, item);
+			d.push_front(item);
+		} else if (op == 1 && tam < 3000) {
+			inserir_no_fim(li, item);
+			d.push_back(item);
+		} else if (op == 2 && tam < 3000) {
+			int pos = sortear(tam + 1);
+			inserir(li, item, pos);
+			d.insert(d.begin() + pos, item);
+		} else if (op == 3 && tam > 0) {
+			if (remover_inicio(li) != d.front()) {
+				falhar("ListaDInd: remover_inicio divergente");
+			}
+			d.pop_front();
+		} else if (op == 4 && tam > 0) {
+			if (remover_fim(li) != d.back()) {
+				falhar("ListaDInd: remover_fim divergente");
+			}
+			d.pop_back();
+		} else if (op == 5 && tam > 0) {
+			int pos = sortear(tam);
+			if (remover(li, pos) != d[pos]) {
+				falhar("ListaDInd: remover divergente");
+			}
+			d.erase(d.begin() + pos);
+		} else if (op == 6 && tam > 0) {
+			int pos = sortear(tam);
+			if (obter_elemento(li, pos) != d[pos]) {
+				falhar("ListaDInd: obter_elemento divergente");
+			}
+		} else if (op == 7 && sortear(100) == 0) {
+			compactar(li);
+		}
+		if (obter_tamanho(li) != (int) d.size() || estah_vazia(li) != d.empty()) {
+			falhar("ListaDInd: tamanho divergente");
+		}
+		if (!d.empty() && (obter_inicio(li) != d.front() || obter_fim(li) != d.back())) {
+			falhar("ListaDInd: extremidades divergentes");
+		}
+	}
+	for (int i = 0; i < (int) d.size(); i++) {
+		if (obter_elemento(li, i) != d[i]) {
+			falhar("ListaDInd: elementos divergentes");
+		}
+	}
+	liberar_lista(li);
+	printf("Conferencia da ListaDInd: sem divergencias.\n\n");
+}
+
+/* Retorna o tempo médio, por elemento, de um percurso com obter_elemento. */
+template <typename Lista>
+static double percorrer(Lista* li) {
+	int n = obter_tamanho(li);
+	int repeticoes = (n < 10000000) ? 10000000 / n : 1;
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int r = 0; r < repeticoes; r++) {
+		for (int i = 0; i < n; i++) {
+			soma += obter_elemento(li, i);
+		}
+	}
+	double t = agora_ns() - t0;
+	sumidouro = soma;
+	return t / ((double) n * repeticoes);
+}
+
+/*
+ * Em cada rodada, percorre a lista removendo cada elemento com probabilidade 1/2 (as remoções
+ * sequenciais custam O(1), graças ao dedo) e insere no fim a mesma quantidade de elementos.
+ */
+template <typename Lista>
+static void embaralhar(Lista* li, unsigned semente_rodadas) {
+	unsigned semente_original = semente;
+	semente = semente_rodadas;
+	for (int rodada = 0; rodada < 4; rodada++) {
+		int removidos = 0;
+		for (int pos = 0; pos < obter_tamanho(li); ) {
+			if (sortear(2) == 0) {
+				remover(li, pos);
+				removidos++;
+			} else {
+				pos++;
+			}
+		}
+		for (int i = 0; i < removidos; i++) {
+			inserir_no_fim(li, i);
+		}
+	}
+	semente = semente_original;
+}
+
+/* Apenas a ListaDInd pode ser compactada. */
+static void compactar_se_possivel(ListaDEnc*) {
+}
+
+static void compactar_se_possivel(ListaDInd* li) {
+	compactar(li);
+}
+
+template <typename Lista>
+static void medir(const char* nome, Lista* (*criar)(), int n, bool compactavel) {
+	long long bytes_antes = bytes_em_uso;
+	Lista* li = criar();
+	for (int i = 0; i < n; i++) {
+		inserir_no_fim(li, i);
+	}
+	double bytes = (double) (bytes_em_uso - bytes_antes) / n;
+	double sequencial = percorrer(li);
+	embaralhar(li, 42);
+	double embaralhada = percorrer(li);
+
+	char txt_compactada[32] = "         -";
+	if (compactavel) {
+		compactar_se_possivel(li);
+		snprintf(txt_compactada, sizeof(txt_compactada), "%10.2f", percorrer(li));
+	}
+
+	double t0 = agora_ns();
+	liberar_lista(li);
+	double liberar = agora_ns() - t0;
+
+	printf("%10d %-10s %10.1f %10.2f %10.2f %s %12.0f\n", n, nome, bytes, sequencial, embaralhada,
+		txt_compactada, liberar);
+}
+
+int main() {
+	conferir();
+
+	printf("%10s %-10s %10s %10s %10s %10s %12s\n", "tamanho", "lista", "bytes/elem", "sequencial",
+		"embaralhada", "compactada", "liberar (ns)");
+	for (int n = 1000; n <= 10000000; n *= 10) {
+		medir("ListaDEnc", criar_listad, n, false);
+		medir("ListaDInd", criar_lista_dind, n, true);
+	}
+	printf("\n(sequencial, embaralhada e compactada em ns por elemento)\n");
+	return EXIT_SUCCESS;
+}
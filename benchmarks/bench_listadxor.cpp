@@ -0,0 +1,253 @@
+/**
+ * \file bench_listadxor.cpp
+ * \brief Compara a memória ocupada e a vazão da ListaDXor (ligações XOR de 32 bits) com as da
+ * ListaDEnc (nós com dois ponteiros).
+ *
+ * Compilação (a partir da raiz do repositório):
+ * \code {.unparsed}
+ *     g++ -O2 -DNDEBUG -Iencadeada benchmarks/bench_listadxor.cpp encadeada/listadxor.cpp \
+ *         encadeada/listadenc.cpp encadeada/poolnoh.cpp -o bench_listadxor
+ * \endcode
+ *
+ * Os operadores globais "new" e "delete" são substituídos para medir a memória em uso (com
+ * malloc_usable_size, da glibc, que inclui o arredondamento feito pelo alocador).
+ *
+ * São medidos:
+ *  - bytes por elemento em 1 milhão de listas com poucos elementos cada e em uma única lista grande,
+ *    contando também a estrutura de cada lista (e, na ListaDEnc, o seu pool);
+ *  - extremidades: inserir_no_fim seguido de remover_inicio (uso como fila) e inserir_no_inicio
+ *    seguido de remover_inicio (uso como pilha), em ns por par de operações;
+ *  - percurso com cursor, do início para o fim e do fim para o início, em ns por elemento.
+ *
+ * Antes das medições, a ListaDXor recebe uma sequência aleatória de operações, conferida com uma
+ * std::deque; qualquer divergência encerra o programa.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <malloc.h>
+#include <new>
+#include <vector>
+#include "auxiliares.hpp"
+#include "listadenc.hpp"
+#include "listadxor.hpp"
+
+using namespace std;
+using medicao::agora_ns;
+using medicao::falhar;
+using medicao::sumidouro;
+
+static long long bytes_em_uso = 0;
+
+void* operator new(size_t tam) {
+	void* p = malloc(tam ? tam : 1);
+	if (p == NULL) {
+		throw bad_alloc();
+	}
+	bytes_em_uso += malloc_usable_size(p);
+	return p;
+}
+
+void operator delete(void* p) noexcept {
+	if (p != NULL) {
+		bytes_em_uso -= malloc_usable_size(p);
+	}
+	free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+	operator delete(p);
+}
+
+static unsigned semente = 2026;
+
+static int sortear(int n) {
+	semente = semente * 1103515245u + 12345u;
+	return (int) ((semente >> 8) % (unsigned) n);
+}
+
+static void conferir_elementos(ListaDXor* li, const deque<int>& d) {
+	int i = 0;
+	for (CursorDXor c = iniciar_cursor(li); !cursor_no_fim(&c); avancar(&c)) {
+		if (i >= (int) d.size() || valor(&c) != d[i++]) {
+			falhar("ListaDXor: percurso do inicio divergente");
+		}
+	}
+	CursorDXor c = cursor_no_fim_da_lista(li);
+	while (retroceder(&c)) {
+		if (i <= 0 || valor(&c) != d[--i]) {
+			falhar("ListaDXor: percurso do fim divergente");
+		}
+	}
+	if (i != 0) {
+		falhar("ListaDXor: percurso incompleto");
+	}
+}
+
+static void conferir() {
+	ListaDXor* li = criar_lista_dxor();
+	deque<int> d;
+	for (int i = 0; i < 200000; i++) {
+		int op = sortear(7);
+		int item = sortear(1000);
+		int tam = (int) d.size();
+		if (op == 0 && tam < 500) {
+			inserir_no_inicio(li, item);
+			d.push_front(item);
+		} else if (op == 1 && tam < 500) {
+			inserir_no_fim(li, item);
+			d.push_back(item);
+		} else if (op == 2 && tam > 0) {
+			if (remover_inicio(li) != d.front()) {
+				falhar("ListaDXor: remover_inicio divergente");
+			}
+			d.pop_front();
+		} else if (op == 3 && tam > 0) {
+			if (remover_fim(li) != d.back()) {
+				falhar("ListaDXor: remover_fim divergente");
+			}
+			d.pop_back();
+		} else if (op == 4 && tam > 0) {
+			int pos = sortear(tam);
+			if (obter_elemento(li, pos) != d[pos]) {
+				falhar("ListaDXor: obter_elemento divergente");
+			}
+		} else if (op == 5 && sortear(50) == 0) {
+			conferir_elementos(li, d);
+		}
+		if (obter_tamanho(li) != (int) d.size() || estah_vazia(li) != d.empty()) {
+			falhar("ListaDXor: tamanho divergente");
+		}
+		if (!d.empty() && (obter_inicio(li) != d.front() || obter_fim(li) != d.back())) {
+			falhar("ListaDXor: extremidades divergentes");
+		}
+	}
+	conferir_elementos(li, d);
+	liberar_lista(li);
+	printf("Conferencia da ListaDXor: sem divergencias.\n\n");
+}
+
+/* Memória, em bytes por elemento, de "qtd_listas" listas com "n" elementos cada. */
+template <typename Lista>
+static double medir_memoria(Lista* (*criar)(), int qtd_listas, int n) {
+	vector<Lista*> listas(qtd_listas);
+	long long bytes_antes = bytes_em_uso;
+	for (int i = 0; i < qtd_listas; i++) {
+		listas[i] = criar();
+		for (int j = 0; j < n; j++) {
+			inserir_no_fim(listas[i], j);
+		}
+	}
+	double bytes = (double) (bytes_em_uso - bytes_antes) / ((double) qtd_listas * n);
+	for (int i = 0; i < qtd_listas; i++) {
+		liberar_lista(listas[i]);
+	}
+	return bytes;
+}
+
+/* Tempo, em ns, de cada par de operações nas extremidades, com a lista mantendo "n" elementos. */
+template <typename Lista>
+static double medir_extremidades(Lista* (*criar)(), int n, bool como_fila) {
+	Lista* li = criar();
+	for (int i = 0; i < n; i++) {
+		inserir_no_fim(li, i);
+	}
+	const int pares = 20000000;
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int i = 0; i < pares; i++) {
+		if (como_fila) {
+			inserir_no_fim(li, i);
+		} else {
+			inserir_no_inicio(li, i);
+		}
+		soma += remover_inicio(li);
+	}
+	double t = agora_ns() - t0;
+	sumidouro = soma;
+	liberar_lista(li);
+	return t / pares;
+}
+
+/* Percursos com cursor: as duas listas têm as mesmas funções, com tipos de cursor diferentes. */
+static long long somar_para_frente(ListaDEnc* li) {
+	long long soma = 0;
+	for (CursorDEnc c = iniciar_cursor(li); !cursor_no_fim(&c); avancar(&c)) {
+		soma += valor(&c);
+	}
+	return soma;
+}
+
+static long long somar_para_frente(ListaDXor* li) {
+	long long soma = 0;
+	for (CursorDXor c = iniciar_cursor(li); !cursor_no_fim(&c); avancar(&c)) {
+		soma += valor(&c);
+	}
+	return soma;
+}
+
+static long long somar_para_tras(ListaDEnc* li) {
+	long long soma = 0;
+	CursorDEnc c = cursor_no_fim_da_lista(li);
+	while (retroceder(&c)) {
+		soma += valor(&c);
+	}
+	return soma;
+}
+
+static long long somar_para_tras(ListaDXor* li) {
+	long long soma = 0;
+	CursorDXor c = cursor_no_fim_da_lista(li);
+	while (retroceder(&c)) {
+		soma += valor(&c);
+	}
+	return soma;
+}
+
+/* Tempo, em ns por elemento, do percurso em um sentido, repetido até somar 100 milhões de elementos. */
+template <typename Lista>
+static double medir_percurso(Lista* (*criar)(), int n, bool para_frente) {
+	Lista* li = criar();
+	for (int i = 0; i < n; i++) {
+		inserir_no_fim(li, i);
+	}
+	int repeticoes = (n < 100000000) ? 100000000 / n : 1;
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int r = 0; r < repeticoes; r++) {
+		soma += para_frente ? somar_para_frente(li) : somar_para_tras(li);
+	}
+	double t = agora_ns() - t0;
+	sumidouro = soma;
+	liberar_lista(li);
+	return t / ((double) n * repeticoes);
+}
+
+int main() {
+	conferir();
+
+	printf("Memoria (bytes por elemento, incluindo a estrutura de cada lista):\n");
+	printf("%12s %12s %12s %12s\n", "listas", "elem/lista", "ListaDEnc", "ListaDXor");
+	const int configuracoes[][2] = {{1000000, 1}, {1000000, 4}, {1000000, 16}, {1, 1000000}, {1, 10000000}};
+	for (size_t i = 0; i < sizeof(configuracoes) / sizeof(configuracoes[0]); i++) {
+		int qtd = configuracoes[i][0];
+		int n = configuracoes[i][1];
+		printf("%12d %12d %12.1f %12.1f\n", qtd, n, medir_memoria(criar_listad, qtd, n),
+			medir_memoria(criar_lista_dxor, qtd, n));
+	}
+
+	printf("\nVazao (ns por par de operacoes ou por elemento percorrido):\n");
+	printf("%10s %-22s %12s %12s\n", "tamanho", "operacao", "ListaDEnc", "ListaDXor");
+	for (int n = 1000; n <= 10000000; n *= 100) {
+		printf("%10d %-22s %12.2f %12.2f\n", n, "fila (fim -> inicio)", medir_extremidades(criar_listad, n, true),
+			medir_extremidades(criar_lista_dxor, n, true));
+		printf("%10d %-22s %12.2f %12.2f\n", n, "pilha (inicio)", medir_extremidades(criar_listad, n, false),
+			medir_extremidades(criar_lista_dxor, n, false));
+		printf("%10d %-22s %12.2f %12.2f\n", n, "percurso para frente", medir_percurso(criar_listad, n, true),
+			medir_percurso(criar_lista_dxor, n, true));
+		printf("%10d %-22s %12.2f %12.2f\n", n, "percurso para tras", medir_percurso(criar_listad, n, false),
+			medir_percurso(criar_lista_dxor, n, false));
+	}
+	return EXIT_SUCCESS;
+}
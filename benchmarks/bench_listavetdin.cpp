@@ -0,0 +1,124 @@
+/**
+ * \file bench_listavetdin.cpp
+ * \brief Compara a vazão de inserções no final da ListaVet, da ListaVetDin e do std::vector<int>.
+ *
+ * Compilação (a partir da raiz do repositório):
+ * \code {.unparsed}
+ *     g++ -O2 -DNDEBUG -Iarray benchmarks/bench_listavetdin.cpp array/listavet.cpp array/listavetdin.cpp \
+ *         array/ordenacao.cpp array/varredura.cpp -o bench_listavetdin
+ * \endcode
+ *
+ * Como a ListaVet suporta no máximo TAM_MAX elementos, as três estruturas são comparadas
+ * em ciclos de TAM_MAX inserções seguidas de TAM_MAX remoções do final. Em seguida, apenas
+ * a ListaVetDin e o std::vector<int> são comparados com milhões de elementos.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "auxiliares.hpp"
+#include "listavet.hpp"
+#include "listavetdin.hpp"
+
+using namespace std;
+using medicao::agora_ns;
+using medicao::sumidouro;
+
+static void ciclos_listavet(int ciclos) {
+	ListaVet* li = criar_lista();
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int c = 0; c < ciclos; c++) {
+		for (int i = 0; i < TAM_MAX; i++) {
+			inserir(li, i, obter_tamanho(li));
+		}
+		while (!estah_vazia(li)) {
+			soma += remover(li, obter_tamanho(li) - 1);
+		}
+	}
+	double t1 = agora_ns();
+	sumidouro = soma;
+	printf("%-28s %10.2f ns/insercao+remocao\n", "ListaVet (TAM_MAX)", (t1 - t0) / ((double) ciclos * TAM_MAX));
+	liberar_lista(li);
+}
+
+static void ciclos_listavetdin(int ciclos) {
+	ListaVetDin* li = criar_lista_din();
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int c = 0; c < ciclos; c++) {
+		for (int i = 0; i < TAM_MAX; i++) {
+			inserir(li, i, obter_tamanho(li));
+		}
+		while (!estah_vazia(li)) {
+			soma += remover(li, obter_tamanho(li) - 1);
+		}
+	}
+	double t1 = agora_ns();
+	sumidouro = soma;
+	printf("%-28s %10.2f ns/insercao+remocao\n", "ListaVetDin (TAM_MAX)", (t1 - t0) / ((double) ciclos * TAM_MAX));
+	liberar_lista(li);
+}
+
+static void ciclos_vector(int ciclos) {
+	vector<int> v;
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int c = 0; c < ciclos; c++) {
+		for (int i = 0; i < TAM_MAX; i++) {
+			v.push_back(i);
+		}
+		while (!v.empty()) {
+			soma += v.back();
+			v.pop_back();
+		}
+	}
+	double t1 = agora_ns();
+	sumidouro = soma;
+	printf("%-28s %10.2f ns/insercao+remocao\n", "std::vector<int> (TAM_MAX)", (t1 - t0) / ((double) ciclos * TAM_MAX));
+}
+
+static void anexar_listavetdin(int n, bool reservado) {
+	double t0 = agora_ns();
+	ListaVetDin* li = criar_lista_din();
+	if (reservado) {
+		reservar(li, n);
+	}
+	for (int i = 0; i < n; i++) {
+		inserir(li, i, obter_tamanho(li));
+	}
+	double t1 = agora_ns();
+	sumidouro = obter(li, n - 1);
+	printf("%-28s n=%-10d %8.2f ns/insercao\n", reservado ? "ListaVetDin (reservar)" : "ListaVetDin",
+		n, (t1 - t0) / n);
+	liberar_lista(li);
+}
+
+static void anexar_vector(int n, bool reservado) {
+	double t0 = agora_ns();
+	vector<int> v;
+	if (reservado) {
+		v.reserve(n);
+	}
+	for (int i = 0; i < n; i++) {
+		v.push_back(i);
+	}
+	double t1 = agora_ns();
+	sumidouro = v[n - 1];
+	printf("%-28s n=%-10d %8.2f ns/insercao\n", reservado ? "std::vector<int> (reserve)" : "std::vector<int>",
+		n, (t1 - t0) / n);
+}
+
+int main() {
+	ciclos_listavet(100000);
+	ciclos_listavetdin(100000);
+	ciclos_vector(100000);
+
+	for (int n = 1000000; n <= 32000000; n *= 4) {
+		anexar_listavetdin(n, false);
+		anexar_listavetdin(n, true);
+		anexar_vector(n, false);
+		anexar_vector(n, true);
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,286 @@
+/**
+ * \file bench_lote_enc.cpp
+ * \brief Compara as operações em lote das EDs encadeadas com as operações de um elemento por vez.
+ *
+ * Compilação (a partir da raiz do repositório):
+ * \code {.unparsed}
+ *     g++ -O2 -DNDEBUG -Iencadeada benchmarks/bench_lote_enc.cpp encadeada/poolnoh.cpp encadeada/pilhaenc.cpp \
+ *         encadeada/filaenc.cpp encadeada/listaenc.cpp encadeada/listadenc.cpp -o bench_lote_enc
+ * \endcode
+ *
+ * Antes das medições, cada ED recebe uma sequência aleatória de operações em lote, intercaladas
+ * com acessos por posição (que movem o dedo da ListaDEnc), e o resultado é conferido com uma ED da
+ * biblioteca padrão; qualquer divergência encerra o programa.
+ *
+ * Cada medição move 2^22 elementos (2^16, nas listas) em lotes de 1 a 4096 elementos e informa o
+ * custo por elemento das operações de um elemento por vez (laço) e das operações em lote. Nas listas,
+ * os lotes são inseridos e removidos no meio de uma lista que já tem 2048 elementos: um por vez, cada
+ * operação da ListaEnc percorre a lista até a posição, enquanto a ListaDEnc aproveita o dedo.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <vector>
+#include "auxiliares.hpp"
+#include "filaenc.hpp"
+#include "listadenc.hpp"
+#include "listaenc.hpp"
+#include "pilhaenc.hpp"
+
+using namespace std;
+using medicao::agora_ns;
+using medicao::falhar;
+using medicao::sumidouro;
+
+static const int TOTAL = 1 << 22;
+static const int TOTAL_LISTA = 1 << 16;
+static const int MAIOR_LOTE = 4096;
+static const int OCUPACAO_LISTA = 2048;
+
+static unsigned semente = 2026;
+
+static int sortear(int n) {
+	semente = semente * 1103515245u + 12345u;
+	return (int) ((semente >> 8) % (unsigned) n);
+}
+
+static int entrada[MAIOR_LOTE];
+static int saida[MAIOR_LOTE];
+
+static void conferir() {
+	int proximo = 0;
+
+	PilhaEnc* p = criar_pilha();
+	FilaEnc* f = criar_fila();
+	vector<int> pilha;
+	deque<int> fila;
+	for (int i = 0; i < 20000; i++) {
+		int n = sortear(256);
+		for (int j = 0; j < n; j++) {
+			entrada[j] = proximo++;
+		}
+		if (sortear(2) == 0) {
+			empilhar_varios(p, entrada, n);
+			pilha.insert(pilha.end(), entrada, entrada + n);
+			inserir_lote(f, entrada, n);
+			fila.insert(fila.end(), entrada, entrada + n);
+		} else {
+			if ((int) pilha.size() >= n) {
+				desempilhar_varios(p, saida, n);
+				for (int j = n - 1; j >= 0; j--) {
+					if (saida[j] != pilha.back()) {
+						falhar("PilhaEnc divergente");
+					}
+					pilha.pop_back();
+				}
+				if (estah_vazia(p) != pilha.empty()) {
+					falhar("PilhaEnc divergente (vazia)");
+				}
+			}
+			if ((int) fila.size() >= n) {
+				remover_lote(f, saida, n);
+				for (int j = 0; j < n; j++) {
+					if (saida[j] != fila.front()) {
+						falhar("FilaEnc divergente");
+					}
+					fila.pop_front();
+				}
+				// Confere também o ponteiro "fim", que deve ser nulo se a fila esvaziou
+				inserir(f, -1);
+				fila.push_back(-1);
+			}
+		}
+	}
+	liberar_pilha(p);
+	liberar_fila(f);
+
+	ListaEnc* le = criar_lista();
+	ListaDEnc* ld = criar_listad();
+	vector<int> oraculo;
+	for (int i = 0; i < 20000; i++) {
+		int tam = (int) oraculo.size();
+		int n = sortear(64);
+		if (sortear(2) == 0 && tam < 3000) {
+			int pos = sortear(tam + 1);
+			for (int j = 0; j < n; j++) {
+				entrada[j] = proximo++;
+			}
+			inserir_intervalo(le, pos, entrada, entrada + n);
+			inserir_intervalo(ld, pos, entrada, entrada + n);
+			oraculo.insert(oraculo.begin() + pos, entrada, entrada + n);
+		} else if (tam >= n) {
+			int pos = sortear(tam - n + 1);
+			remover_intervalo(le, pos, n, saida);
+			for (int j = 0; j < n; j++) {
+				if (saida[j] != oraculo[pos + j]) {
+					falhar("ListaEnc divergente (itens removidos)");
+				}
+			}
+			remover_intervalo(ld, pos, n, (i % 2 == 0) ? NULL : saida);
+			if (i % 2 != 0) {
+				for (int j = 0; j < n; j++) {
+					if (saida[j] != oraculo[pos + j]) {
+						falhar("ListaDEnc divergente (itens removidos)");
+					}
+				}
+			}
+			oraculo.erase(oraculo.begin() + pos, oraculo.begin() + pos + n);
+		}
+		// Acessos por posição, que movem o dedo da ListaDEnc para pontos aleatórios
+		if (!oraculo.empty()) {
+			int pos = sortear((int) oraculo.size());
+			if (obter_elemento(ld, pos) != oraculo[pos]) {
+				falhar("ListaDEnc divergente (dedo)");
+			}
+		}
+		if (i % 97 == 0) {
+			if (obter_tamanho(le) != (int) oraculo.size() || obter_tamanho(ld) != (int) oraculo.size()) {
+				falhar("ListaEnc/ListaDEnc divergente (tamanho)");
+			}
+			CursorEnc c = iniciar_cursor(le);
+			for (int j = 0; j < (int) oraculo.size(); j++, avancar(&c)) {
+				if (valor(&c) != oraculo[j]) {
+					falhar("ListaEnc divergente (conteudo)");
+				}
+			}
+			// Percorre a ListaDEnc de trás para frente, conferindo os ponteiros "ant" e "fim"
+			CursorDEnc d = cursor_no_fim_da_lista(ld);
+			for (int j = (int) oraculo.size() - 1; j >= 0; j--) {
+				if (!retroceder(&d) || valor(&d) != oraculo[j]) {
+					falhar("ListaDEnc divergente (conteudo)");
+				}
+			}
+		}
+	}
+	liberar_lista(le);
+	liberar_lista(ld);
+	printf("Conferencia das operacoes em lote: sem divergencias.\n\n");
+}
+
+static double pilha_unitaria(int lote) {
+	PilhaEnc* p = criar_pilha();
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int k = 0; k < TOTAL; k += lote) {
+		for (int j = 0; j < lote; j++) {
+			empilhar(p, entrada[j]);
+		}
+		for (int j = 0; j < lote; j++) {
+			soma += desempilhar(p);
+		}
+	}
+	double t = agora_ns() - t0;
+	sumidouro = soma;
+	liberar_pilha(p);
+	return t / TOTAL;
+}
+
+static double pilha_lote(int lote) {
+	PilhaEnc* p = criar_pilha();
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int k = 0; k < TOTAL; k += lote) {
+		empilhar_varios(p, entrada, lote);
+		desempilhar_varios(p, saida, lote);
+		soma += saida[0];
+	}
+	double t = agora_ns() - t0;
+	sumidouro = soma;
+	liberar_pilha(p);
+	return t / TOTAL;
+}
+
+static double fila_unitaria(int lote) {
+	FilaEnc* f = criar_fila();
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int k = 0; k < TOTAL; k += lote) {
+		for (int j = 0; j < lote; j++) {
+			inserir(f, entrada[j]);
+		}
+		for (int j = 0; j < lote; j++) {
+			soma += remover(f);
+		}
+	}
+	double t = agora_ns() - t0;
+	sumidouro = soma;
+	liberar_fila(f);
+	return t / TOTAL;
+}
+
+static double fila_lote(int lote) {
+	FilaEnc* f = criar_fila();
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int k = 0; k < TOTAL; k += lote) {
+		inserir_lote(f, entrada, lote);
+		remover_lote(f, saida, lote);
+		soma += saida[0];
+	}
+	double t = agora_ns() - t0;
+	sumidouro = soma;
+	liberar_fila(f);
+	return t / TOTAL;
+}
+
+/* Mede inserções e remoções no meio de uma lista com OCUPACAO_LISTA elementos. */
+template <typename Lista>
+static double lista_unitaria(Lista* li, int lote) {
+	for (int i = 0; i < OCUPACAO_LISTA; i++) {
+		inserir(li, i, i);
+	}
+	const int meio = OCUPACAO_LISTA / 2;
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int k = 0; k < TOTAL_LISTA; k += lote) {
+		for (int j = 0; j < lote; j++) {
+			inserir(li, entrada[j], meio + j);
+		}
+		for (int j = 0; j < lote; j++) {
+			soma += remover(li, meio);
+		}
+	}
+	double t = agora_ns() - t0;
+	sumidouro = soma;
+	liberar_lista(li);
+	return t / TOTAL_LISTA;
+}
+
+template <typename Lista>
+static double lista_lote(Lista* li, int lote) {
+	for (int i = 0; i < OCUPACAO_LISTA; i++) {
+		inserir(li, i, i);
+	}
+	const int meio = OCUPACAO_LISTA / 2;
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int k = 0; k < TOTAL_LISTA; k += lote) {
+		inserir_intervalo(li, meio, entrada, entrada + lote);
+		remover_intervalo(li, meio, lote, saida);
+		soma += saida[0];
+	}
+	double t = agora_ns() - t0;
+	sumidouro = soma;
+	liberar_lista(li);
+	return t / TOTAL_LISTA;
+}
+
+int main() {
+	conferir();
+
+	for (int i = 0; i < MAIOR_LOTE; i++) {
+		entrada[i] = i;
+	}
+
+	printf("ns por elemento (insercao + remocao): um por vez / em lote\n");
+	printf("%6s | %17s %17s %17s %17s\n", "lote", "PilhaEnc", "FilaEnc", "ListaEnc", "ListaDEnc");
+	for (int lote = 1; lote <= MAIOR_LOTE; lote *= 4) {
+		printf("%6d | %8.3f/%-8.3f %8.3f/%-8.3f %8.2f/%-8.2f %8.2f/%-8.2f\n", lote,
+			pilha_unitaria(lote), pilha_lote(lote),
+			fila_unitaria(lote), fila_lote(lote),
+			lista_unitaria(criar_lista(), lote), lista_lote(criar_lista(), lote),
+			lista_unitaria(criar_listad(), lote), lista_lote(criar_listad(), lote));
+	}
+	return EXIT_SUCCESS;
+}
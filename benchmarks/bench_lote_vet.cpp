@@ -0,0 +1,334 @@
+/**
+ * \file bench_lote_vet.cpp
+ * \brief Compara as operações em lote das EDs com arranjo com as operações de um elemento por vez.
+ *
+ * Compilação (a partir da raiz do repositório):
+ * \code {.unparsed}
+ *     g++ -O2 -DNDEBUG -DTAM_MAX_FILAVET=8192 -DTAM_MAX_FILADVET=8192 -DTAM_MAX_LISTAVET=8192 \
+ *         -Iarray benchmarks/bench_lote_vet.cpp array/pilhavet.cpp array/filavet.cpp \
+ *         array/filadvet.cpp array/listavet.cpp array/listavetdin.cpp \
+ *         array/ordenacao.cpp array/varredura.cpp -o bench_lote_vet
+ * \endcode
+ *
+ * As capacidades das filas e da ListaVet são aumentadas para comportar lotes de até 4096 elementos
+ * (e, sendo potências de dois, as filas usam máscara de bits). Os mesmos valores devem ser usados em
+ * todos os arquivos compilados.
+ *
+ * Antes das medições, cada ED recebe uma sequência aleatória de operações em lote, com tamanhos
+ * que fazem os índices das filas darem a volta no vetor, e o resultado é conferido com uma ED da
+ * biblioteca padrão; qualquer divergência encerra o programa.
+ *
+ * Cada medição move 2^22 elementos (2^16, nas listas) em lotes de 1 a 4096 elementos e informa o
+ * custo por elemento das operações de um elemento por vez (laço) e das operações em lote. Nas listas,
+ * os lotes são inseridos e removidos na posição 0 de uma lista que já tem 2048 elementos, de modo que
+ * cada operação desloca o restante da lista.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <vector>
+#include "auxiliares.hpp"
+#include "filadvet.hpp"
+#include "filavet.hpp"
+#include "listavet.hpp"
+#include "listavetdin.hpp"
+#include "pilhavet.hpp"
+
+using namespace std;
+using medicao::agora_ns;
+using medicao::falhar;
+using medicao::sumidouro;
+
+static const int TOTAL = 1 << 22;
+static const int MAIOR_LOTE = 4096;
+static const int OCUPACAO_LISTA = 2048;
+static const int TOTAL_LISTA = 1 << 16;
+
+static unsigned semente = 2026;
+
+static int sortear(int n) {
+	semente = semente * 1103515245u + 12345u;
+	return (int) ((semente >> 8) % (unsigned) n);
+}
+
+static void conferir() {
+	static int entrada[MAIOR_LOTE];
+	static int saida[MAIOR_LOTE];
+	int proximo = 0;
+
+	PilhaVet* p = criar_pilha();
+	FilaVet* f = criar_fila();
+	FilaDVet* d = criar_fila_d();
+	vector<int> pilha;
+	deque<int> fila;
+	deque<int> fila_d;
+	for (int i = 0; i < 20000; i++) {
+		int n = sortear(MAIOR_LOTE / 2);
+		for (int j = 0; j < n; j++) {
+			entrada[j] = proximo++;
+		}
+		bool inserir = (sortear(2) == 0);
+
+		if (inserir && (int) pilha.size() + n <= 100000) {
+			empilhar_varios(p, entrada, n);
+			pilha.insert(pilha.end(), entrada, entrada + n);
+		} else if ((int) pilha.size() >= n) {
+			desempilhar_varios(p, saida, n);
+			for (int j = n - 1; j >= 0; j--) {
+				if (saida[j] != pilha.back()) {
+					falhar("PilhaVet divergente");
+				}
+				pilha.pop_back();
+			}
+		}
+
+		if (inserir && (int) fila.size() + n < TAM_MAX_FILAVET) {
+			inserir_lote(f, entrada, n);
+			fila.insert(fila.end(), entrada, entrada + n);
+		} else if ((int) fila.size() >= n) {
+			remover_lote(f, saida, n);
+			for (int j = 0; j < n; j++) {
+				if (saida[j] != fila.front()) {
+					falhar("FilaVet divergente");
+				}
+				fila.pop_front();
+			}
+		}
+
+		int op = sortear(4);
+		if (op < 2 && (int) fila_d.size() + n < TAM_MAX_FILADVET) {
+			if (op == 0) {
+				inserir_lote_no_fim(d, entrada, n);
+				fila_d.insert(fila_d.end(), entrada, entrada + n);
+			} else {
+				inserir_lote_no_inicio(d, entrada, n);
+				fila_d.insert(fila_d.begin(), entrada, entrada + n);
+			}
+		} else if (op >= 2 && (int) fila_d.size() >= n) {
+			if (op == 2) {
+				remover_lote_do_inicio(d, saida, n);
+				for (int j = 0; j < n; j++) {
+					if (saida[j] != fila_d.front()) {
+						falhar("FilaDVet divergente (inicio)");
+					}
+					fila_d.pop_front();
+				}
+			} else {
+				remover_lote_do_fim(d, saida, n);
+				for (int j = 0; j < n; j++) {
+					if (saida[j] != fila_d[fila_d.size() - n + j]) {
+						falhar("FilaDVet divergente (fim)");
+					}
+				}
+				fila_d.resize(fila_d.size() - n);
+			}
+		}
+	}
+	liberar_pilha(p);
+	liberar_fila(f);
+	liberar_fila(d);
+
+	ListaVet* lv = criar_lista();
+	ListaVetDin* ld = criar_lista_din();
+	vector<int> oraculo;
+	for (int i = 0; i < 20000; i++) {
+		int tam = (int) oraculo.size();
+		int n = sortear(64);
+		if (sortear(2) == 0 && tam + n <= TAM_MAX_LISTAVET) {
+			int pos = sortear(tam + 1);
+			for (int j = 0; j < n; j++) {
+				entrada[j] = proximo++;
+			}
+			inserir_intervalo(lv, pos, entrada, entrada + n);
+			inserir_intervalo(ld, pos, entrada, entrada + n);
+			oraculo.insert(oraculo.begin() + pos, entrada, entrada + n);
+		} else if (tam >= n) {
+			int pos = sortear(tam - n + 1);
+			remover_intervalo(lv, pos, n, saida);
+			remover_intervalo(ld, pos, n, (i % 2 == 0) ? NULL : saida);
+			for (int j = 0; j < n; j++) {
+				if (saida[j] != oraculo[pos + j]) {
+					falhar("ListaVet/ListaVetDin divergente (itens removidos)");
+				}
+			}
+			oraculo.erase(oraculo.begin() + pos, oraculo.begin() + pos + n);
+		}
+		if (i % 97 == 0) {
+			if (obter_tamanho(lv) != (int) oraculo.size() || obter_tamanho(ld) != (int) oraculo.size()) {
+				falhar("ListaVet/ListaVetDin divergente (tamanho)");
+			}
+			for (int j = 0; j < (int) oraculo.size(); j++) {
+				if (obter(lv, j) != oraculo[j] || obter(ld, j) != oraculo[j]) {
+					falhar("ListaVet/ListaVetDin divergente (conteudo)");
+				}
+			}
+		}
+	}
+	liberar_lista(lv);
+	liberar_lista(ld);
+	printf("Conferencia das operacoes em lote: sem divergencias.\n\n");
+}
+
+static int entrada[MAIOR_LOTE];
+static int saida[MAIOR_LOTE];
+
+static double pilha_unitaria(int lote) {
+	PilhaVet* p = criar_pilha();
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int k = 0; k < TOTAL; k += lote) {
+		for (int j = 0; j < lote; j++) {
+			empilhar(p, entrada[j]);
+		}
+		for (int j = 0; j < lote; j++) {
+			soma += desempilhar(p);
+		}
+	}
+	double t = agora_ns() - t0;
+	sumidouro = soma;
+	liberar_pilha(p);
+	return t / TOTAL;
+}
+
+static double pilha_lote(int lote) {
+	PilhaVet* p = criar_pilha();
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int k = 0; k < TOTAL; k += lote) {
+		empilhar_varios(p, entrada, lote);
+		desempilhar_varios(p, saida, lote);
+		soma += saida[0];
+	}
+	double t = agora_ns() - t0;
+	sumidouro = soma;
+	liberar_pilha(p);
+	return t / TOTAL;
+}
+
+static double fila_unitaria(int lote) {
+	FilaVet* f = criar_fila();
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int k = 0; k < TOTAL; k += lote) {
+		for (int j = 0; j < lote; j++) {
+			inserir(f, entrada[j]);
+		}
+		for (int j = 0; j < lote; j++) {
+			soma += remover(f);
+		}
+	}
+	double t = agora_ns() - t0;
+	sumidouro = soma;
+	liberar_fila(f);
+	return t / TOTAL;
+}
+
+static double fila_lote(int lote) {
+	FilaVet* f = criar_fila();
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int k = 0; k < TOTAL; k += lote) {
+		inserir_lote(f, entrada, lote);
+		remover_lote(f, saida, lote);
+		soma += saida[0];
+	}
+	double t = agora_ns() - t0;
+	sumidouro = soma;
+	liberar_fila(f);
+	return t / TOTAL;
+}
+
+static double fila_d_unitaria(int lote) {
+	FilaDVet* d = criar_fila_d();
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int k = 0; k < TOTAL; k += lote) {
+		for (int j = 0; j < lote; j++) {
+			inserir_no_fim(d, entrada[j]);
+		}
+		for (int j = 0; j < lote; j++) {
+			soma += remover_do_inicio(d);
+		}
+	}
+	double t = agora_ns() - t0;
+	sumidouro = soma;
+	liberar_fila(d);
+	return t / TOTAL;
+}
+
+static double fila_d_lote(int lote) {
+	FilaDVet* d = criar_fila_d();
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int k = 0; k < TOTAL; k += lote) {
+		inserir_lote_no_fim(d, entrada, lote);
+		remover_lote_do_inicio(d, saida, lote);
+		soma += saida[0];
+	}
+	double t = agora_ns() - t0;
+	sumidouro = soma;
+	liberar_fila(d);
+	return t / TOTAL;
+}
+
+/* Mede inserções e remoções na posição 0 de uma lista com OCUPACAO_LISTA elementos. */
+template <typename Lista>
+static double lista_unitaria(Lista* li, int lote) {
+	for (int i = 0; i < OCUPACAO_LISTA; i++) {
+		inserir(li, i, i);
+	}
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int k = 0; k < TOTAL_LISTA; k += lote) {
+		for (int j = lote - 1; j >= 0; j--) {
+			inserir(li, entrada[j], 0);
+		}
+		for (int j = 0; j < lote; j++) {
+			soma += remover(li, 0);
+		}
+	}
+	double t = agora_ns() - t0;
+	sumidouro = soma;
+	liberar_lista(li);
+	return t / TOTAL_LISTA;
+}
+
+template <typename Lista>
+static double lista_lote(Lista* li, int lote) {
+	for (int i = 0; i < OCUPACAO_LISTA; i++) {
+		inserir(li, i, i);
+	}
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int k = 0; k < TOTAL_LISTA; k += lote) {
+		inserir_intervalo(li, 0, entrada, entrada + lote);
+		remover_intervalo(li, 0, lote, saida);
+		soma += saida[0];
+	}
+	double t = agora_ns() - t0;
+	sumidouro = soma;
+	liberar_lista(li);
+	return t / TOTAL_LISTA;
+}
+
+int main() {
+	conferir();
+
+	for (int i = 0; i < MAIOR_LOTE; i++) {
+		entrada[i] = i;
+	}
+
+	printf("ns por elemento (insercao + remocao): um por vez / em lote\n");
+	printf("%6s | %17s %17s %17s %17s %17s\n", "lote", "PilhaVet", "FilaVet", "FilaDVet", "ListaVet",
+		"ListaVetDin");
+	for (int lote = 1; lote <= MAIOR_LOTE; lote *= 4) {
+		printf("%6d | %8.3f/%-8.3f %8.3f/%-8.3f %8.3f/%-8.3f %8.2f/%-8.2f %8.2f/%-8.2f\n", lote,
+			pilha_unitaria(lote), pilha_lote(lote),
+			fila_unitaria(lote), fila_lote(lote),
+			fila_d_unitaria(lote), fila_d_lote(lote),
+			lista_unitaria(criar_lista(), lote), lista_lote(criar_lista(), lote),
+			lista_unitaria(criar_lista_din(), lote), lista_lote(criar_lista_din(), lote));
+	}
+	return EXIT_SUCCESS;
+}
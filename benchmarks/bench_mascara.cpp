@@ -0,0 +1,149 @@
+/**
+ * \file bench_mascara.cpp
+ * \brief Compara o avanço circular dos índices com resto da divisão e com máscara de bits.
+ *
+ * Compilação (a partir da raiz do repositório):
+ * \code {.unparsed}
+ *     g++ -O2 -DNDEBUG -I. benchmarks/bench_mascara.cpp -o bench_mascara
+ * \endcode
+ *
+ * As filas genéricas com N = 100 usam o resto da divisão por uma constante (que o compilador
+ * transforma em multiplicações e deslocamentos); com N = 128, usam uma máscara de bits. Como
+ * referência, mede-se também uma fila cuja capacidade só é conhecida durante a execução, em que
+ * o resto exige uma instrução de divisão.
+ *
+ * Cada laço insere e remove um elemento por iteração, mantendo a fila com metade da capacidade,
+ * de modo que os índices dão a volta no vetor continuamente. Antes das medições, as filas com
+ * N = 100 e N = 128 são conferidas entre si. A macro NDEBUG desativa os "assert" das filas, que
+ * a fila de referência não tem.
+ *
+ * Para a FilaVet e a FilaDVet de inteiros (array/), o mesmo efeito é obtido compilando-as com
+ * -DTAM_MAX_FILAVET=128 ou -DTAM_MAX_FILADVET=128.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include "auxiliares.hpp"
+#include "generica/filadvet.hpp"
+#include "generica/filavet.hpp"
+
+using namespace std;
+using medicao::agora_ns;
+using medicao::sumidouro;
+
+static const int ITERACOES = 100000000;
+
+/* Fila circular cujo tamanho do vetor só é conhecido durante a execução. */
+struct FilaDinamica {
+	int* itens;
+	int tam_vetor;
+	int inicio;
+	int fim;
+
+	explicit FilaDinamica(int n) : itens(new int[n]), tam_vetor(n), inicio(0), fim(0) {}
+	~FilaDinamica() { delete[] itens; }
+
+	void inserir(int item) {
+		itens[fim] = item;
+		fim = (fim + 1) % tam_vetor;
+	}
+
+	int remover() {
+		int item = itens[inicio];
+		inicio = (inicio + 1) % tam_vetor;
+		return item;
+	}
+};
+
+static void conferir() {
+	generica::FilaVet<int, 100> f100;
+	generica::FilaVet<int, 128> f128;
+	generica::FilaDVet<int, 100> d100;
+	generica::FilaDVet<int, 128> d128;
+	unsigned semente = 99;
+	int tam = 0;
+	for (int i = 0; i < 1000000; i++) {
+		semente = semente * 1103515245u + 12345u;
+		int op = (semente >> 16) % 4;
+		if (tam == 0 || (op < 2 && tam < 99)) {
+			f100.inserir(i);
+			f128.inserir(i);
+			if (op == 0) {
+				d100.inserir_no_inicio(i);
+				d128.inserir_no_inicio(i);
+			} else {
+				d100.inserir_no_fim(i);
+				d128.inserir_no_fim(i);
+			}
+			tam++;
+		} else {
+			int a = f100.remover();
+			int b = (op == 2) ? d100.remover_do_inicio() : d100.remover_do_fim();
+			int c = (op == 2) ? d128.remover_do_inicio() : d128.remover_do_fim();
+			if (a != f128.remover() || b != c) {
+				fprintf(stderr, "Filas divergentes na operacao %d\n", i);
+				exit(EXIT_FAILURE);
+			}
+			tam--;
+		}
+	}
+	printf("Conferencia das filas com N = 100 e N = 128: sem divergencias.\n\n");
+}
+
+template <typename Fila>
+static double medir_fila(Fila& f, int ocupacao) {
+	for (int i = 0; i < ocupacao; i++) {
+		f.inserir(i);
+	}
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int i = 0; i < ITERACOES; i++) {
+		f.inserir(i);
+		soma += f.remover();
+	}
+	sumidouro = soma;
+	return (agora_ns() - t0) / ITERACOES;
+}
+
+template <typename FilaD>
+static double medir_fila_d(FilaD& f, int ocupacao) {
+	for (int i = 0; i < ocupacao; i++) {
+		f.inserir_no_fim(i);
+	}
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (int i = 0; i < ITERACOES; i++) {
+		// Alterna o sentido a cada iteração, para que os dois índices deem a volta no vetor.
+		if (i & 1) {
+			f.inserir_no_inicio(i);
+			soma += f.remover_do_fim();
+		} else {
+			f.inserir_no_fim(i);
+			soma += f.remover_do_inicio();
+		}
+	}
+	sumidouro = soma;
+	return (agora_ns() - t0) / ITERACOES;
+}
+
+int main() {
+	conferir();
+
+	printf("ns por insercao + remocao\n");
+	printf("%-10s | %16s %16s %16s\n", "ED", "resto (dinamico)", "resto (N = 100)", "mascara (N = 128)");
+
+	FilaDinamica dinamica(100);
+	generica::FilaVet<int, 100> f100;
+	generica::FilaVet<int, 128> f128;
+	double td = medir_fila(dinamica, 50);
+	double t100 = medir_fila(f100, 50);
+	double t128 = medir_fila(f128, 64);
+	printf("%-10s | %16.3f %16.3f %16.3f\n", "FilaVet", td, t100, t128);
+
+	generica::FilaDVet<int, 100> d100;
+	generica::FilaDVet<int, 128> d128;
+	t100 = medir_fila_d(d100, 50);
+	t128 = medir_fila_d(d128, 64);
+	printf("%-10s | %16s %16.3f %16.3f\n", "FilaDVet", "-", t100, t128);
+	return EXIT_SUCCESS;
+}
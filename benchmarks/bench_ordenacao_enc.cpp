@@ -0,0 +1,206 @@
+/**
+ * \file bench_ordenacao_enc.cpp
+ * \brief Mede a ordenação da ListaEnc e da ListaDEnc (ordenar e ordenar_paralelo) e a compara com a
+ * abordagem anterior: copiar os elementos para um vetor, ordená-lo com std::sort e reconstruir a lista.
+ *
+ * Compilação (a partir da raiz do repositório):
+ * \code {.unparsed}
+ *     g++ -O2 -DNDEBUG -Iencadeada benchmarks/bench_ordenacao_enc.cpp encadeada/poolnoh.cpp \
+ *         encadeada/listaenc.cpp encadeada/listadenc.cpp -pthread -o bench_ordenacao_enc
+ * \endcode
+ *
+ * Uso: bench_ordenacao_enc [--tam=N] (padrão: 10 milhões).
+ *
+ * Antes das medições, listas de vários tamanhos, com elementos aleatórios, ordenados, em ordem
+ * inversa e com poucos valores distintos, são ordenadas com 1 a 8 threads e conferidas com
+ * std::stable_sort, inclusive a estabilidade (pelos endereços dos nós de elementos iguais, obtidos
+ * com endereco_do_valor) e, na ListaDEnc, o percurso do fim para o início; qualquer divergência
+ * encerra o programa.
+ *
+ * Com N elementos aleatórios, ordenados e em ordem inversa, são medidas a abordagem anterior (a
+ * cópia é feita com os iteradores, já que obter_elemento percorre a lista) e ordenar_paralelo com
+ * 1 a 32 threads. A lista é montada com inserir_intervalo, de modo que os nós começam na ordem da
+ * memória. O ganho com várias threads depende dos núcleos disponíveis, informados no início da saída.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "auxiliares.hpp"
+#include "listadenc.hpp"
+#include "listaenc.hpp"
+
+using namespace std;
+using medicao::agora_ns;
+using medicao::falhar;
+using medicao::sumidouro;
+
+static unsigned semente = 2026;
+
+static int sortear(int n) {
+	semente = semente * 1103515245u + 12345u;
+	return (int) ((semente >> 8) % (unsigned) n);
+}
+
+static unsigned estado_xorshift = 2463534242u;
+
+static int sortear_int() {
+	estado_xorshift ^= estado_xorshift << 13;
+	estado_xorshift ^= estado_xorshift >> 17;
+	estado_xorshift ^= estado_xorshift << 5;
+	return (int) estado_xorshift;
+}
+
+enum Distribuicao { ALEATORIA, ORDENADA, INVERSA, POUCOS_VALORES, QTD_DISTRIBUICOES };
+
+static const char* NOMES[] = {"aleatoria", "ordenada", "inversa", "poucos valores"};
+
+static void gerar(vector<int>& v, int n, Distribuicao d) {
+	v.resize(n);
+	for (int i = 0; i < n; i++) {
+		v[i] = (d == POUCOS_VALORES) ? sortear(4) - 2 : sortear_int();
+	}
+	if (d == ORDENADA) {
+		sort(v.begin(), v.end());
+	} else if (d == INVERSA) {
+		sort(v.begin(), v.end(), [](int a, int b) { return a > b; });
+	}
+}
+
+/* Apenas a ListaDEnc pode ser percorrida do fim para o início. */
+static void conferir_para_tras(ListaEnc*, const vector<pair<int, int*> >&) {
+}
+
+static void conferir_para_tras(ListaDEnc* li, const vector<pair<int, int*> >& esperado) {
+	int i = (int) esperado.size();
+	CursorDEnc c = cursor_no_fim_da_lista(li);
+	while (retroceder(&c)) {
+		if (i <= 0 || endereco_do_valor(&c) != esperado[--i].second) {
+			falhar("ListaDEnc", "percurso do fim divergente");
+		}
+	}
+	if (i != 0) {
+		falhar("ListaDEnc", "percurso do fim incompleto");
+	}
+}
+
+template <typename Lista>
+static void conferir_lista(const char* nome, Lista* (*criar)()) {
+	const int tamanhos[] = {0, 1, 2, 3, 17, 100, 5000, 40000, 300000};
+	vector<int> v;
+	for (int t : tamanhos) {
+		for (int d = 0; d < QTD_DISTRIBUICOES; d++) {
+			for (int threads = 1; threads <= 8; threads *= 2) {
+				gerar(v, t, (Distribuicao) d);
+				Lista* li = criar();
+				if (t > 0) {
+					inserir_intervalo(li, 0, v.data(), v.data() + t);
+				}
+
+				// Cada elemento é identificado pelo endereço do seu nó, para conferir a estabilidade.
+				vector<pair<int, int*> > esperado;
+				for (int& x : li) {
+					esperado.push_back(make_pair(x, &x));
+				}
+				stable_sort(esperado.begin(), esperado.end(),
+					[](const pair<int, int*>& a, const pair<int, int*>& b) { return a.first < b.first; });
+
+				ordenar_paralelo(li, threads);
+				if (obter_tamanho(li) != t) {
+					falhar(nome, "tamanho divergente");
+				}
+				int i = 0;
+				for (int& x : li) {
+					if (x != esperado[i].first || &x != esperado[i].second) {
+						falhar(nome, "elementos divergentes ou fora da ordem estavel");
+					}
+					i++;
+				}
+				conferir_para_tras(li, esperado);
+
+				// O fim da lista deve continuar correto para as operações seguintes.
+				if (t > 0) {
+					inserir(li, 7, t);
+					if (obter_elemento(li, t) != 7 || obter_elemento(li, t - 1) != esperado[t - 1].first) {
+						falhar(nome, "fim da lista divergente");
+					}
+				}
+				liberar_lista(li);
+			}
+		}
+	}
+}
+
+static void conferir() {
+	conferir_lista("ListaEnc", criar_lista);
+	conferir_lista("ListaDEnc", criar_listad);
+	printf("Conferencia da ordenacao da ListaEnc e da ListaDEnc: sem divergencias.\n\n");
+}
+
+/* Tempo, em ms, da abordagem anterior: copiar para um vetor, ordenar com std::sort e reconstruir a lista. */
+template <typename Lista>
+static double medir_copia(Lista* (*criar)(), const vector<int>& original) {
+	Lista* li = criar();
+	inserir_intervalo(li, 0, original.data(), original.data() + original.size());
+	double t0 = agora_ns();
+	vector<int> copia(begin(li), end(li));
+	sort(copia.begin(), copia.end());
+	liberar_lista(li);
+	li = criar();
+	inserir_intervalo(li, 0, copia.data(), copia.data() + copia.size());
+	double t = agora_ns() - t0;
+	sumidouro = obter_tamanho(li);
+	liberar_lista(li);
+	return t / 1e6;
+}
+
+template <typename Lista>
+static double medir_ordenar(Lista* (*criar)(), const vector<int>& original, int threads) {
+	Lista* li = criar();
+	inserir_intervalo(li, 0, original.data(), original.data() + original.size());
+	double t0 = agora_ns();
+	ordenar_paralelo(li, threads);
+	double t = agora_ns() - t0;
+	sumidouro = obter_tamanho(li);
+	liberar_lista(li);
+	return t / 1e6;
+}
+
+template <typename Lista>
+static void medir(const char* nome, Lista* (*criar)(), int n) {
+	printf("%-16s %12s", nome, "copia+sort");
+	for (int threads = 1; threads <= 32; threads *= 2) {
+		printf(" %9d thr", threads);
+	}
+	printf("\n");
+	vector<int> v;
+	for (int d = 0; d < POUCOS_VALORES; d++) {
+		gerar(v, n, (Distribuicao) d);
+		printf("%-16s %12.1f", NOMES[d], medir_copia(criar, v));
+		for (int threads = 1; threads <= 32; threads *= 2) {
+			printf(" %13.1f", medir_ordenar(criar, v, threads));
+		}
+		printf("\n");
+	}
+	printf("\n");
+}
+
+int main(int argc, char** argv) {
+	int n = 10000000;
+	for (int i = 1; i < argc; i++) {
+		if (strncmp(argv[i], "--tam=", 6) == 0) {
+			n = atoi(argv[i] + 6);
+		}
+	}
+
+	conferir();
+
+	printf("%d elementos; %u nucleos disponiveis. Tempos em ms.\n\n", n, thread::hardware_concurrency());
+	medir("ListaEnc", criar_lista, n);
+	medir("ListaDEnc", criar_listad, n);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,208 @@
+/**
+ * \file bench_ordenacao_vet.cpp
+ * \brief Mede a ordenação da ListaVet (ordenar e ordenar_paralelo) e a compara com a abordagem
+ * anterior: copiar os elementos com obter, ordená-los com std::sort e reconstruir a lista.
+ *
+ * Compilação (a partir da raiz do repositório):
+ * \code {.unparsed}
+ *     g++ -O2 -DNDEBUG -DTAM_MAX_LISTAVET=16777216 -Iarray benchmarks/bench_ordenacao_vet.cpp \
+ *         array/listavet.cpp array/ordenacao.cpp array/varredura.cpp -pthread -o bench_ordenacao_vet
+ * \endcode
+ *
+ * Uso: bench_ordenacao_vet [--tam=N] (padrão: 10 milhões, limitado por TAM_MAX_LISTAVET).
+ *
+ * Antes das medições, listas de vários tamanhos, com elementos aleatórios (com e sem repetições e
+ * incluindo INT_MIN e INT_MAX), ordenados, em ordem inversa e com poucos valores distintos, são
+ * ordenadas com 1 a 8 threads (também no modo lacuna) e conferidas com std::sort; qualquer
+ * divergência encerra o programa.
+ *
+ * São medidos, com N elementos aleatórios, ordenados e em ordem inversa:
+ *  - as rotinas de ordenacao.hpp sobre um vetor (introsort e radix sort) e std::sort;
+ *  - a abordagem anterior (cópia, std::sort e reconstrução) e ordenar_paralelo com 1 a 32 threads.
+ * O ganho com várias threads depende dos núcleos disponíveis, informados no início da saída.
+ */
+
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include "auxiliares.hpp"
+#include "listavet.hpp"
+#include "ordenacao.hpp"
+
+using namespace std;
+using medicao::agora_ns;
+using medicao::falhar;
+using medicao::sumidouro;
+
+static unsigned semente = 2026;
+
+static int sortear(int n) {
+	semente = semente * 1103515245u + 12345u;
+	return (int) ((semente >> 8) % (unsigned) n);
+}
+
+/* Valor aleatório em todo o intervalo de int (xorshift de 32 bits). */
+static unsigned estado_xorshift = 2463534242u;
+
+static int sortear_int() {
+	estado_xorshift ^= estado_xorshift << 13;
+	estado_xorshift ^= estado_xorshift >> 17;
+	estado_xorshift ^= estado_xorshift << 5;
+	return (int) estado_xorshift;
+}
+
+enum Distribuicao { ALEATORIA, ORDENADA, INVERSA, POUCOS_VALORES, QTD_DISTRIBUICOES };
+
+static const char* NOMES[] = {"aleatoria", "ordenada", "inversa", "poucos valores"};
+
+static void gerar(vector<int>& v, int n, Distribuicao d) {
+	v.resize(n);
+	for (int i = 0; i < n; i++) {
+		v[i] = (d == POUCOS_VALORES) ? sortear(4) - 2 : sortear_int();
+	}
+	if (n > 2 && d == ALEATORIA) {
+		v[sortear(n)] = INT_MIN;
+		v[sortear(n)] = INT_MAX;
+	}
+	if (d == ORDENADA) {
+		sort(v.begin(), v.end());
+	} else if (d == INVERSA) {
+		sort(v.begin(), v.end(), [](int a, int b) { return a > b; });
+	}
+}
+
+static void conferir() {
+	const int tamanhos[] = {0, 1, 2, 3, 17, 100, 2047, 2048, 5000, 40000, 300000};
+	vector<int> v;
+	for (int t : tamanhos) {
+		for (int d = 0; d < QTD_DISTRIBUICOES; d++) {
+			for (int threads = 1; threads <= 8; threads *= 2) {
+				gerar(v, t, (Distribuicao) d);
+				ListaVet* li = criar_lista();
+				if (t > 0) {
+					inserir_intervalo(li, 0, v.data(), v.data() + t);
+				}
+				if (threads == 2 && t > 0) {
+					// No modo lacuna, o espaço livre fica no meio do vetor antes da ordenação.
+					definir_modo_lacuna(li, true);
+					int item = remover(li, t / 2);
+					inserir(li, item, t / 2);
+				}
+				ordenar_paralelo(li, threads);
+				sort(v.begin(), v.end());
+				if (obter_tamanho(li) != t) {
+					falhar("ListaVet: tamanho divergente");
+				}
+				for (int i = 0; i < t; i++) {
+					if (obter(li, i) != v[i]) {
+						falhar("ListaVet: elementos divergentes");
+					}
+				}
+				liberar_lista(li);
+			}
+		}
+	}
+
+	// As rotinas sobre vetores, separadamente
+	for (int t : tamanhos) {
+		for (int d = 0; d < QTD_DISTRIBUICOES; d++) {
+			gerar(v, t, (Distribuicao) d);
+			vector<int> a = v;
+			vector<int> b = v;
+			ordenar_introsort(a.data(), t);
+			ordenar_radix(b.data(), t);
+			sort(v.begin(), v.end());
+			if (a != v || b != v) {
+				falhar("ordenacao.hpp: resultado divergente");
+			}
+		}
+	}
+	printf("Conferencia da ordenacao da ListaVet: sem divergencias.\n\n");
+}
+
+/* Tempo, em ms, de ordenar um vetor com a rotina informada. */
+static double medir_rotina(const vector<int>& original, int qual) {
+	vector<int> v = original;
+	double t0 = agora_ns();
+	if (qual == 0) {
+		ordenar_introsort(v.data(), (int) v.size());
+	} else if (qual == 1) {
+		ordenar_radix(v.data(), (int) v.size());
+	} else {
+		sort(v.begin(), v.end());
+	}
+	double t = agora_ns() - t0;
+	sumidouro = v[v.size() / 2];
+	return t / 1e6;
+}
+
+/* Tempo, em ms, da abordagem anterior: copiar com obter, ordenar com std::sort e reconstruir a lista. */
+static double medir_copia(ListaVet* li, const vector<int>& original) {
+	remover_intervalo(li, 0, obter_tamanho(li), NULL);
+	inserir_intervalo(li, 0, original.data(), original.data() + original.size());
+	double t0 = agora_ns();
+	int n = obter_tamanho(li);
+	vector<int> copia(n);
+	for (int i = 0; i < n; i++) {
+		copia[i] = obter(li, i);
+	}
+	sort(copia.begin(), copia.end());
+	remover_intervalo(li, 0, n, NULL);
+	inserir_intervalo(li, 0, copia.data(), copia.data() + n);
+	double t = agora_ns() - t0;
+	sumidouro = obter(li, n / 2);
+	return t / 1e6;
+}
+
+static double medir_ordenar(ListaVet* li, const vector<int>& original, int threads) {
+	remover_intervalo(li, 0, obter_tamanho(li), NULL);
+	inserir_intervalo(li, 0, original.data(), original.data() + original.size());
+	double t0 = agora_ns();
+	ordenar_paralelo(li, threads);
+	double t = agora_ns() - t0;
+	sumidouro = obter(li, obter_tamanho(li) / 2);
+	return t / 1e6;
+}
+
+int main(int argc, char** argv) {
+	int n = 10000000;
+	for (int i = 1; i < argc; i++) {
+		if (strncmp(argv[i], "--tam=", 6) == 0) {
+			n = atoi(argv[i] + 6);
+		}
+	}
+	if (n > TAM_MAX_LISTAVET) {
+		n = TAM_MAX_LISTAVET;
+	}
+
+	conferir();
+
+	printf("%d elementos; %u nucleos disponiveis. Tempos em ms.\n\n", n, thread::hardware_concurrency());
+	vector<int> v;
+	printf("%-16s %12s %12s %12s\n", "vetor", "introsort", "radix", "std::sort");
+	for (int d = 0; d < POUCOS_VALORES; d++) {
+		gerar(v, n, (Distribuicao) d);
+		printf("%-16s %12.1f %12.1f %12.1f\n", NOMES[d], medir_rotina(v, 0), medir_rotina(v, 1), medir_rotina(v, 2));
+	}
+
+	ListaVet* li = criar_lista();
+	printf("\n%-16s %12s", "ListaVet", "copia+sort");
+	for (int threads = 1; threads <= 32; threads *= 2) {
+		printf(" %9d thr", threads);
+	}
+	printf("\n");
+	for (int d = 0; d < POUCOS_VALORES; d++) {
+		gerar(v, n, (Distribuicao) d);
+		printf("%-16s %12.1f", NOMES[d], medir_copia(li, v));
+		for (int threads = 1; threads <= 32; threads *= 2) {
+			printf(" %13.1f", medir_ordenar(li, v, threads));
+		}
+		printf("\n");
+	}
+	liberar_lista(li);
+	return EXIT_SUCCESS;
+}
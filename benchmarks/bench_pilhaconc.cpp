@@ -0,0 +1,105 @@
+/**
+ * \file bench_pilhaconc.cpp
+ * \brief Compara a escalabilidade da PilhaConc (com e sem eliminação) com uma PilhaEnc protegida por um std::mutex.
+ *
+ * Compilação (a partir da raiz do repositório):
+ * \code {.unparsed}
+ *     g++ -O2 -DNDEBUG -pthread -Iencadeada benchmarks/bench_pilhaconc.cpp encadeada/pilhaconc.cpp \
+ *         encadeada/riscos.cpp encadeada/pilhaenc.cpp encadeada/poolnoh.cpp -o bench_pilhaconc
+ * \endcode
+ *
+ * Cada thread executa pares empilhar/desempilhar sobre a mesma pilha. Ao final, confere-se que a
+ * soma dos itens desempilhados é igual à soma dos itens empilhados.
+ */
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "auxiliares.hpp"
+#include "pilhaconc.hpp"
+#include "pilhaenc.hpp"
+
+using namespace std;
+using medicao::agora_ns;
+
+/* PilhaEnc compartilhada por meio de uma trava, como era feito antes da PilhaConc. */
+struct PilhaTravada {
+	PilhaEnc* pilha;
+	mutex trava;
+};
+
+static void empilhar(PilhaTravada* p, int item) {
+	lock_guard<mutex> guarda(p->trava);
+	empilhar(p->pilha, item);
+}
+
+static bool desempilhar(PilhaTravada* p, int* item) {
+	lock_guard<mutex> guarda(p->trava);
+	if (estah_vazia(p->pilha)) {
+		return false;
+	}
+	*item = desempilhar(p->pilha);
+	return true;
+}
+
+template <typename Pilha>
+static void executar(const char* nome, Pilha* p, int qtd_threads, int total) {
+	int por_thread = total / qtd_threads;
+	atomic<long long> soma_empilhada(0), soma_desempilhada(0);
+
+	double t0 = agora_ns();
+	vector<thread> threads;
+	for (int t = 0; t < qtd_threads; t++) {
+		threads.push_back(thread([p, t, por_thread, &soma_empilhada, &soma_desempilhada]() {
+			long long empilhada = 0, desempilhada = 0;
+			for (int i = 0; i < por_thread; i++) {
+				int valor = t * por_thread + i;
+				empilhar(p, valor);
+				empilhada += valor;
+				int item;
+				if (desempilhar(p, &item)) {
+					desempilhada += item;
+				}
+			}
+			soma_empilhada += empilhada;
+			soma_desempilhada += desempilhada;
+		}));
+	}
+	for (size_t i = 0; i < threads.size(); i++) {
+		threads[i].join();
+	}
+	double t1 = agora_ns();
+
+	/* Recolhe o que eventualmente sobrou na pilha. */
+	int item;
+	while (desempilhar(p, &item)) {
+		soma_desempilhada += item;
+	}
+	if (soma_empilhada.load() != soma_desempilhada.load()) {
+		fprintf(stderr, "%s: itens perdidos ou duplicados\n", nome);
+		exit(EXIT_FAILURE);
+	}
+	printf("%-26s threads=%-3d %8.2f Mpares/s\n", nome, qtd_threads, por_thread * qtd_threads / (t1 - t0) * 1e3);
+}
+
+int main() {
+	const int total = 2000000;
+	for (int qtd_threads = 1; qtd_threads <= 64; qtd_threads *= 2) {
+		PilhaTravada travada;
+		travada.pilha = criar_pilha();
+		executar("PilhaEnc + mutex", &travada, qtd_threads, total);
+		liberar_pilha(travada.pilha);
+
+		PilhaConc* p = criar_pilha_conc(0);
+		executar("PilhaConc", p, qtd_threads, total);
+		liberar_pilha(p);
+
+		p = criar_pilha_conc(16);
+		executar("PilhaConc (eliminacao 16)", p, qtd_threads, total);
+		liberar_pilha(p);
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,193 @@
+/**
+ * \file bench_poolnoh.cpp
+ * \brief Mede alocações por operação e operações por segundo das estruturas encadeadas com o pool de nós.
+ *
+ * Compilação (a partir da raiz do repositório):
+ * \code {.unparsed}
+ *     g++ -O2 -DNDEBUG -Iencadeada benchmarks/bench_poolnoh.cpp encadeada/poolnoh.cpp encadeada/filaenc.cpp \
+ *         encadeada/pilhaenc.cpp encadeada/listaenc.cpp encadeada/listadenc.cpp -o bench_poolnoh
+ * \endcode
+ *
+ * Os operadores globais "new" e "delete" são substituídos para contar as chamadas ao alocador.
+ * A linha "antes" de cada estrutura usa uma réplica mínima da implementação anterior ao pool,
+ * que executava um "new" por inserção e um "delete" por remoção.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include "auxiliares.hpp"
+#include "filaenc.hpp"
+#include "pilhaenc.hpp"
+#include "listaenc.hpp"
+#include "listadenc.hpp"
+
+using namespace std;
+using medicao::agora_ns;
+using medicao::sumidouro;
+
+static long long qtd_alocacoes = 0;
+
+void* operator new(size_t tam) {
+	qtd_alocacoes++;
+	void* p = malloc(tam ? tam : 1);
+	if (p == NULL) {
+		throw bad_alloc();
+	}
+	return p;
+}
+
+void operator delete(void* p) noexcept {
+	free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+	free(p);
+}
+
+/* Réplica da fila encadeada anterior ao pool: um "new" por inserção e um "delete" por remoção. */
+struct NohRef {
+	int item;
+	NohRef* prox;
+};
+
+struct FilaRef {
+	NohRef* inicio;
+	NohRef* fim;
+};
+
+static void inserir_ref(FilaRef* f, int item) {
+	NohRef* n = new NohRef;
+	n->item = item;
+	n->prox = NULL;
+	if (f->fim == NULL) {
+		f->inicio = n;
+	} else {
+		f->fim->prox = n;
+	}
+	f->fim = n;
+}
+
+static int remover_ref(FilaRef* f) {
+	NohRef* aux = f->inicio;
+	f->inicio = aux->prox;
+	if (f->inicio == NULL) {
+		f->fim = NULL;
+	}
+	int item = aux->item;
+	delete aux;
+	return item;
+}
+
+static void relatar(const char* nome, long long ops, double ns, long long alocacoes) {
+	printf("%-34s %10.2f Mops/s %8.4f alocacoes/op\n", nome, ops / ns * 1e3, (double) alocacoes / ops);
+}
+
+/* Mantém "profundidade" elementos na estrutura e executa "ops" pares inserção/remoção. */
+static void fila_estado_estavel(int profundidade, int ops) {
+	char nome[64];
+	long long a0 = qtd_alocacoes;
+	double t0 = agora_ns();
+	FilaRef ref = {NULL, NULL};
+	long long soma = 0;
+	for (int i = 0; i < profundidade; i++) inserir_ref(&ref, i);
+	for (int i = 0; i < ops; i++) {
+		inserir_ref(&ref, i);
+		soma += remover_ref(&ref);
+	}
+	while (ref.inicio != NULL) soma += remover_ref(&ref);
+	double t1 = agora_ns();
+	snprintf(nome, sizeof(nome), "FilaEnc antes (prof. %d)", profundidade);
+	relatar(nome, ops, t1 - t0, qtd_alocacoes - a0);
+
+	a0 = qtd_alocacoes;
+	t0 = agora_ns();
+	FilaEnc* f = criar_fila();
+	for (int i = 0; i < profundidade; i++) inserir(f, i);
+	for (int i = 0; i < ops; i++) {
+		inserir(f, i);
+		soma += remover(f);
+	}
+	liberar_fila(f);
+	t1 = agora_ns();
+	snprintf(nome, sizeof(nome), "FilaEnc pool (prof. %d)", profundidade);
+	relatar(nome, ops, t1 - t0, qtd_alocacoes - a0);
+	sumidouro = soma;
+}
+
+static void pilha_estado_estavel(int profundidade, int ops) {
+	char nome[64];
+	long long a0 = qtd_alocacoes;
+	double t0 = agora_ns();
+	PilhaEnc* p = criar_pilha();
+	long long soma = 0;
+	for (int i = 0; i < profundidade; i++) empilhar(p, i);
+	for (int i = 0; i < ops; i++) {
+		empilhar(p, i);
+		soma += desempilhar(p);
+	}
+	liberar_pilha(p);
+	double t1 = agora_ns();
+	snprintf(nome, sizeof(nome), "PilhaEnc pool (prof. %d)", profundidade);
+	relatar(nome, ops, t1 - t0, qtd_alocacoes - a0);
+	sumidouro = soma;
+}
+
+static void listas_estado_estavel(int profundidade, int ops) {
+	char nome[64];
+	long long a0 = qtd_alocacoes;
+	double t0 = agora_ns();
+	ListaEnc* li = criar_lista();
+	long long soma = 0;
+	for (int i = 0; i < profundidade; i++) inserir(li, i, 0);
+	for (int i = 0; i < ops; i++) {
+		inserir(li, i, 0);
+		soma += remover(li, 0);
+	}
+	liberar_lista(li);
+	double t1 = agora_ns();
+	snprintf(nome, sizeof(nome), "ListaEnc pool (prof. %d)", profundidade);
+	relatar(nome, ops, t1 - t0, qtd_alocacoes - a0);
+
+	a0 = qtd_alocacoes;
+	t0 = agora_ns();
+	ListaDEnc* ld = criar_listad();
+	for (int i = 0; i < profundidade; i++) inserir_no_fim(ld, i);
+	for (int i = 0; i < ops; i++) {
+		inserir_no_fim(ld, i);
+		soma += remover_inicio(ld);
+	}
+	liberar_lista(ld);
+	t1 = agora_ns();
+	snprintf(nome, sizeof(nome), "ListaDEnc pool (prof. %d)", profundidade);
+	relatar(nome, ops, t1 - t0, qtd_alocacoes - a0);
+	sumidouro = soma;
+}
+
+/* Compara o custo de liberar uma fila com n elementos nó a nó e bloco a bloco. */
+static void liberacao(int n) {
+	FilaRef ref = {NULL, NULL};
+	for (int i = 0; i < n; i++) inserir_ref(&ref, i);
+	double t0 = agora_ns();
+	while (ref.inicio != NULL) remover_ref(&ref);
+	double t1 = agora_ns();
+	printf("liberar fila de %d nos, antes: %10.3f ms\n", n, (t1 - t0) / 1e6);
+
+	FilaEnc* f = criar_fila();
+	for (int i = 0; i < n; i++) inserir(f, i);
+	t0 = agora_ns();
+	liberar_fila(f);
+	t1 = agora_ns();
+	printf("liberar fila de %d nos, pool:  %10.3f ms\n", n, (t1 - t0) / 1e6);
+}
+
+int main() {
+	const int ops = 10000000;
+	for (int profundidade = 16; profundidade <= 1048576; profundidade *= 64) {
+		fila_estado_estavel(profundidade, ops);
+		pilha_estado_estavel(profundidade, ops);
+		listas_estado_estavel(profundidade, ops);
+	}
+	liberacao(4000000);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,324 @@
+/**
+ * \file bench_varredura.cpp
+ * \brief Compara as consultas em bloco da ListaVet (buscar_primeiro, contar_ocorrencias, somar,
+ * minimo e filtrar) com laços de obter e mede cada nível de instruções (escalar, AVX2 e AVX-512).
+ *
+ * Compilação (a partir da raiz do repositório):
+ * \code {.unparsed}
+ *     g++ -O2 -DNDEBUG -DTAM_MAX_LISTAVET=134217728 -DTAM_MAX_FILAVET=4096 -DTAM_MAX_FILADVET=1000 \
+ *         -Iarray benchmarks/bench_varredura.cpp array/listavet.cpp array/filavet.cpp array/filadvet.cpp \
+ *         array/ordenacao.cpp array/varredura.cpp -o bench_varredura
+ * \endcode
+ *
+ * Uso: bench_varredura [--tam-max=N] (padrão: 100 milhões, limitado por TAM_MAX_LISTAVET). Com 100
+ * milhões de elementos, o programa usa cerca de 1 GB de memória: a lista e o vetor de saída de
+ * filtrar.
+ *
+ * Para cada tamanho, de mil elementos até o máximo, a lista recebe números aleatórios de 0 a 999 e
+ * cada operação é medida em nanossegundos por elemento:
+ * - obter: o laço equivalente, com uma chamada a obter por posição (como antes das consultas em bloco);
+ * - escalar, avx2 e avx512: a consulta em bloco com cada nível (veja definir_nivel_simd); os níveis
+ *   que o processador não suporta aparecem com "-".
+ * A busca procura um número ausente, percorrendo a lista inteira, e o filtro aprova metade dos
+ * elementos. Enquanto a lista cabe nas caches, as versões vetorizadas processam vários elementos por
+ * ciclo; nas listas maiores, todas passam a ser limitadas pela leitura da memória. Os laços mais
+ * simples da versão escalar (contar e somar) podem ser vetorizados pelo próprio compilador, com as
+ * instruções SSE2 de qualquer processador x86 de 64 bits; o filtro e a busca, não.
+ *
+ * Antes das medições, em cada nível suportado, a ListaVet (alternando o modo lacuna), a FilaVet e a
+ * FilaDVet (cujos elementos dão várias voltas no vetor circular) recebem sequências aleatórias de
+ * operações, e as consultas em bloco são conferidas com os algoritmos da biblioteca padrão; qualquer
+ * divergência encerra o programa.
+ */
+
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <numeric>
+#include <vector>
+#include "auxiliares.hpp"
+#include "filadvet.hpp"
+#include "filavet.hpp"
+#include "listavet.hpp"
+#include "varredura.hpp"
+
+using namespace std;
+using medicao::agora_ns;
+using medicao::falhar;
+using medicao::sumidouro;
+
+static const NivelSimd NIVEIS[] = {SIMD_ESCALAR, SIMD_AVX2, SIMD_AVX512};
+static const char* NOMES_NIVEIS[] = {"escalar", "avx2", "avx512"};
+static const int TAM_CONFERENCIA = (TAM_MAX_LISTAVET < 3000) ? TAM_MAX_LISTAVET : 3000;
+static const long ELEMENTOS_POR_MEDICAO = 100000000;
+
+static unsigned semente = 2026;
+
+static int sortear(int n) {
+	semente = semente * 1103515245u + 12345u;
+	return (int) ((semente >> 8) % (unsigned) n);
+}
+
+/* Sorteia um elemento, incluindo de vez em quando os extremos de int. */
+static int sortear_item() {
+	int op = sortear(100);
+	if (op == 0) {
+		return INT_MAX;
+	}
+	if (op == 1) {
+		return INT_MIN;
+	}
+	return sortear(41) - 20;
+}
+
+/*
+ * Confere as consultas em bloco de uma ED com os seus elementos, copiados para "v" na mesma ordem.
+ * Como as consultas têm os mesmos nomes nas três EDs, a mesma conferência serve a todas.
+ */
+template <typename ED>
+static void conferir_consultas(ED* ed, const vector<int>& v, vector<int>& saida, const char* nome) {
+	int item = sortear_item();
+	int esperado = (int) (find(v.begin(), v.end(), item) - v.begin());
+	if (buscar_primeiro(ed, item) != ((esperado == (int) v.size()) ? -1 : esperado) ||
+		contar_ocorrencias(ed, item) != (int) count(v.begin(), v.end(), item) ||
+		somar(ed) != accumulate(v.begin(), v.end(), 0LL)) {
+		falhar(nome);
+	}
+	if (!v.empty() && (minimo(ed) != *min_element(v.begin(), v.end()) ||
+		maximo(ed) != *max_element(v.begin(), v.end()))) {
+		falhar(nome);
+	}
+
+	int menor = sortear_item();
+	int maior = sortear_item();
+	if (menor > maior) {
+		swap(menor, maior);
+	}
+	vector<int> aprovados;
+	for (int x : v) {
+		if (x >= menor && x <= maior) {
+			aprovados.push_back(x);
+		}
+	}
+	int qtd = filtrar(ed, menor, maior, saida.data());
+	if (qtd != (int) aprovados.size() || !equal(aprovados.begin(), aprovados.end(), saida.begin())) {
+		falhar(nome);
+	}
+}
+
+static void conferir_lista(vector<int>& saida) {
+	ListaVet* li = criar_lista();
+	vector<int> v;
+	for (int i = 0; i < 20000; i++) {
+		if (i % 1000 == 0) {
+			definir_modo_lacuna(li, sortear(2) == 0);
+		}
+		int pos = sortear((int) v.size() + 1);
+		if (sortear(2) == 0 && (int) v.size() < TAM_CONFERENCIA) {
+			int item = sortear_item();
+			inserir(li, item, pos);
+			v.insert(v.begin() + pos, item);
+		} else if (pos < (int) v.size()) {
+			remover(li, pos);
+			v.erase(v.begin() + pos);
+		}
+		conferir_consultas(li, v, saida, "ListaVet: consulta em bloco divergente");
+	}
+	liberar_lista(li);
+}
+
+static void conferir_fila(vector<int>& saida) {
+	FilaVet* f = criar_fila();
+	deque<int> fila;
+	for (int i = 0; i < 20000; i++) {
+		/* Lotes grandes fazem o início e o fim da fila darem várias voltas no vetor. */
+		int n = sortear(TAM_MAX_FILAVET / 4);
+		if (sortear(2) == 0) {
+			for (int j = 0; j < n && !estah_cheia(f); j++) {
+				int item = sortear_item();
+				inserir(f, item);
+				fila.push_back(item);
+			}
+		} else {
+			for (int j = 0; j < n && !estah_vazia(f); j++) {
+				remover(f);
+				fila.pop_front();
+			}
+		}
+		conferir_consultas(f, vector<int>(fila.begin(), fila.end()), saida, "FilaVet: consulta em bloco divergente");
+	}
+	liberar_fila(f);
+}
+
+static void conferir_fila_d(vector<int>& saida) {
+	FilaDVet* f = criar_fila_d();
+	deque<int> fila;
+	for (int i = 0; i < 20000; i++) {
+		int op = sortear(4);
+		for (int j = sortear(TAM_MAX_FILADVET / 4); j > 0; j--) {
+			int item = sortear_item();
+			if (op == 0 && !estah_cheia(f)) {
+				inserir_no_fim(f, item);
+				fila.push_back(item);
+			} else if (op == 1 && !estah_cheia(f)) {
+				inserir_no_inicio(f, item);
+				fila.push_front(item);
+			} else if (op == 2 && !estah_vazia(f)) {
+				remover_do_inicio(f);
+				fila.pop_front();
+			} else if (op == 3 && !estah_vazia(f)) {
+				remover_do_fim(f);
+				fila.pop_back();
+			}
+		}
+		conferir_consultas(f, vector<int>(fila.begin(), fila.end()), saida, "FilaDVet: consulta em bloco divergente");
+	}
+	liberar_fila(f);
+}
+
+static void conferir() {
+	vector<int> saida(max(TAM_CONFERENCIA, max(TAM_MAX_FILAVET, TAM_MAX_FILADVET)));
+	for (NivelSimd nivel : NIVEIS) {
+		if (nivel_simd_suportado(nivel)) {
+			definir_nivel_simd(nivel);
+			conferir_lista(saida);
+			conferir_fila(saida);
+			conferir_fila_d(saida);
+			printf("Conferencia das consultas em bloco (%s): sem divergencias.\n", NOMES_NIVEIS[nivel]);
+		}
+	}
+	printf("\n");
+}
+
+/* Laços com obter, equivalentes às consultas em bloco. */
+
+static long long buscar_obter(ListaVet* li, int item) {
+	int n = obter_tamanho(li);
+	for (int i = 0; i < n; i++) {
+		if (obter(li, i) == item) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+static long long contar_obter(ListaVet* li, int item) {
+	int n = obter_tamanho(li);
+	int qtd = 0;
+	for (int i = 0; i < n; i++) {
+		qtd += (obter(li, i) == item);
+	}
+	return qtd;
+}
+
+static long long somar_obter(ListaVet* li) {
+	int n = obter_tamanho(li);
+	long long soma = 0;
+	for (int i = 0; i < n; i++) {
+		soma += obter(li, i);
+	}
+	return soma;
+}
+
+static long long minimo_obter(ListaVet* li) {
+	int n = obter_tamanho(li);
+	int menor = obter(li, 0);
+	for (int i = 1; i < n; i++) {
+		menor = min(menor, obter(li, i));
+	}
+	return menor;
+}
+
+static long long filtrar_obter(ListaVet* li, int menor, int maior, int* saida) {
+	int n = obter_tamanho(li);
+	int qtd = 0;
+	for (int i = 0; i < n; i++) {
+		int x = obter(li, i);
+		if (x >= menor && x <= maior) {
+			saida[qtd++] = x;
+		}
+	}
+	return qtd;
+}
+
+/*
+ * Repete uma consulta sobre os n elementos da lista até processar ELEMENTOS_POR_MEDICAO elementos
+ * (pelo menos uma vez) e retorna o tempo médio por elemento. O resultado é conferido com o esperado.
+ */
+template <typename Consulta>
+static double medir(Consulta consulta, long n, long long esperado, const char* nome) {
+	long repeticoes = max(1L, ELEMENTOS_POR_MEDICAO / n);
+	long long soma = 0;
+	double t0 = agora_ns();
+	for (long r = 0; r < repeticoes; r++) {
+		soma += consulta();
+	}
+	double t = agora_ns() - t0;
+	if (soma != esperado * repeticoes) {
+		falhar(nome);
+	}
+	sumidouro = soma;
+	return t / ((double) n * repeticoes);
+}
+
+/* Mede uma operação com o laço de obter e com a consulta em bloco em cada nível suportado. */
+template <typename Laco, typename Bloco>
+static void medir_operacao(const char* operacao, long n, Laco laco, Bloco bloco) {
+	long long esperado = laco();
+	printf("%12ld %-20s %10.3f", n, operacao, medir(laco, n, esperado, operacao));
+	NivelSimd original = obter_nivel_simd();
+	for (NivelSimd nivel : NIVEIS) {
+		if (nivel_simd_suportado(nivel)) {
+			definir_nivel_simd(nivel);
+			printf(" %10.3f", medir(bloco, n, esperado, operacao));
+		} else {
+			printf(" %10s", "-");
+		}
+	}
+	definir_nivel_simd(original);
+	printf("\n");
+}
+
+int main(int argc, char** argv) {
+	long tam_max = 100000000;
+	for (int i = 1; i < argc; i++) {
+		if (strncmp(argv[i], "--tam-max=", 10) == 0) {
+			tam_max = atol(argv[i] + 10);
+		} else {
+			fprintf(stderr, "Uso: %s [--tam-max=N]\n", argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+	if (tam_max > TAM_MAX_LISTAVET) {
+		tam_max = TAM_MAX_LISTAVET;
+	}
+
+	conferir();
+
+	printf("%12s %-20s %10s %10s %10s %10s   (ns por elemento)\n", "tamanho", "operacao", "obter",
+		NOMES_NIVEIS[0], NOMES_NIVEIS[1], NOMES_NIVEIS[2]);
+	for (long n = 1000; n <= tam_max; n *= 10) {
+		ListaVet* li = criar_lista();
+		vector<int> v(n);
+		for (long i = 0; i < n; i++) {
+			v[i] = sortear(1000);
+		}
+		inserir_intervalo(li, 0, v.data(), v.data() + n);
+		vector<int> saida(n);
+		int* s = saida.data();
+
+		medir_operacao("buscar_primeiro", n, [&] { return buscar_obter(li, -1); },
+			[&] { return (long long) buscar_primeiro(li, -1); });
+		medir_operacao("contar_ocorrencias", n, [&] { return contar_obter(li, 500); },
+			[&] { return (long long) contar_ocorrencias(li, 500); });
+		medir_operacao("somar", n, [&] { return somar_obter(li); }, [&] { return somar(li); });
+		medir_operacao("minimo", n, [&] { return minimo_obter(li); }, [&] { return (long long) minimo(li); });
+		medir_operacao("filtrar", n, [&] { return filtrar_obter(li, 250, 749, s); },
+			[&] { return (long long) filtrar(li, 250, 749, s); });
+		liberar_lista(li);
+	}
+	return EXIT_SUCCESS;
+}
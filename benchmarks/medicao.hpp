@@ -0,0 +1,419 @@
+/**
+ * \file medicao.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Infraestrutura comum dos programas de medição de desempenho (suítes) das EDs
+ *
+ * Inspirada na biblioteca Google Benchmark, mas sem nenhuma dependência externa. Cada caso de
+ * medição é uma função que recebe um medicao::Estado, prepara a ED fora da região medida e
+ * executa a operação em um laço "while (e.continuar())". O número de iterações é calibrado
+ * automaticamente: o caso é repetido, com cada vez mais iterações, até que a região medida dure
+ * pelo menos o tempo mínimo (50 ms, por padrão).
+ *
+ * Para cada caso, são informados o tempo por operação (ns/op), as operações por segundo, as
+ * alocações por operação (chamadas ao operador "new" durante a região medida) e, quando o sistema
+ * permite o uso dos contadores de desempenho do processador (perf_event_open, no Linux), as falhas
+ * de cache por operação.
+ *
+ * Como este arquivo substitui os operadores globais "new" e "delete" para contar as alocações,
+ * ele deve ser incluído em um único arquivo de cada programa (o que contém a função "main").
+ *
+ * Opções de linha de comando aceitas por medicao::executar:
+ * - --filtro=TEXTO: executa apenas os casos cujo nome contém TEXTO;
+ * - --tam-max=N: ignora os casos com tamanho maior do que N;
+ * - --tempo-min=MS: tempo mínimo, em milissegundos, da região medida de cada caso;
+ * - --json=ARQUIVO: grava também os resultados, em JSON, no arquivo informado.
+ */
+
+#ifndef MEDICAO_HPP
+#define MEDICAO_HPP
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <new>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "auxiliares.hpp"
+
+namespace medicao {
+
+/** \brief Quantidade de chamadas ao operador "new" desde o início do programa. */
+inline long long qtd_alocacoes = 0;
+
+/*
+ * Contador de falhas de cache do processador (PERF_COUNT_HW_CACHE_MISSES). Se o sistema não
+ * permitir o seu uso (outro sistema operacional, máquina virtual sem contadores ou
+ * /proc/sys/kernel/perf_event_paranoid restritivo), "disponivel" fica falso.
+ */
+class ContadorCache {
+public:
+	ContadorCache() : fd(-1) {
+#if defined(__linux__)
+		struct perf_event_attr attr;
+		memset(&attr, 0, sizeof(attr));
+		attr.size = sizeof(attr);
+		attr.type = PERF_TYPE_HARDWARE;
+		attr.config = PERF_COUNT_HW_CACHE_MISSES;
+		attr.disabled = 1;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		fd = (int) syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+	}
+
+	~ContadorCache() {
+#if defined(__linux__)
+		if (fd >= 0) {
+			close(fd);
+		}
+#endif
+	}
+
+	bool disponivel() const {
+		return (fd >= 0);
+	}
+
+	void iniciar() {
+#if defined(__linux__)
+		if (fd >= 0) {
+			ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+			ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+		}
+#endif
+	}
+
+	long long parar() {
+		long long valor = -1;
+#if defined(__linux__)
+		if (fd >= 0) {
+			ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+			if (read(fd, &valor, sizeof(valor)) != (ssize_t) sizeof(valor)) {
+				valor = -1;
+			}
+		}
+#endif
+		return valor;
+	}
+
+private:
+	int fd;
+};
+
+inline ContadorCache& contador_cache() {
+	static ContadorCache contador;
+	return contador;
+}
+
+/**
+ * \class Estado
+ * \brief Controla uma execução de um caso de medição: o laço de iterações e a região medida.
+ *
+ * A região medida começa na primeira chamada a continuar() e termina quando ela retorna false.
+ * Tudo o que o caso fizer antes do laço (criar e preencher a ED) ou depois dele (liberá-la) não
+ * é medido.
+ */
+class Estado {
+public:
+	Estado(long tamanho, long long iteracoes)
+		: tam(tamanho), iteracoes(iteracoes), restantes(iteracoes), ops_por_iteracao(1),
+		  t0(0), tempo_ns(0), alocacoes(0), falhas_cache(-1) {}
+
+	/** \brief Retorna o tamanho da ED (quantidade de elementos) que o caso deve usar. */
+	long tamanho() const {
+		return tam;
+	}
+
+	/** \brief Informa quantas operações cada iteração do laço executa (1, por padrão). */
+	void definir_ops_por_iteracao(int n) {
+		ops_por_iteracao = n;
+	}
+
+	/** \brief Retorna true enquanto houver iterações a executar. */
+	bool continuar() {
+		if (restantes == iteracoes) {
+			iniciar();
+		}
+		if (restantes > 0) {
+			restantes--;
+			return true;
+		}
+		parar();
+		return false;
+	}
+
+	long long obter_iteracoes() const { return iteracoes; }
+	double obter_tempo_ns() const { return tempo_ns; }
+	long long obter_qtd_ops() const { return iteracoes * ops_por_iteracao; }
+	long long obter_alocacoes() const { return alocacoes; }
+	long long obter_falhas_cache() const { return falhas_cache; }
+
+private:
+	void iniciar() {
+		alocacoes = qtd_alocacoes;
+		contador_cache().iniciar();
+		t0 = agora_ns();
+	}
+
+	void parar() {
+		tempo_ns = agora_ns() - t0;
+		falhas_cache = contador_cache().parar();
+		alocacoes = qtd_alocacoes - alocacoes;
+	}
+
+	long tam;
+	long long iteracoes;
+	long long restantes;
+	int ops_por_iteracao;
+	double t0;
+	double tempo_ns;
+	long long alocacoes;
+	long long falhas_cache;
+};
+
+typedef void (*Funcao)(Estado&);
+
+struct Caso {
+	std::string estrutura;
+	std::string operacao;
+	long tamanho;
+	Funcao funcao;
+};
+
+inline std::vector<Caso>& casos() {
+	static std::vector<Caso> lista;
+	return lista;
+}
+
+/**
+ * \brief Registra um caso de medição, que será executado uma vez para cada tamanho informado.
+ *
+ * \param estrutura representa o nome da ED (por exemplo, "PilhaVet").
+ * \param operacao representa o nome da operação ou carga de trabalho medida (por exemplo, "empilhar_desempilhar").
+ * \param funcao representa a função que executa o caso.
+ * \param tamanhos representa os tamanhos da ED para os quais o caso será executado.
+ */
+inline void registrar(const char* estrutura, const char* operacao, Funcao funcao, const std::vector<long>& tamanhos) {
+	for (size_t i = 0; i < tamanhos.size(); i++) {
+		Caso c = {estrutura, operacao, tamanhos[i], funcao};
+		casos().push_back(c);
+	}
+}
+
+/** \brief Tamanhos usados pelas suítes: de 10 a 10 milhões de elementos. */
+inline std::vector<long> tamanhos_padrao() {
+	std::vector<long> t;
+	t.push_back(10);
+	t.push_back(1000);
+	t.push_back(100000);
+	t.push_back(10000000);
+	return t;
+}
+
+/**
+ * \brief Tamanhos padrão que cabem em uma ED com a capacidade informada.
+ *
+ * Os tamanhos maiores do que a metade da capacidade são descartados, para que sobre espaço para
+ * as inserções feitas durante as medições.
+ */
+inline std::vector<long> tamanhos_padrao(long capacidade) {
+	std::vector<long> todos = tamanhos_padrao();
+	std::vector<long> t;
+	for (size_t i = 0; i < todos.size(); i++) {
+		if (todos[i] <= capacidade / 2) {
+			t.push_back(todos[i]);
+		}
+	}
+	return t;
+}
+
+struct Resultado {
+	const Caso* caso;
+	long long iteracoes;
+	double ns_por_op;
+	double alocacoes_por_op;
+	double falhas_cache_por_op; /**< Negativo, se os contadores não estiverem disponíveis. */
+};
+
+inline void escrever_texto_json(FILE* arq, const std::string& s) {
+	fputc('"', arq);
+	for (size_t i = 0; i < s.size(); i++) {
+		if (s[i] == '"' || s[i] == '\\') {
+			fputc('\\', arq);
+		}
+		fputc(s[i], arq);
+	}
+	fputc('"', arq);
+}
+
+inline void escrever_json(const char* caminho, const char* programa, double tempo_min_ns,
+	const std::vector<Resultado>& resultados) {
+	FILE* arq = fopen(caminho, "w");
+	if (arq == NULL) {
+		fprintf(stderr, "Nao foi possivel criar o arquivo %s\n", caminho);
+		exit(EXIT_FAILURE);
+	}
+
+	char data[32];
+	time_t agora = time(NULL);
+	strftime(data, sizeof(data), "%Y-%m-%dT%H:%M:%S", localtime(&agora));
+
+	fprintf(arq, "{\n  \"contexto\": {\n    \"programa\": ");
+	escrever_texto_json(arq, programa);
+	fprintf(arq, ",\n    \"data\": \"%s\",\n    \"compilador\": ", data);
+	escrever_texto_json(arq, __VERSION__);
+#ifdef NDEBUG
+	fprintf(arq, ",\n    \"assert\": false");
+#else
+	fprintf(arq, ",\n    \"assert\": true");
+#endif
+	fprintf(arq, ",\n    \"tempo_min_ms\": %.0f,\n    \"contadores_de_cache\": %s\n  },\n  \"resultados\": [",
+		tempo_min_ns / 1e6, contador_cache().disponivel() ? "true" : "false");
+
+	for (size_t i = 0; i < resultados.size(); i++) {
+		const Resultado& r = resultados[i];
+		fprintf(arq, "%s\n    {\"nome\": ", (i == 0) ? "" : ",");
+		escrever_texto_json(arq, r.caso->estrutura + "/" + r.caso->operacao + "/" + std::to_string(r.caso->tamanho));
+		fprintf(arq, ", \"estrutura\": ");
+		escrever_texto_json(arq, r.caso->estrutura);
+		fprintf(arq, ", \"operacao\": ");
+		escrever_texto_json(arq, r.caso->operacao);
+		fprintf(arq, ", \"tamanho\": %ld, \"iteracoes\": %lld, \"ns_por_op\": %.4f, \"ops_por_segundo\": %.1f, "
+			"\"alocacoes_por_op\": %.6f, \"falhas_de_cache_por_op\": ",
+			r.caso->tamanho, r.iteracoes, r.ns_por_op, 1e9 / r.ns_por_op, r.alocacoes_por_op);
+		if (r.falhas_cache_por_op < 0) {
+			fprintf(arq, "null}");
+		} else {
+			fprintf(arq, "%.6f}", r.falhas_cache_por_op);
+		}
+	}
+	fprintf(arq, "\n  ]\n}\n");
+	fclose(arq);
+}
+
+/* Executa um caso, aumentando o número de iterações até que a região medida dure pelo menos tempo_min_ns. */
+inline Resultado medir(const Caso& caso, double tempo_min_ns) {
+	long long iteracoes = 1;
+	while (true) {
+		Estado e(caso.tamanho, iteracoes);
+		caso.funcao(e);
+
+		double tempo = e.obter_tempo_ns();
+		if (tempo >= tempo_min_ns || iteracoes >= 1000000000LL) {
+			Resultado r;
+			r.caso = &caso;
+			r.iteracoes = iteracoes;
+			r.ns_por_op = tempo / e.obter_qtd_ops();
+			r.alocacoes_por_op = (double) e.obter_alocacoes() / e.obter_qtd_ops();
+			r.falhas_cache_por_op = (e.obter_falhas_cache() < 0) ? -1.0 : (double) e.obter_falhas_cache() / e.obter_qtd_ops();
+			return r;
+		}
+
+		// Estima as iterações necessárias, com folga de 40%, crescendo no máximo 100 vezes por rodada
+		double estimativa = (tempo > 0) ? iteracoes * 1.4 * tempo_min_ns / tempo : iteracoes * 100.0;
+		long long proximo = (long long) estimativa;
+		if (proximo > iteracoes * 100) {
+			proximo = iteracoes * 100;
+		}
+		iteracoes = (proximo > iteracoes) ? proximo : iteracoes + 1;
+	}
+}
+
+/**
+ * \brief Executa os casos registrados, conforme as opções da linha de comando, e imprime uma tabela com os resultados.
+ *
+ * \return EXIT_SUCCESS, ou EXIT_FAILURE se alguma opção for inválida.
+ */
+inline int executar(int argc, char** argv) {
+	const char* filtro = "";
+	const char* caminho_json = NULL;
+	long tam_max = 10000000;
+	double tempo_min_ns = 50e6;
+
+	for (int i = 1; i < argc; i++) {
+		if (strncmp(argv[i], "--filtro=", 9) == 0) {
+			filtro = argv[i] + 9;
+		} else if (strncmp(argv[i], "--tam-max=", 10) == 0) {
+			tam_max = atol(argv[i] + 10);
+		} else if (strncmp(argv[i], "--tempo-min=", 12) == 0) {
+			tempo_min_ns = atof(argv[i] + 12) * 1e6;
+		} else if (strncmp(argv[i], "--json=", 7) == 0) {
+			caminho_json = argv[i] + 7;
+		} else {
+			fprintf(stderr, "Opcao desconhecida: %s\n", argv[i]);
+			fprintf(stderr, "Uso: %s [--filtro=TEXTO] [--tam-max=N] [--tempo-min=MS] [--json=ARQUIVO]\n", argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	printf("%-46s %12s %14s %10s %12s\n", "caso", "ns/op", "ops/s", "aloc/op", "falhas/op");
+	std::vector<Resultado> resultados;
+	const std::vector<Caso>& todos = casos();
+	for (size_t i = 0; i < todos.size(); i++) {
+		std::string nome = todos[i].estrutura + "/" + todos[i].operacao + "/" + std::to_string(todos[i].tamanho);
+		if (todos[i].tamanho > tam_max || nome.find(filtro) == std::string::npos) {
+			continue;
+		}
+		Resultado r = medir(todos[i], tempo_min_ns);
+		resultados.push_back(r);
+
+		printf("%-46s %12.2f %14.0f %10.4f ", nome.c_str(), r.ns_por_op, 1e9 / r.ns_por_op, r.alocacoes_por_op);
+		if (r.falhas_cache_por_op < 0) {
+			printf("%12s\n", "n/d");
+		} else {
+			printf("%12.4f\n", r.falhas_cache_por_op);
+		}
+		fflush(stdout);
+	}
+
+	if (caminho_json != NULL) {
+		escrever_json(caminho_json, argv[0], tempo_min_ns, resultados);
+	}
+	return EXIT_SUCCESS;
+}
+
+/** \brief Gerador de números pseudoaleatórios simples e rápido, para sortear posições dentro da região medida. */
+class Sorteio {
+public:
+	explicit Sorteio(unsigned semente) : estado(semente) {}
+
+	/** \brief Retorna um número em [0, n). */
+	long proximo(long n) {
+		estado = estado * 6364136223846793005ULL + 1442695040888963407ULL;
+		return (long) ((estado >> 33) % (unsigned long long) n);
+	}
+
+private:
+	unsigned long long estado;
+};
+
+}
+
+/* Substituição dos operadores globais, para contar as alocações (veja a descrição do arquivo). */
+void* operator new(std::size_t tam) {
+	medicao::qtd_alocacoes++;
+	void* p = std::malloc(tam ? tam : 1);
+	if (p == NULL) {
+		throw std::bad_alloc();
+	}
+	return p;
+}
+
+void operator delete(void* p) noexcept {
+	std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+	std::free(p);
+}
+
+#endif
@@ -0,0 +1,199 @@
+/**
+ * \file suite_enc.cpp
+ * \brief Suíte de medições das EDs encadeadas (pasta encadeada/).
+ *
+ * Compilação (a partir da raiz do repositório):
+ * \code {.unparsed}
+ *     g++ -O2 -DNDEBUG -Iencadeada benchmarks/suite_enc.cpp encadeada/poolnoh.cpp encadeada/pilhaenc.cpp \
+ *         encadeada/filaenc.cpp encadeada/listaenc.cpp encadeada/listadenc.cpp -o suite_enc
+ * \endcode
+ *
+ * Execute "./suite_enc --json=enc.json" para gravar também os resultados em JSON; as demais
+ * opções estão descritas em medicao.hpp.
+ *
+ * Os casos e os nomes das operações são os mesmos de suite_vet.cpp (que mede as EDs com arranjos),
+ * de modo que os resultados das duas suítes podem ser comparados diretamente: por exemplo,
+ * PilhaVet/empilhar_desempilhar/1000 com PilhaEnc/empilhar_desempilhar/1000.
+ */
+
+#include "filaenc.hpp"
+#include "listadenc.hpp"
+#include "listaenc.hpp"
+#include "medicao.hpp"
+#include "pilhaenc.hpp"
+
+using medicao::Estado;
+
+static const int TAM_BLOCO = 4096;
+static int bloco[TAM_BLOCO];
+
+/* Pilha */
+
+static void preencher(PilhaEnc* p, long n) {
+	for (long i = 0; i < n; i += TAM_BLOCO) {
+		empilhar_varios(p, bloco, (int) ((n - i < TAM_BLOCO) ? n - i : TAM_BLOCO));
+	}
+}
+
+static void pilha_empilhar_desempilhar(Estado& e) {
+	PilhaEnc* p = criar_pilha();
+	preencher(p, e.tamanho());
+	e.definir_ops_por_iteracao(2);
+	long long soma = 0;
+	while (e.continuar()) {
+		empilhar(p, 1);
+		soma += desempilhar(p);
+	}
+	medicao::sumidouro = soma;
+	liberar_pilha(p);
+}
+
+static void pilha_obter_topo(Estado& e) {
+	PilhaEnc* p = criar_pilha();
+	preencher(p, e.tamanho());
+	long long soma = 0;
+	while (e.continuar()) {
+		soma += obter_topo(p);
+	}
+	medicao::sumidouro = soma;
+	liberar_pilha(p);
+}
+
+static void pilha_misto(Estado& e) {
+	PilhaEnc* p = criar_pilha();
+	preencher(p, e.tamanho());
+	medicao::Sorteio s(1);
+	long long soma = 0;
+	while (e.continuar()) {
+		if (s.proximo(2) == 0 || estah_vazia(p)) {
+			empilhar(p, 1);
+		} else {
+			soma += desempilhar(p);
+		}
+	}
+	medicao::sumidouro = soma;
+	liberar_pilha(p);
+}
+
+/* Fila */
+
+static void preencher(FilaEnc* f, long n) {
+	for (long i = 0; i < n; i += TAM_BLOCO) {
+		inserir_lote(f, bloco, (int) ((n - i < TAM_BLOCO) ? n - i : TAM_BLOCO));
+	}
+}
+
+static void fila_inserir_remover(Estado& e) {
+	FilaEnc* f = criar_fila();
+	preencher(f, e.tamanho());
+	e.definir_ops_por_iteracao(2);
+	long long soma = 0;
+	while (e.continuar()) {
+		inserir(f, 1);
+		soma += remover(f);
+	}
+	medicao::sumidouro = soma;
+	liberar_fila(f);
+}
+
+static void fila_misto(Estado& e) {
+	FilaEnc* f = criar_fila();
+	preencher(f, e.tamanho());
+	medicao::Sorteio s(1);
+	long long soma = 0;
+	while (e.continuar()) {
+		if (s.proximo(2) == 0 || estah_vazia(f)) {
+			inserir(f, 1);
+		} else {
+			soma += remover(f);
+		}
+	}
+	medicao::sumidouro = soma;
+	liberar_fila(f);
+}
+
+/* Listas */
+
+/* Os blocos são inseridos no início, que a ListaEnc alcança sem percorrer a lista. */
+template <typename Lista>
+static void preencher(Lista* li, long n) {
+	for (long i = 0; i < n; i += TAM_BLOCO) {
+		int qtd = (int) ((n - i < TAM_BLOCO) ? n - i : TAM_BLOCO);
+		inserir_intervalo(li, 0, bloco, bloco + qtd);
+	}
+}
+
+enum Posicao { INICIO, MEIO, FIM };
+
+static int posicao(Posicao p, long tam) {
+	return (p == INICIO) ? 0 : (p == MEIO) ? (int) (tam / 2) : (int) tam;
+}
+
+template <typename Lista, Lista* (*criar)(), Posicao P>
+static void lista_inserir_remover(Estado& e) {
+	Lista* li = criar();
+	preencher(li, e.tamanho());
+	int pos = posicao(P, e.tamanho());
+	e.definir_ops_por_iteracao(2);
+	long long soma = 0;
+	while (e.continuar()) {
+		inserir(li, 1, pos);
+		soma += remover(li, pos);
+	}
+	medicao::sumidouro = soma;
+	liberar_lista(li);
+}
+
+template <typename Lista, Lista* (*criar)(), Posicao P>
+static void lista_obter(Estado& e) {
+	Lista* li = criar();
+	preencher(li, e.tamanho());
+	int pos = posicao(P, e.tamanho() - 1);
+	long long soma = 0;
+	while (e.continuar()) {
+		soma += obter_elemento(li, pos);
+	}
+	medicao::sumidouro = soma;
+	liberar_lista(li);
+}
+
+template <typename Lista, Lista* (*criar)()>
+static void lista_misto(Estado& e) {
+	Lista* li = criar();
+	preencher(li, e.tamanho());
+	medicao::Sorteio s(1);
+	long tam = e.tamanho();
+	e.definir_ops_por_iteracao(3);
+	long long soma = 0;
+	while (e.continuar()) {
+		soma += obter_elemento(li, (int) s.proximo(tam));
+		inserir(li, 1, (int) s.proximo(tam + 1));
+		soma += remover(li, (int) s.proximo(tam + 1));
+	}
+	medicao::sumidouro = soma;
+	liberar_lista(li);
+}
+
+template <typename Lista, Lista* (*criar)()>
+static void registrar_lista(const char* nome) {
+	std::vector<long> t = medicao::tamanhos_padrao();
+	medicao::registrar(nome, "inserir_remover_inicio", lista_inserir_remover<Lista, criar, INICIO>, t);
+	medicao::registrar(nome, "inserir_remover_meio", lista_inserir_remover<Lista, criar, MEIO>, t);
+	medicao::registrar(nome, "inserir_remover_fim", lista_inserir_remover<Lista, criar, FIM>, t);
+	medicao::registrar(nome, "obter_inicio", lista_obter<Lista, criar, INICIO>, t);
+	medicao::registrar(nome, "obter_meio", lista_obter<Lista, criar, MEIO>, t);
+	medicao::registrar(nome, "obter_fim", lista_obter<Lista, criar, FIM>, t);
+	medicao::registrar(nome, "misto", lista_misto<Lista, criar>, t);
+}
+
+int main(int argc, char** argv) {
+	std::vector<long> t = medicao::tamanhos_padrao();
+	medicao::registrar("PilhaEnc", "empilhar_desempilhar", pilha_empilhar_desempilhar, t);
+	medicao::registrar("PilhaEnc", "obter_topo", pilha_obter_topo, t);
+	medicao::registrar("PilhaEnc", "misto", pilha_misto, t);
+	medicao::registrar("FilaEnc", "inserir_remover", fila_inserir_remover, t);
+	medicao::registrar("FilaEnc", "misto", fila_misto, t);
+	registrar_lista<ListaEnc, criar_lista>("ListaEnc");
+	registrar_lista<ListaDEnc, criar_listad>("ListaDEnc");
+	return medicao::executar(argc, argv);
+}
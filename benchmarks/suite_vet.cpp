@@ -0,0 +1,257 @@
+/**
+ * \file suite_vet.cpp
+ * \brief Suíte de medições das EDs com arranjos (pasta array/).
+ *
+ * Compilação (a partir da raiz do repositório):
+ * \code {.unparsed}
+ *     g++ -O2 -DNDEBUG -DTAM_MAX_PILHAVET=16777216 -DTAM_MAX_FILAVET=16777216 -DTAM_MAX_FILADVET=16777216 \
+ *         -DTAM_MAX_LISTAVET=16777216 -DTAM_MAX_LISTACIRC=16777216 -Iarray benchmarks/suite_vet.cpp \
+ *         array/pilhavet.cpp array/filavet.cpp array/filadvet.cpp array/listavet.cpp array/listavetdin.cpp \
+ *         array/listacirc.cpp array/ordenacao.cpp array/varredura.cpp -o suite_vet
+ * \endcode
+ *
+ * As capacidades são aumentadas para comportar os casos com 10 milhões de elementos; com
+ * capacidades menores, os tamanhos que não cabem nas EDs são ignorados. Na compilação com o CMake
+ * (alvo suite_vet), as capacidades são definidas pela opção ESTRUTURAS_CAPACIDADE. Execute
+ * "./suite_vet --json=vet.json" para gravar também os resultados em JSON; as demais opções estão
+ * descritas em medicao.hpp.
+ *
+ * As EDs encadeadas são medidas, com os mesmos casos e nomes de operações, por suite_enc.cpp.
+ * Elas ficam em um programa separado porque as duas famílias definem funções com os mesmos
+ * nomes (por exemplo, criar_pilha), que não podem ser ligadas no mesmo executável.
+ *
+ * Casos de cada ED, para tamanhos de 10 a 10 milhões de elementos (a ED é preenchida antes da
+ * região medida e mantém o tamanho durante as medições):
+ * - pilhas: empilhar + desempilhar, consulta ao topo e carga mista (empilhar ou desempilhar, sorteado);
+ * - filas: inserir + remover e carga mista (inserir ou remover, sorteado);
+ * - filas duplas: inserir no fim + remover do início e inserir no início + remover do fim;
+ * - listas: inserir + remover e obter no início, no meio e no fim, e carga mista (obter, inserir e
+ *   remover em posições sorteadas).
+ */
+
+#include "filadvet.hpp"
+#include "filavet.hpp"
+#include "listacirc.hpp"
+#include "listavet.hpp"
+#include "listavetdin.hpp"
+#include "medicao.hpp"
+#include "pilhavet.hpp"
+
+using medicao::Estado;
+
+static const int TAM_BLOCO = 4096;
+static int bloco[TAM_BLOCO];
+
+/* Pilha */
+
+static void preencher(PilhaVet* p, long n) {
+	for (long i = 0; i < n; i += TAM_BLOCO) {
+		empilhar_varios(p, bloco, (int) ((n - i < TAM_BLOCO) ? n - i : TAM_BLOCO));
+	}
+}
+
+static void pilha_empilhar_desempilhar(Estado& e) {
+	PilhaVet* p = criar_pilha();
+	preencher(p, e.tamanho());
+	e.definir_ops_por_iteracao(2);
+	long long soma = 0;
+	while (e.continuar()) {
+		empilhar(p, 1);
+		soma += desempilhar(p);
+	}
+	medicao::sumidouro = soma;
+	liberar_pilha(p);
+}
+
+static void pilha_obter_topo(Estado& e) {
+	PilhaVet* p = criar_pilha();
+	preencher(p, e.tamanho());
+	long long soma = 0;
+	while (e.continuar()) {
+		soma += obter_topo(p);
+	}
+	medicao::sumidouro = soma;
+	liberar_pilha(p);
+}
+
+static void pilha_misto(Estado& e) {
+	PilhaVet* p = criar_pilha();
+	preencher(p, e.tamanho());
+	medicao::Sorteio s(1);
+	long long soma = 0;
+	while (e.continuar()) {
+		if ((s.proximo(2) == 0 && !estah_cheia(p)) || estah_vazia(p)) {
+			empilhar(p, 1);
+		} else {
+			soma += desempilhar(p);
+		}
+	}
+	medicao::sumidouro = soma;
+	liberar_pilha(p);
+}
+
+/* Fila */
+
+static void preencher(FilaVet* f, long n) {
+	for (long i = 0; i < n; i += TAM_BLOCO) {
+		inserir_lote(f, bloco, (int) ((n - i < TAM_BLOCO) ? n - i : TAM_BLOCO));
+	}
+}
+
+static void fila_inserir_remover(Estado& e) {
+	FilaVet* f = criar_fila();
+	preencher(f, e.tamanho());
+	e.definir_ops_por_iteracao(2);
+	long long soma = 0;
+	while (e.continuar()) {
+		inserir(f, 1);
+		soma += remover(f);
+	}
+	medicao::sumidouro = soma;
+	liberar_fila(f);
+}
+
+static void fila_misto(Estado& e) {
+	FilaVet* f = criar_fila();
+	preencher(f, e.tamanho());
+	medicao::Sorteio s(1);
+	long long soma = 0;
+	while (e.continuar()) {
+		if ((s.proximo(2) == 0 && !estah_cheia(f)) || estah_vazia(f)) {
+			inserir(f, 1);
+		} else {
+			soma += remover(f);
+		}
+	}
+	medicao::sumidouro = soma;
+	liberar_fila(f);
+}
+
+/* Fila dupla */
+
+static void preencher(FilaDVet* f, long n) {
+	for (long i = 0; i < n; i += TAM_BLOCO) {
+		inserir_lote_no_fim(f, bloco, (int) ((n - i < TAM_BLOCO) ? n - i : TAM_BLOCO));
+	}
+}
+
+static void fila_d_inserir_fim_remover_inicio(Estado& e) {
+	FilaDVet* f = criar_fila_d();
+	preencher(f, e.tamanho());
+	e.definir_ops_por_iteracao(2);
+	long long soma = 0;
+	while (e.continuar()) {
+		inserir_no_fim(f, 1);
+		soma += remover_do_inicio(f);
+	}
+	medicao::sumidouro = soma;
+	liberar_fila(f);
+}
+
+static void fila_d_inserir_inicio_remover_fim(Estado& e) {
+	FilaDVet* f = criar_fila_d();
+	preencher(f, e.tamanho());
+	e.definir_ops_por_iteracao(2);
+	long long soma = 0;
+	while (e.continuar()) {
+		inserir_no_inicio(f, 1);
+		soma += remover_do_fim(f);
+	}
+	medicao::sumidouro = soma;
+	liberar_fila(f);
+}
+
+/* Listas */
+
+template <typename Lista>
+static void preencher(Lista* li, long n) {
+	for (long i = 0; i < n; i += TAM_BLOCO) {
+		int qtd = (int) ((n - i < TAM_BLOCO) ? n - i : TAM_BLOCO);
+		inserir_intervalo(li, (int) i, bloco, bloco + qtd);
+	}
+}
+
+static void preencher(ListaCirc* li, long n) {
+	for (long i = 0; i < n; i++) {
+		inserir(li, 1, (int) i);
+	}
+}
+
+enum Posicao { INICIO, MEIO, FIM };
+
+static int posicao(Posicao p, long tam) {
+	return (p == INICIO) ? 0 : (p == MEIO) ? (int) (tam / 2) : (int) tam;
+}
+
+template <typename Lista, Lista* (*criar)(), Posicao P>
+static void lista_inserir_remover(Estado& e) {
+	Lista* li = criar();
+	preencher(li, e.tamanho());
+	int pos = posicao(P, e.tamanho());
+	e.definir_ops_por_iteracao(2);
+	long long soma = 0;
+	while (e.continuar()) {
+		inserir(li, 1, pos);
+		soma += remover(li, pos);
+	}
+	medicao::sumidouro = soma;
+	liberar_lista(li);
+}
+
+template <typename Lista, Lista* (*criar)(), Posicao P>
+static void lista_obter(Estado& e) {
+	Lista* li = criar();
+	preencher(li, e.tamanho());
+	int pos = posicao(P, e.tamanho() - 1);
+	long long soma = 0;
+	while (e.continuar()) {
+		soma += obter(li, pos);
+	}
+	medicao::sumidouro = soma;
+	liberar_lista(li);
+}
+
+template <typename Lista, Lista* (*criar)()>
+static void lista_misto(Estado& e) {
+	Lista* li = criar();
+	preencher(li, e.tamanho());
+	medicao::Sorteio s(1);
+	long tam = e.tamanho();
+	e.definir_ops_por_iteracao(3);
+	long long soma = 0;
+	while (e.continuar()) {
+		soma += obter(li, (int) s.proximo(tam));
+		inserir(li, 1, (int) s.proximo(tam + 1));
+		soma += remover(li, (int) s.proximo(tam + 1));
+	}
+	medicao::sumidouro = soma;
+	liberar_lista(li);
+}
+
+template <typename Lista, Lista* (*criar)()>
+static void registrar_lista(const char* nome, const std::vector<long>& t) {
+	medicao::registrar(nome, "inserir_remover_inicio", lista_inserir_remover<Lista, criar, INICIO>, t);
+	medicao::registrar(nome, "inserir_remover_meio", lista_inserir_remover<Lista, criar, MEIO>, t);
+	medicao::registrar(nome, "inserir_remover_fim", lista_inserir_remover<Lista, criar, FIM>, t);
+	medicao::registrar(nome, "obter_inicio", lista_obter<Lista, criar, INICIO>, t);
+	medicao::registrar(nome, "obter_meio", lista_obter<Lista, criar, MEIO>, t);
+	medicao::registrar(nome, "obter_fim", lista_obter<Lista, criar, FIM>, t);
+	medicao::registrar(nome, "misto", lista_misto<Lista, criar>, t);
+}
+
+int main(int argc, char** argv) {
+	std::vector<long> t = medicao::tamanhos_padrao(TAM_MAX_PILHAVET);
+	medicao::registrar("PilhaVet", "empilhar_desempilhar", pilha_empilhar_desempilhar, t);
+	medicao::registrar("PilhaVet", "obter_topo", pilha_obter_topo, t);
+	medicao::registrar("PilhaVet", "misto", pilha_misto, t);
+	t = medicao::tamanhos_padrao(TAM_MAX_FILAVET);
+	medicao::registrar("FilaVet", "inserir_remover", fila_inserir_remover, t);
+	medicao::registrar("FilaVet", "misto", fila_misto, t);
+	t = medicao::tamanhos_padrao(TAM_MAX_FILADVET);
+	medicao::registrar("FilaDVet", "inserir_fim_remover_inicio", fila_d_inserir_fim_remover_inicio, t);
+	medicao::registrar("FilaDVet", "inserir_inicio_remover_fim", fila_d_inserir_inicio_remover_fim, t);
+	registrar_lista<ListaVet, criar_lista>("ListaVet", medicao::tamanhos_padrao(TAM_MAX_LISTAVET));
+	registrar_lista<ListaVetDin, criar_lista_din>("ListaVetDin", medicao::tamanhos_padrao());
+	registrar_lista<ListaCirc, criar_lista_circ>("ListaCirc", medicao::tamanhos_padrao(TAM_MAX_LISTACIRC));
+	return medicao::executar(argc, argv);
+}
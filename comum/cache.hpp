@@ -0,0 +1,22 @@
+/**
+ * \file cache.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Parâmetros da memória cache usados pelas EDs concorrentes
+ *
+ * As EDs concorrentes (FilaSPSC, FilaDConc, FilaConc e PilhaConc) alinham os campos escritos por
+ * threads diferentes a linhas de cache distintas, para que uma thread não invalide a linha de cache
+ * usada pela outra a cada escrita (o chamado falso compartilhamento).
+ */
+
+#ifndef CACHE_HPP
+#define CACHE_HPP
+
+/**
+ * \def TAM_LINHA_CACHE
+ * \brief Tamanho, em bytes, de uma linha de cache nos processadores mais comuns.
+ * \hideinitializer
+ */
+#define TAM_LINHA_CACHE 64
+
+#endif
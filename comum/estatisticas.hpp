@@ -0,0 +1,174 @@
+/**
+ * \file estatisticas.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Contadores de uso das EDs de array/ e encadeada/ (opcionais)
+ *
+ * Quando a macro ESTRUTURAS_ESTATISTICAS é definida na compilação (por exemplo, com
+ * -DESTRUTURAS_ESTATISTICAS, ou com a opção de mesmo nome do CMake), cada ED guarda uma
+ * estrutura Estatisticas, atualizada pelas suas operações e consultada com a função
+ * obter_estatisticas declarada no cabeçalho da ED. Os contadores registram:
+ *  - a quantidade de inserções, remoções e consultas;
+ *  - o tamanho atual e o maior tamanho já alcançado pela ED;
+ *  - as alocações de memória (nós obtidos do pool ou realocações do arranjo);
+ *  - os bytes deslocados com memmove nas inserções e remoções das listas com arranjos; e
+ *  - um histograma das distâncias de cada operação: nós percorridos até a posição, nas listas
+ *    encadeadas, ou elementos deslocados, nas listas com arranjos.
+ *
+ * Sem a macro, a estrutura não é incluída nas EDs e as chamadas feitas com ESTATISTICA(...)
+ * desaparecem no pré-processamento: o código gerado é o mesmo de uma ED sem contadores.
+ *
+ * As EDs concorrentes (FilaSPSC, FilaDConc, FilaConc e PilhaConc) não têm contadores, pois
+ * eles precisariam ser atômicos e alterariam o comportamento que se deseja observar.
+ */
+
+#ifndef ESTATISTICAS_HPP
+#define ESTATISTICAS_HPP
+
+/**
+ * \def ESTATISTICA
+ * \brief Executa a instrução informada apenas quando ESTRUTURAS_ESTATISTICAS está definida.
+ * \hideinitializer
+ */
+#ifdef ESTRUTURAS_ESTATISTICAS
+#define ESTATISTICA(instrucao) instrucao
+#else
+#define ESTATISTICA(instrucao)
+#endif
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+
+#include <cstdio>
+#include <cstring>
+
+/**
+ * \def QTD_FAIXAS_DISTANCIA
+ * \brief Quantidade de faixas do histograma de distâncias.
+ *
+ * A faixa 0 conta as operações com distância 0 e a faixa k > 0, as com distância no intervalo
+ * [2^(k-1), 2^k - 1]. A última faixa acumula também todas as distâncias maiores.
+ */
+#define QTD_FAIXAS_DISTANCIA 32
+
+/**
+ * \struct Estatisticas
+ * \brief Contadores de uso de uma ED.
+ */
+struct Estatisticas {
+	long long insercoes; /**< Elementos inseridos. */
+	long long remocoes; /**< Elementos removidos. */
+	long long consultas; /**< Consultas a elementos (obter, obter_topo, obter_inicio etc.). */
+	long long tamanho; /**< Quantidade atual de elementos. */
+	long long maior_tamanho; /**< Maior quantidade de elementos já armazenada. */
+	long long alocacoes; /**< Nós obtidos do pool ou realocações do arranjo. */
+	long long bytes_deslocados; /**< Bytes movidos por deslocamentos de elementos. */
+	long long distancias[QTD_FAIXAS_DISTANCIA]; /**< Histograma das distâncias das operações. */
+};
+
+/** \brief Zera todos os contadores. */
+inline void zerar_estatisticas(Estatisticas* e) {
+	memset(e, 0, sizeof(Estatisticas));
+}
+
+/** \brief Registra a inserção de \p n elementos e atualiza o maior tamanho. */
+inline void contar_insercoes(Estatisticas* e, long long n) {
+	e->insercoes += n;
+	e->tamanho += n;
+	if (e->tamanho > e->maior_tamanho) {
+		e->maior_tamanho = e->tamanho;
+	}
+}
+
+/** \brief Registra a remoção de \p n elementos. */
+inline void contar_remocoes(Estatisticas* e, long long n) {
+	e->remocoes += n;
+	e->tamanho -= n;
+}
+
+/** \brief Registra uma consulta a um elemento. */
+inline void contar_consulta(Estatisticas* e) {
+	e->consultas++;
+}
+
+/** \brief Registra \p n alocações de memória. */
+inline void contar_alocacoes(Estatisticas* e, long long n) {
+	e->alocacoes += n;
+}
+
+/** \brief Registra, no histograma, uma operação que percorreu ou deslocou \p n itens. */
+inline void contar_distancia(Estatisticas* e, long long n) {
+	int faixa = 0;
+	while (n > 0 && faixa < QTD_FAIXAS_DISTANCIA - 1) {
+		n >>= 1;
+		faixa++;
+	}
+	e->distancias[faixa]++;
+}
+
+/**
+ * \brief Registra o deslocamento de \p n elementos de \p tam_elemento bytes, sem alterar o histograma.
+ *
+ * Usada pelas EDs cuja distância registrada no histograma não é a quantidade de elementos deslocados.
+ */
+inline void contar_bytes_deslocados(Estatisticas* e, long long n, long long tam_elemento) {
+	e->bytes_deslocados += n * tam_elemento;
+}
+
+/** \brief Registra o deslocamento de \p n elementos de \p tam_elemento bytes (e a distância \p n). */
+inline void contar_deslocamento(Estatisticas* e, long long n, long long tam_elemento) {
+	contar_bytes_deslocados(e, n, tam_elemento);
+	contar_distancia(e, n);
+}
+
+/**
+ * \brief Grava os contadores em \p arquivo, como um objeto JSON.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdio>
+ * #include<cstdlib>
+ * #include "listaenc.hpp"
+ *
+ * int main() {
+ *     ListaEnc *li = criar_lista();
+ *     for (int i = 0; i < 4; i++) {
+ *         inserir(li, i, obter_tamanho(li));
+ *     }
+ *     obter_elemento(li, 3);
+ *     escrever_estatisticas_json(obter_estatisticas(li), "ListaEnc", stdout);
+ *     liberar_lista(li);
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * Saída esperada (em uma única linha; as faixas vazias do fim do histograma são omitidas):
+ * \code {.unparsed}
+ *     {"estrutura": "ListaEnc", "insercoes": 4, "remocoes": 0, "consultas": 1, "tamanho": 4,
+ *      "maior_tamanho": 4, "alocacoes": 4, "bytes_deslocados": 0, "distancias": [2, 1, 2]}
+ * \endcode
+ *
+ * \param *e representa um ponteiro para os contadores.
+ * \param *nome representa o nome da ED, gravado no campo "estrutura".
+ * \param *arquivo representa o arquivo (já aberto) onde o objeto será gravado.
+ *
+ * \return void
+ */
+inline void escrever_estatisticas_json(const Estatisticas* e, const char* nome, FILE* arquivo) {
+	fprintf(arquivo, "{\"estrutura\": \"%s\", \"insercoes\": %lld, \"remocoes\": %lld, \"consultas\": %lld, "
+		"\"tamanho\": %lld, \"maior_tamanho\": %lld, \"alocacoes\": %lld, \"bytes_deslocados\": %lld, "
+		"\"distancias\": [", nome, e->insercoes, e->remocoes, e->consultas, e->tamanho,
+		e->maior_tamanho, e->alocacoes, e->bytes_deslocados);
+	int ultima = QTD_FAIXAS_DISTANCIA - 1;
+	while (ultima > 0 && e->distancias[ultima] == 0) {
+		ultima--;
+	}
+	for (int i = 0; i <= ultima; i++) {
+		fprintf(arquivo, (i == 0) ? "%lld" : ", %lld", e->distancias[i]);
+	}
+	fprintf(arquivo, "]}\n");
+}
+
+#endif
+
+#endif
+
@@ -0,0 +1,149 @@
+#include <assert.h> /**< Necessário para uso da macro "assert". */
+#include <atomic> /**< Necessário para uso de std::atomic. */
+#include <cstdlib> /**< Necessário para uso do NULL. */
+#include "../comum/cache.hpp"
+#include "filaconc.hpp"
+#include "riscos.hpp"
+
+using namespace std;
+
+struct NohConc {
+	int item; /**< Representa a informação a ser armazenada em cada nó da fila. */
+	atomic<NohConc*> prox; /**< É um ponteiro para o próximo nó da fila. */
+};
+
+/*
+ * O início e o fim ficam em linhas de cache distintas, pois são disputados por grupos
+ * diferentes de threads (consumidoras e produtoras, respectivamente).
+ */
+struct FilaConc {
+	alignas(TAM_LINHA_CACHE) atomic<NohConc*> inicio; /**< Ponteiro para o nó sentinela. */
+	alignas(TAM_LINHA_CACHE) atomic<NohConc*> fim; /**< Ponteiro para o último nó (ou para um nó próximo dele). */
+};
+
+static NohConc* criar_noh(int item) {
+	NohConc* novo_noh = new NohConc;
+	novo_noh->item = item;
+	novo_noh->prox.store(NULL, memory_order_relaxed);
+	return novo_noh;
+}
+
+/* Função passada ao módulo de ponteiros de risco para liberar os nós aposentados. */
+static void liberar_noh(void* noh) {
+	delete static_cast<NohConc*>(noh);
+}
+
+FilaConc* criar_fila_conc() {
+	/*
+	 * Caso não seja possível alocar o espaço solicitado, o próprio operador "new"
+	 * irá lançar uma exceção abortando a execução do programa.
+	 */
+	FilaConc* fila = new FilaConc;
+
+	/* A fila vazia possui apenas o nó sentinela, apontado tanto pelo início quanto pelo fim. */
+	NohConc* sentinela = criar_noh(0);
+	fila->inicio.store(sentinela, memory_order_relaxed);
+	fila->fim.store(sentinela, memory_order_relaxed);
+	return fila;
+}
+
+void liberar_fila(FilaConc* fila) {
+	/*
+	 * Macro da biblioteca \file assert.h. Aborta a execução do programa e envia uma mensagem
+	 * de erro para a saída de erro padrão, caso a expressão entre parênteses seja avaliada
+	 * como false.
+	 */
+	assert(fila != NULL);
+
+	// Nenhuma outra thread usa a fila: os nós podem ser liberados diretamente, inclusive o sentinela.
+	NohConc* aux = fila->inicio.load(memory_order_acquire);
+	while (aux != NULL) {
+		NohConc* prox = aux->prox.load(memory_order_relaxed);
+		delete aux;
+		aux = prox;
+	}
+	delete fila;
+}
+
+/* Lê o ponteiro "origem" e o publica no ponteiro de risco "indice", repetindo até que a leitura seja estável. */
+static NohConc* ler_protegido(atomic<NohConc*>& origem, int indice) {
+	NohConc* p = origem.load(memory_order_acquire);
+	while (true) {
+		proteger(indice, p);
+		NohConc* confirmacao = origem.load(memory_order_acquire);
+		if (confirmacao == p) {
+			return p;
+		}
+		p = confirmacao;
+	}
+}
+
+void inserir(FilaConc* fila, int item) {
+	assert(fila != NULL);
+
+	NohConc* novo_noh = criar_noh(item);
+	while (true) {
+		NohConc* fim = ler_protegido(fila->fim, 0);
+		NohConc* prox = fim->prox.load(memory_order_acquire);
+		if (fim != fila->fim.load(memory_order_acquire)) {
+			continue;
+		}
+		if (prox != NULL) {
+			/* O fim está atrasado: outra thread inseriu um nó e ainda não avançou o ponteiro. Ajuda a avançá-lo. */
+			fila->fim.compare_exchange_weak(fim, prox, memory_order_release, memory_order_relaxed);
+			continue;
+		}
+		/* Liga o novo nó após o último. Se outra thread ligou um nó antes, tenta novamente. */
+		if (fim->prox.compare_exchange_weak(prox, novo_noh, memory_order_release, memory_order_relaxed)) {
+			/* Tenta avançar o fim. Se falhar, alguma outra thread já o avançou. */
+			fila->fim.compare_exchange_strong(fim, novo_noh, memory_order_release, memory_order_relaxed);
+			break;
+		}
+	}
+	liberar_riscos();
+}
+
+bool remover(FilaConc* fila, int* item) {
+	assert(fila != NULL);
+	assert(item != NULL);
+
+	while (true) {
+		NohConc* sentinela = ler_protegido(fila->inicio, 0);
+		NohConc* fim = fila->fim.load(memory_order_acquire);
+		NohConc* prox = sentinela->prox.load(memory_order_acquire);
+
+		/* Protege o sucessor e confirma que o sentinela não mudou (senão "prox" pode já ter sido liberado). */
+		proteger(1, prox);
+		if (sentinela != fila->inicio.load(memory_order_acquire)) {
+			continue;
+		}
+		if (prox == NULL) {
+			liberar_riscos();
+			return false;
+		}
+		if (sentinela == fim) {
+			/* O fim está atrasado em relação ao início: ajuda a avançá-lo antes de remover. */
+			fila->fim.compare_exchange_weak(fim, prox, memory_order_release, memory_order_relaxed);
+			continue;
+		}
+
+		/* O item é lido antes da troca: depois dela, outra thread pode remover e aposentar "prox". */
+		int valor = prox->item;
+		if (fila->inicio.compare_exchange_weak(sentinela, prox, memory_order_acq_rel, memory_order_relaxed)) {
+			/* O antigo sentinela saiu da fila e "prox" passa a ser o novo sentinela. */
+			liberar_riscos();
+			aposentar(sentinela, liberar_noh);
+			*item = valor;
+			return true;
+		}
+	}
+}
+
+bool estah_vazia(FilaConc* fila) {
+	assert(fila != NULL);
+
+	NohConc* sentinela = ler_protegido(fila->inicio, 0);
+	bool vazia = (sentinela->prox.load(memory_order_acquire) == NULL);
+	liberar_riscos();
+	return vazia;
+}
@@ -0,0 +1,130 @@
+/**
+ * \file filaconc.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Interface do TAD FilaConc
+ *
+ * Disponibiliza as funções necessárias para manipulação de uma Fila encadeada concorrente, que
+ * pode ser usada por várias threads produtoras e consumidoras ao mesmo tempo sem nenhuma trava.
+ *
+ * A implementação segue o algoritmo de Michael e Scott (1996): assim como na FilaEnc, a fila
+ * mantém ponteiros para o início e para o fim, mas ambos são atualizados com operações atômicas
+ * de comparação e troca (compare-and-swap). A fila sempre possui um nó sentinela no início, o que
+ * permite que inserções (no fim) e remoções (no início) ocorram em paralelo sem interferência.
+ *
+ * Os nós removidos não são liberados imediatamente, pois outra thread pode estar lendo-os: eles
+ * são aposentados por meio do módulo de ponteiros de risco (\file riscos.hpp) e liberados assim
+ * que nenhuma thread os estiver utilizando.
+ */
+
+#ifndef FILACONC_HPP
+#define FILACONC_HPP
+
+/**
+ * \struct FilaConc
+ * \brief Declaração opaca da estrutura de uma fila.
+ *
+ * Isso significa que os detalhes de implementação desta estrutura estão escondidos do usuário do TAD.
+ * A definição da estrutura FilaConc encontra-se no arquivo \file filaconc.cpp.
+ */
+struct FilaConc;
+
+/**
+ * \brief Cria dinamicamente uma fila vazia e retorna o endereço onde ela se encontra alocada.
+ *
+ * \return O endereço de memória da fila alocada dinamicamente.
+ */
+FilaConc* criar_fila_conc();
+
+/**
+ * \brief Libera o espaço de memória anteriormente reservado para a fila e para os seus elementos.
+ *
+ * \pre O ponteiro \p *f deve ser diferente de \p NULL.
+ * \pre Nenhuma outra thread pode estar utilizando a fila.
+ *
+ * \param *f representa um ponteiro para a fila a ser liberada da memória.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *f seja igual a \p NULL.
+ */
+void liberar_fila(FilaConc* f);
+
+/**
+ * \brief Insere um novo elemento no fim da fila. Pode ser chamada por várias threads ao mesmo tempo.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include<thread>
+ * #include "filaconc.hpp"
+ *
+ * using namespace std;
+ *
+ * int main() {
+ *     FilaConc *f = criar_fila_conc();
+ *     thread t1([f]() { inserir(f, 1); });
+ *     thread t2([f]() { inserir(f, 2); });
+ *     t1.join();
+ *     t2.join();
+ *     int soma = 0, item;
+ *     while (remover(f, &item)) {
+ *         soma += item;
+ *     }
+ *     cout << soma << endl;
+ *     liberar_fila(f);
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * Saída esperada:
+ * \code {.unparsed}
+ *     3
+ * \endcode
+ *
+ * \pre O ponteiro \p *f deve ser diferente de \p NULL.
+ *
+ * \param *f representa um ponteiro para a fila onde o elemento será inserido.
+ * \param item representa o item a ser inserido na fila.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *f seja igual a \p NULL.
+ */
+void inserir(FilaConc* f, int item);
+
+/**
+ * \brief Tenta remover o elemento do início da fila. Pode ser chamada por várias threads ao mesmo tempo.
+ *
+ * Diferentemente da FilaEnc, remover de uma fila vazia não aborta o programa, pois outra thread
+ * pode ter esvaziado a fila entre uma verificação e a remoção. Nesse caso, a função retorna \p false.
+ *
+ * \pre Os ponteiros \p *f e \p *item devem ser diferentes de \p NULL.
+ *
+ * \param *f representa um ponteiro para a fila de onde o elemento será removido.
+ * \param *item representa o endereço onde o elemento removido será armazenado.
+ *
+ * \return \p true, se um elemento foi removido e \p false, caso a fila estivesse vazia.
+ *
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL.
+ */
+bool remover(FilaConc* f, int* item);
+
+/**
+ * \brief Verifica se a fila está vazia.
+ *
+ * Quando outras threads estão usando a fila, o resultado reflete um instante recente e pode
+ * estar desatualizado quando for usado.
+ *
+ * \pre O ponteiro \p *f deve ser diferente de \p NULL.
+ *
+ * \param *f representa um ponteiro para a fila cuja situação será consultada.
+ *
+ * \return \p true, se a fila estiver vazia e \p false, caso contrário.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *f seja igual a \p NULL.
+ */
+bool estah_vazia(FilaConc* f);
+
+#endif
@@ -1,6 +1,7 @@
 #include <assert.h> /**< Necessário para uso da macro "assert" */
 #include <cstdlib> /**< Necessário para uso do NULL */
 #include "filaenc.hpp"
+#include "poolnoh.hpp"
 
 struct Noh {
 	int item; /**< Representa a informação a ser armazenada em cada nó da fila. */
@@ -10,6 +11,10 @@ struct Noh {
 struct FilaEnc {
     Noh* inicio; /**< É um ponteiro para o início da fila. */
     Noh* fim; /**< É um ponteiro para o fim da fila. */
+    PoolNoh* pool; /**< Pool de onde são alocados os nós da fila. */
+#ifdef ESTRUTURAS_ESTATISTICAS
+	Estatisticas estat; /**< Contadores de uso (veja estatisticas.hpp). */
+#endif
 };
 
 FilaEnc* criar_fila() {
@@ -21,6 +26,8 @@ FilaEnc* criar_fila() {
     
 	fila->inicio = NULL;
 	fila->fim = NULL;
+	fila->pool = criar_pool(sizeof(Noh), NOHS_POR_BLOCO);
+	ESTATISTICA(zerar_estatisticas(&fila->estat));
 	return fila;
 }
 
@@ -32,10 +39,8 @@ void liberar_fila(FilaEnc* fila) {
 	*/
 	assert(fila != NULL);
 	
-	// Libera a memória alocada para cada nó da fila individualmente.
-	while(fila->inicio != NULL) {
-		remover(fila);
-	}	
+	// Todos os nós da fila estão nos blocos do pool, que são liberados de uma só vez.
+	liberar_pool(fila->pool);
 	delete fila;
 }
 
@@ -48,7 +53,7 @@ bool estah_vazia(FilaEnc* fila) {
 void inserir(FilaEnc* fila, int item) {
 	assert(fila != NULL);
 	
-	Noh *novo_noh = new Noh;
+	Noh *novo_noh = static_cast<Noh*>(alocar_noh(fila->pool));
 	novo_noh->item = item;
 	novo_noh->prox = NULL;
 	
@@ -58,6 +63,8 @@ void inserir(FilaEnc* fila, int item) {
         fila->fim->prox = novo_noh;
     } 
     fila->fim = novo_noh;
+    ESTATISTICA(contar_alocacoes(&fila->estat, 1));
+    ESTATISTICA(contar_insercoes(&fila->estat, 1));
 }
 
 int remover(FilaEnc* fila) {
@@ -70,7 +77,8 @@ int remover(FilaEnc* fila) {
     if (fila->inicio == NULL) {
 		fila->fim = NULL;
 	}
-    delete aux;
+    devolver_noh(fila->pool, aux);
+    ESTATISTICA(contar_remocoes(&fila->estat, 1));
     return item;
 }
 
@@ -78,5 +86,112 @@ int obter_inicio(FilaEnc* fila) {
 	assert(fila != NULL);
 	assert(!estah_vazia(fila));    
     
+	ESTATISTICA(contar_consulta(&fila->estat));
 	return fila->inicio->item;
 }
+
+void inserir_lote(FilaEnc* fila, const int* itens, int n) {
+	assert((fila != NULL) and (itens != NULL));
+	assert(n >= 0);
+	
+	if (n == 0) {
+		return;
+	}
+	
+	// Monta a cadeia de nós à parte e a liga ao fim da fila de uma só vez.
+	Noh* primeiro = static_cast<Noh*>(alocar_noh(fila->pool));
+	primeiro->item = itens[0];
+	Noh* ultimo = primeiro;
+	for (int i = 1; i < n; i++) {
+		Noh* novo_noh = static_cast<Noh*>(alocar_noh(fila->pool));
+		novo_noh->item = itens[i];
+		ultimo->prox = novo_noh;
+		ultimo = novo_noh;
+	}
+	ultimo->prox = NULL;
+	
+	if (fila->fim == NULL) {
+		fila->inicio = primeiro;
+	} else {
+		fila->fim->prox = primeiro;
+	}
+	fila->fim = ultimo;
+	ESTATISTICA(contar_alocacoes(&fila->estat, n));
+	ESTATISTICA(contar_insercoes(&fila->estat, n));
+}
+
+void remover_lote(FilaEnc* fila, int* saida, int n) {
+	assert((fila != NULL) and (saida != NULL));
+	assert(n >= 0);
+	
+	Noh* aux = fila->inicio;
+	for (int i = 0; i < n; i++) {
+		assert(aux != NULL);
+		
+		Noh* prox = aux->prox;
+		saida[i] = aux->item;
+		devolver_noh(fila->pool, aux);
+		aux = prox;
+	}
+	
+	fila->inicio = aux;
+	if (aux == NULL) {
+		fila->fim = NULL;
+	}
+	ESTATISTICA(contar_remocoes(&fila->estat, n));
+}
+
+void concatenar(FilaEnc* a, FilaEnc* b) {
+	assert((a != NULL) and (b != NULL) and (a != b));
+	
+	if (b->inicio == NULL) {
+		return;
+	}
+	
+	// A fila não guarda a sua quantidade de elementos, mas os contadores de uso de "b" guardam.
+	ESTATISTICA(long long n = b->estat.tamanho);
+	ESTATISTICA(contar_remocoes(&b->estat, n));
+
+	// Os nós só podem ser religados se as duas filas passarem a usar o mesmo pool.
+	Noh* primeiro = b->inicio;
+	Noh* ultimo = b->fim;
+	if (!unificar_pools(&a->pool, &b->pool)) {
+		// Os dois pools são compartilhados com outras filas: os elementos de "b" são copiados.
+		Noh* aux = b->inicio;
+		primeiro = NULL;
+		ultimo = NULL;
+		while (aux != NULL) {
+			Noh* prox = aux->prox;
+			Noh* novo_noh = static_cast<Noh*>(alocar_noh(a->pool));
+			novo_noh->item = aux->item;
+			if (ultimo == NULL) {
+				primeiro = novo_noh;
+			} else {
+				ultimo->prox = novo_noh;
+			}
+			ultimo = novo_noh;
+			devolver_noh(b->pool, aux);
+			aux = prox;
+		}
+		ultimo->prox = NULL;
+		ESTATISTICA(contar_alocacoes(&a->estat, n));
+	}
+	
+	if (a->fim == NULL) {
+		a->inicio = primeiro;
+	} else {
+		a->fim->prox = primeiro;
+	}
+	a->fim = ultimo;
+	b->inicio = NULL;
+	b->fim = NULL;
+	ESTATISTICA(contar_insercoes(&a->estat, n));
+}
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+const Estatisticas* obter_estatisticas(FilaEnc* fila) {
+	assert(fila != NULL);
+
+	return &fila->estat;
+}
+#endif
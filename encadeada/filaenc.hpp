@@ -10,6 +10,8 @@
 #ifndef FILAENC_HPP
 #define FILAENC_HPP
 
+#include "../comum/estatisticas.hpp"
+
 /** 
  * \struct FilaEnc
  * \brief Declaração opaca da estrutura de uma fila.
@@ -49,6 +51,9 @@ FilaEnc* criar_fila();
 /** 
  * \brief Libera o espaço de memória anteriormente reservado para a fila.
  *  
+ * Os nós da fila são alocados em blocos por um pool (veja \file poolnoh.hpp). Por isso, a liberação
+ * é feita bloco a bloco, sem percorrer os elementos da fila.
+ *
  * Exemplo de uso:
  * \code {.cpp}
  * #include<cstdlib>
@@ -234,4 +239,108 @@ int remover(FilaEnc* f);
  */
 int obter_inicio(FilaEnc* f);
 
+/** 
+ * \brief Insere, de uma só vez, os \p n elementos do vetor \p itens no fim da fila.
+ * 
+ * O resultado é o mesmo de chamar inserir(f, itens[i]) para i = 0, 1, ..., n - 1, mas a cadeia
+ * de nós é montada à parte e ligada ao fim da fila de uma só vez.
+ * 
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include "filaenc.hpp"
+ * 
+ * using namespace std;
+ *
+ * int main() {
+ *     FilaEnc *f = criar_fila();
+ *     int entrada[] = {1, 2, 3};
+ *     int saida[3];
+ *     inserir_lote(f, entrada, 3);
+ *     remover_lote(f, saida, 3);
+ *     cout << saida[0] << " " << saida[1] << " " << saida[2] << endl;
+ *     liberar_fila(f);
+ *     return EXIT_SUCCESS;
+ * }  
+ * \endcode
+ * 
+ * Saída esperada:
+ * \code {.unparsed}
+ *     1 2 3
+ * \endcode
+ * 
+ * \pre Os ponteiros \p *f e \p *itens devem ser diferentes de \p NULL.
+ * 
+ * \param *f representa um ponteiro para a fila.
+ * \param *itens representa o vetor com os elementos a serem inseridos.
+ * \param n representa a quantidade de elementos a serem inseridos.
+ * 
+ * \return void
+ * 
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL.
+ */
+void inserir_lote(FilaEnc* f, const int* itens, int n);
+
+/** 
+ * \brief Remove, de uma só vez, os \p n primeiros elementos da fila.
+ * 
+ * O resultado é o mesmo de chamar saida[i] = remover(f) para i = 0, 1, ..., n - 1.
+ * 
+ * \pre Os ponteiros \p *f e \p *saida devem ser diferentes de \p NULL.
+ * \pre A fila deve ter pelo menos \p n elementos.
+ * 
+ * \param *f representa um ponteiro para a fila.
+ * \param *saida representa o vetor, com pelo menos \p n posições, que receberá os elementos.
+ * \param n representa a quantidade de elementos a serem removidos.
+ * 
+ * \return void
+ * 
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL ou
+ * 			caso a fila tenha menos do que \p n elementos.
+ */
+void remover_lote(FilaEnc* f, int* saida, int n);
+
+/** 
+ * \brief Move todos os elementos da fila \p b para o fim da fila \p a, que passa a ter os
+ * elementos de \p a seguidos dos de \p b. A fila \p b fica vazia.
+ * 
+ * Os nós de \p b são apenas religados ao fim de \p a, em tempo constante e sem alocar memória.
+ * Para isso, as duas filas passam a compartilhar o mesmo pool de nós, que só é liberado junto com
+ * a última delas (veja poolnoh.hpp). Se os pools de \p a e de \p b já forem compartilhados com
+ * outras filas, os elementos de \p b são copiados, em tempo linear.
+ * 
+ * Os contadores de uso (veja estatisticas.hpp) registram os elementos movidos como removidos de
+ * \p b e inseridos em \p a.
+ * 
+ * \pre Os ponteiros \p *a e \p *b devem ser diferentes de \p NULL e diferentes entre si.
+ * 
+ * \param *a representa um ponteiro para a fila que receberá os elementos.
+ * \param *b representa um ponteiro para a fila cujos elementos serão movidos.
+ * 
+ * \return void
+ * 
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL ou caso
+ * 			\p a e \p b sejam a mesma fila.
+ */
+void concatenar(FilaEnc* a, FilaEnc* b);
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+/**
+ * \brief Retorna os contadores de uso da fila.
+ *
+ * Disponível apenas quando a macro ESTRUTURAS_ESTATISTICAS é definida na compilação. Os contadores
+ * continuam sendo atualizados pelas operações seguintes; veja o arquivo estatisticas.hpp.
+ *
+ * \pre O ponteiro \p *f deve ser diferente de \p NULL.
+ *
+ * \param *f representa um ponteiro para a fila.
+ *
+ * \return O endereço dos contadores da fila.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *f seja igual a \p NULL.
+ */
+const Estatisticas* obter_estatisticas(FilaEnc* f);
+#endif
+
 #endif
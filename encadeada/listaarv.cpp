@@ -0,0 +1,222 @@
+#include <assert.h> /**< Necessário para uso da macro "assert". */
+#include <cstdlib> /**< Necessário para uso do NULL. */
+#include "listaarv.hpp"
+#include "poolnoh.hpp"
+
+struct NohArv {
+	int item; /**< Representa a informação a ser armazenada em cada nó da lista. */
+	unsigned prioridade; /**< Prioridade aleatória: a de um nó é sempre maior ou igual às de seus filhos. */
+	int tam; /**< Quantidade de nós da subárvore enraizada neste nó (incluindo ele próprio). */
+	NohArv* esq; /**< Subárvore com os elementos anteriores a este na lista. */
+	NohArv* dir; /**< Subárvore com os elementos posteriores a este na lista. */
+};
+
+struct ListaArv {
+	NohArv* raiz; /**< É um ponteiro para a raiz da árvore. */
+	unsigned semente; /**< Estado do gerador de prioridades. */
+	PoolNoh* pool; /**< Pool de onde são alocados os nós da lista. */
+#ifdef ESTRUTURAS_ESTATISTICAS
+	Estatisticas estat; /**< Contadores de uso (veja estatisticas.hpp). */
+#endif
+};
+
+/* Retorna a quantidade de nós de uma subárvore, que pode ser vazia. */
+static int tamanho(NohArv* noh) {
+	return (noh == NULL) ? 0 : noh->tam;
+}
+
+/* Recalcula o tamanho da subárvore de "noh" a partir dos tamanhos de seus filhos. */
+static void atualizar(NohArv* noh) {
+	noh->tam = tamanho(noh->esq) + 1 + tamanho(noh->dir);
+}
+
+/* Gerador pseudoaleatório xorshift, usado para sortear as prioridades. */
+static unsigned sortear_prioridade(ListaArv* lista) {
+	unsigned x = lista->semente;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	lista->semente = x;
+	return x;
+}
+
+/*
+ * Divide a árvore "raiz" em duas: "*esq" recebe os "k" primeiros elementos e "*dir" recebe
+ * os demais. A ordem e as prioridades dos nós são preservadas.
+ */
+static void dividir(NohArv* raiz, int k, NohArv** esq, NohArv** dir) {
+	if (raiz == NULL) {
+		*esq = NULL;
+		*dir = NULL;
+	} else if (k <= tamanho(raiz->esq)) {
+		dividir(raiz->esq, k, esq, &raiz->esq);
+		atualizar(raiz);
+		*dir = raiz;
+	} else {
+		dividir(raiz->dir, k - tamanho(raiz->esq) - 1, &raiz->dir, dir);
+		atualizar(raiz);
+		*esq = raiz;
+	}
+}
+
+/* Junta as árvores "esq" e "dir", nessa ordem, e retorna a raiz resultante. */
+static NohArv* unir(NohArv* esq, NohArv* dir) {
+	if (esq == NULL) {
+		return dir;
+	}
+	if (dir == NULL) {
+		return esq;
+	}
+	if (esq->prioridade > dir->prioridade) {
+		esq->dir = unir(esq->dir, dir);
+		atualizar(esq);
+		return esq;
+	}
+	dir->esq = unir(esq, dir->esq);
+	atualizar(dir);
+	return dir;
+}
+
+ListaArv* criar_lista_arv() {
+	/*
+	 * Caso não seja possível alocar o espaço solicitado, o próprio operador "new"
+	 * irá lançar uma exceção abortando a execução do programa.
+	 */
+	ListaArv* lista = new ListaArv;
+
+	lista->raiz = NULL;
+	lista->semente = 2463534242u;
+	lista->pool = criar_pool(sizeof(NohArv), NOHS_POR_BLOCO);
+	ESTATISTICA(zerar_estatisticas(&lista->estat));
+	return lista;
+}
+
+void liberar_lista(ListaArv* lista) {
+	/*
+	 * Macro da biblioteca \file assert.h. Aborta a execução do programa e envia uma mensagem
+	 * de erro para a saída de erro padrão, caso a expressão entre parênteses seja avaliada
+	 * como false.
+	 */
+	assert(lista != NULL);
+
+	// Todos os nós da lista estão nos blocos do pool, que são liberados de uma só vez.
+	liberar_pool(lista->pool);
+	delete lista;
+}
+
+bool estah_vazia(ListaArv* lista) {
+	assert(lista != NULL);
+
+	return (lista->raiz == NULL);
+}
+
+/*
+ * Insere "novo" na posição "pos" da subárvore "raiz" e retorna a nova raiz da subárvore.
+ * A descida para quando o novo nó tem prioridade maior que a do nó corrente: nesse ponto,
+ * a subárvore corrente é dividida na posição de inserção e as duas partes viram filhas do novo nó.
+ */
+static NohArv* inserir_em(NohArv* raiz, NohArv* novo, int pos) {
+	if (raiz == NULL) {
+		return novo;
+	}
+	if (novo->prioridade > raiz->prioridade) {
+		dividir(raiz, pos, &novo->esq, &novo->dir);
+		atualizar(novo);
+		return novo;
+	}
+	int tam_esq = tamanho(raiz->esq);
+	if (pos <= tam_esq) {
+		raiz->esq = inserir_em(raiz->esq, novo, pos);
+	} else {
+		raiz->dir = inserir_em(raiz->dir, novo, pos - tam_esq - 1);
+	}
+	raiz->tam++;
+	return raiz;
+}
+
+void inserir(ListaArv* lista, int item, int pos) {
+	assert(lista != NULL);
+	assert((pos >= 0) and (pos <= tamanho(lista->raiz)));
+
+	NohArv* novo_noh = static_cast<NohArv*>(alocar_noh(lista->pool));
+	novo_noh->item = item;
+	novo_noh->prioridade = sortear_prioridade(lista);
+	novo_noh->tam = 1;
+	novo_noh->esq = NULL;
+	novo_noh->dir = NULL;
+
+	lista->raiz = inserir_em(lista->raiz, novo_noh, pos);
+	ESTATISTICA(contar_alocacoes(&lista->estat, 1));
+	ESTATISTICA(contar_insercoes(&lista->estat, 1));
+}
+
+/*
+ * Remove o nó da posição "pos" da subárvore "raiz", armazena o seu item em "*item" e retorna
+ * a nova raiz da subárvore. O nó removido é substituído pela união de suas duas subárvores.
+ */
+static NohArv* remover_de(ListaArv* lista, NohArv* raiz, int pos, int* item) {
+	int tam_esq = tamanho(raiz->esq);
+	if (pos == tam_esq) {
+		*item = raiz->item;
+		NohArv* substituto = unir(raiz->esq, raiz->dir);
+		devolver_noh(lista->pool, raiz);
+		return substituto;
+	}
+	if (pos < tam_esq) {
+		raiz->esq = remover_de(lista, raiz->esq, pos, item);
+	} else {
+		raiz->dir = remover_de(lista, raiz->dir, pos - tam_esq - 1, item);
+	}
+	raiz->tam--;
+	return raiz;
+}
+
+int remover(ListaArv* lista, int pos) {
+	assert(lista != NULL);
+	assert(!estah_vazia(lista));
+	assert((pos >= 0) and (pos < tamanho(lista->raiz)));
+
+	int item;
+	lista->raiz = remover_de(lista, lista->raiz, pos, &item);
+	ESTATISTICA(contar_remocoes(&lista->estat, 1));
+	return item;
+}
+
+int obter_elemento(ListaArv* lista, int pos) {
+	assert(lista != NULL);
+	assert(!estah_vazia(lista));
+	assert((pos >= 0) and (pos < tamanho(lista->raiz)));
+
+	// Desce a partir da raiz, descontando os elementos que ficam à esquerda do caminho.
+	NohArv* aux = lista->raiz;
+	ESTATISTICA(int profundidade = 0);
+	while (true) {
+		int tam_esq = tamanho(aux->esq);
+		if (pos == tam_esq) {
+			ESTATISTICA(contar_distancia(&lista->estat, profundidade));
+			ESTATISTICA(contar_consulta(&lista->estat));
+			return aux->item;
+		}
+		if (pos < tam_esq) {
+			aux = aux->esq;
+		} else {
+			pos -= tam_esq + 1;
+			aux = aux->dir;
+		}
+		ESTATISTICA(profundidade++);
+	}
+}
+
+int obter_tamanho(ListaArv* lista) {
+	assert(lista != NULL);
+
+	return tamanho(lista->raiz);
+}
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+const Estatisticas* obter_estatisticas(ListaArv* lista) {
+	assert(lista != NULL);
+
+	return &lista->estat;
+}
+#endif
@@ -0,0 +1,193 @@
+/**
+ * \file listaarv.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Interface do TAD ListaArv
+ *
+ * Disponibiliza as funções necessárias para manipulação de uma Lista com acesso por posição em
+ * tempo O(log n), com a mesma interface posicional da ListaDEnc.
+ *
+ * Na ListaDEnc, inserir, remover ou obter o elemento da posição "pos" exige percorrer a lista a
+ * partir do início, em tempo O(n). Na ListaArv, os elementos são os nós de uma árvore binária de
+ * busca balanceada (uma treap implícita), na qual a posição de um elemento não é armazenada: ela
+ * é deduzida da quantidade de nós das subárvores. Cada nó guarda o tamanho da própria subárvore e,
+ * assim, a posição "pos" é encontrada descendo da raiz: se a subárvore esquerda tem "e" nós, o
+ * elemento procurado está à esquerda (pos < e), na raiz (pos == e) ou à direita (na posição
+ * pos - e - 1 da subárvore direita).
+ *
+ * O balanceamento é probabilístico: cada nó recebe uma prioridade aleatória e a árvore é mantida
+ * como um heap de prioridades. Com isso, a altura esperada é O(log n), independentemente da ordem
+ * das inserções e remoções.
+ */
+
+#ifndef LISTAARV_HPP
+#define LISTAARV_HPP
+
+#include "../comum/estatisticas.hpp"
+
+/**
+ * \struct ListaArv
+ * \brief Declaração opaca da estrutura de uma lista.
+ *
+ * Isso significa que os detalhes de implementação desta estrutura estão escondidos do usuário do TAD.
+ * A definição da estrutura ListaArv encontra-se no arquivo \file listaarv.cpp.
+ */
+struct ListaArv;
+
+/**
+ * \brief Cria dinamicamente uma lista vazia e retorna o endereço onde ela se encontra alocada.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include "listaarv.hpp"
+
+ * int main() {
+ *     ListaArv *li = criar_lista_arv();
+ *     liberar_lista(li);
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * \return O endereço de memória da lista alocada dinamicamente.
+ */
+ListaArv* criar_lista_arv();
+
+/**
+ * \brief Libera o espaço de memória anteriormente reservado para a lista.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista a ser liberada da memória.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+void liberar_lista(ListaArv* li);
+
+/**
+ * \brief Verifica se a lista está vazia.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista cuja situação será consultada.
+ *
+ * \return \p true, se a lista estiver vazia e \p false, caso contrário.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+bool estah_vazia(ListaArv* li);
+
+/**
+ * \brief Insere um novo elemento em uma posição pré-determinada da lista, em tempo O(log n) esperado.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include "listaarv.hpp"
+ *
+ * using namespace std;
+ *
+ * int main() {
+ *     ListaArv *li = criar_lista_arv();
+ *     inserir(li, 1, 0);
+ *     inserir(li, 3, 1);
+ *     inserir(li, 2, 1);
+ *     for (int i = 0; i < obter_tamanho(li); i++) {
+ *         cout << obter_elemento(li, i) << " ";
+ *     }
+ *     cout << endl;
+ *     liberar_lista(li);
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * Saída esperada:
+ * \code {.unparsed}
+ * 		1 2 3
+ * \endcode
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista onde o elemento será inserido.
+ * \param item representa o item a ser inserido na lista.
+ * \param pos representa a posição onde o elemento será inserido na lista,
+ * 		  sendo 0 a posição inicial da lista e TAM a posição, onde TAM refere-se à quantidade de elementos da lista.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ * \warning O programa será abortado, caso o valor do parâmetro \p pos seja menor do que 0 ou maior do que TAM, onde TAM refere-se à quantidade de elementos da lista.
+ */
+void inserir(ListaArv* li, int item, int pos);
+
+/**
+ * \brief Remove e retorna o elemento de uma posição pré-determinada da lista, em tempo O(log n) esperado.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre A lista não deve estar vazia.
+ *
+ * \param *li representa um ponteiro para a lista de onde o elemento será removido.
+ * \param pos representa a posição do elemento a ser removido na lista,
+ * 		  sendo 0 a posição do primeiro elemento da lista e TAM - 1 a posição do último, onde TAM refere-se à quantidade de elementos da lista.
+ *
+ * \return O elemento removido da posição \p pos da lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL ou
+ * 			caso a lista esteja vazia.
+ * \warning O programa será abortado, caso o valor do parâmetro \p pos seja menor do que 0 ou maior do que TAM - 1, onde TAM refere-se à quantidade de elementos da lista.
+ */
+int remover(ListaArv* li, int pos);
+
+/**
+ * \brief Apenas retorna o elemento de uma posição pré-determinada da lista, em tempo O(log n) esperado.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre A lista não deve estar vazia.
+ *
+ * \param *li representa um ponteiro para a lista de onde o elemento será obtido.
+ * \param pos representa a posição do elemento a ser retornado na lista,
+ * 		  sendo 0 a posição do primeiro elemento da lista e TAM - 1 a posição do último, onde TAM refere-se à quantidade de elementos da lista.
+ *
+ * \return O elemento da posição \p pos da lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL ou
+ * 			caso a lista esteja vazia.
+ * \warning O programa será abortado, caso o valor do parâmetro \p pos seja menor do que 0 ou maior do que TAM - 1, onde TAM refere-se à quantidade de elementos da lista.
+ */
+int obter_elemento(ListaArv* li, int pos);
+
+/**
+ * \brief Retorna a quantidade de elementos da lista.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista cuja quantidade de elementos será obtida.
+ *
+ * \return A quantidade de elementos existentes na lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+int obter_tamanho(ListaArv* li);
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+/**
+ * \brief Retorna os contadores de uso da lista.
+ *
+ * Disponível apenas quando a macro ESTRUTURAS_ESTATISTICAS é definida na compilação. Os contadores
+ * continuam sendo atualizados pelas operações seguintes; veja o arquivo estatisticas.hpp.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista.
+ *
+ * \return O endereço dos contadores da lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+const Estatisticas* obter_estatisticas(ListaArv* li);
+#endif
+
+#endif
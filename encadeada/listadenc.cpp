@@ -1,6 +1,8 @@
 #include <assert.h> /**< Necessário para uso da macro "assert" */
 #include <cstdlib> /**< Necessário para uso do NULL */
 #include "listadenc.hpp"
+#include "ordenacaonoh.hpp"
+#include "poolnoh.hpp"
 
 struct DNoh {
 	int item; /**< Representa a informação a ser armazenada em cada nó da lista. */
@@ -12,9 +14,16 @@ struct ListaDEnc {
     DNoh* inicio; /**< É um ponteiro para o início da lista. */
     DNoh* fim; /**< É um ponteiro para o fim da lista. */
     int tam; /**< Representa a quantidade de elementos da lista. */
+    PoolNoh* pool; /**< Pool de onde são alocados os nós da lista. */
+    DNoh* dedo; /**< Último nó acessado por posição (NULL, se não houver). */
+    int pos_dedo; /**< Posição do nó apontado por "dedo". */
+#ifdef ESTRUTURAS_ESTATISTICAS
+	Estatisticas estat; /**< Contadores de uso (veja estatisticas.hpp). */
+#endif
 };
 
-ListaDEnc* criar_listad() {
+/* Cria uma lista vazia que aloca os seus nós do pool informado. */
+static ListaDEnc* criar_lista_com_pool(PoolNoh* pool) {
     /* 
 	 * Caso não seja possível alocar o espaço solicitado, o próprio operador "new"
 	 * irá lançar uma exceção abortando a execução do programa.
@@ -24,9 +33,17 @@ ListaDEnc* criar_listad() {
     lista->inicio = NULL;
     lista->fim = NULL;
     lista->tam = 0;
+    lista->pool = pool;
+    lista->dedo = NULL;
+    lista->pos_dedo = 0;
+    ESTATISTICA(zerar_estatisticas(&lista->estat));
     return lista;
 }
 
+ListaDEnc* criar_listad() {
+	return criar_lista_com_pool(criar_pool(sizeof(DNoh), NOHS_POR_BLOCO));
+}
+
 void liberar_lista(ListaDEnc* lista) {
     /* 
 	 * Macro da biblioteca \file assert.h. Aborta a execução do programa e envia uma mensagem 
@@ -35,10 +52,8 @@ void liberar_lista(ListaDEnc* lista) {
 	*/
 	assert(lista != NULL);
 	
-	// Libera a memória alocada para cada nó da lista individualmente.
-	while(lista->inicio != NULL) {
-		remover(lista, 0);
-	}	
+	// Todos os nós da lista estão nos blocos do pool, que são liberados de uma só vez.
+	liberar_pool(lista->pool);
 	delete lista;		
 }
 
@@ -52,19 +67,69 @@ bool estah_vazia(ListaDEnc* lista) {
 * Função criada para ser usada apenas dentro do arquivo listadenc.cpp.
 * Por isso, ela recebe a palavra-chave static, antes do tipo de retorno.
 */
-static DNoh* criar_noh(int item, DNoh* ant, DNoh* prox) {
-	DNoh* novo_noh = new DNoh;
+static DNoh* criar_noh(ListaDEnc* lista, int item, DNoh* ant, DNoh* prox) {
+	DNoh* novo_noh = static_cast<DNoh*>(alocar_noh(lista->pool));
 	novo_noh->item = item;
 	novo_noh->ant = ant;
 	novo_noh->prox = prox;
+	ESTATISTICA(contar_alocacoes(&lista->estat, 1));
 	return novo_noh;
 }
 
+/*
+ * Encontra o nó localizado na posição "pos", partindo do ponto de partida mais próximo entre
+ * o início, o fim e o "dedo" (último nó acessado por posição), e move o dedo para o nó encontrado.
+ * Assim, acessos a posições vizinhas, como em um laço com obter_elemento(li, i), custam O(1) cada.
+ */
+static DNoh* localizar(ListaDEnc* lista, int pos) {
+	DNoh* aux = lista->inicio;
+	int i = 0;
+	int distancia = pos;
+	
+	if (lista->tam - 1 - pos < distancia) {
+		aux = lista->fim;
+		i = lista->tam - 1;
+		distancia = i - pos;
+	}
+	if ((lista->dedo != NULL) and (abs(pos - lista->pos_dedo) < distancia)) {
+		aux = lista->dedo;
+		i = lista->pos_dedo;
+	}
+	ESTATISTICA(contar_distancia(&lista->estat, abs(pos - i)));
+	
+	for (; i < pos; i++) {
+		aux = aux->prox;
+	}
+	for (; i > pos; i--) {
+		aux = aux->ant;
+	}
+	
+	lista->dedo = aux;
+	lista->pos_dedo = pos;
+	return aux;
+}
+
+/* Mantém a posição do dedo correta após a inserção de um elemento na posição "pos". */
+static void ajustar_dedo_insercao(ListaDEnc* lista, int pos) {
+	if ((lista->dedo != NULL) and (pos <= lista->pos_dedo)) {
+		lista->pos_dedo++;
+	}
+}
+
+/* Mantém o dedo válido após a remoção do nó "noh", que estava na posição "pos". */
+static void ajustar_dedo_remocao(ListaDEnc* lista, DNoh* noh, int pos) {
+	if (lista->dedo == noh) {
+		lista->dedo = NULL;
+	} else if ((lista->dedo != NULL) and (pos < lista->pos_dedo)) {
+		lista->pos_dedo--;
+	}
+}
+
 
 void inserir_no_inicio(ListaDEnc* lista, int item) {
 	assert(lista != NULL);
 	
-	DNoh* novo_noh = criar_noh(item, NULL, lista->inicio);
+	DNoh* novo_noh = criar_noh(lista, item, NULL, lista->inicio);
 	
     if (lista->inicio == NULL) {
 		lista->fim = novo_noh;
@@ -73,13 +138,15 @@ void inserir_no_inicio(ListaDEnc* lista, int item) {
     }
     lista->inicio = novo_noh;
     
+    ajustar_dedo_insercao(lista, 0);
     lista->tam++;
+    ESTATISTICA(contar_insercoes(&lista->estat, 1));
 }
 
 void inserir_no_fim(ListaDEnc* lista, int item) {
 	assert(lista != NULL);
 	
-	DNoh* novo_noh = criar_noh(item, lista->fim, NULL);
+	DNoh* novo_noh = criar_noh(lista, item, lista->fim, NULL);
 	
     if (lista->fim == NULL) {
 		lista->inicio = novo_noh;
@@ -89,6 +156,7 @@ void inserir_no_fim(ListaDEnc* lista, int item) {
     lista->fim = novo_noh;
     
     lista->tam++;
+    ESTATISTICA(contar_insercoes(&lista->estat, 1));
 }
 
 
@@ -102,16 +170,16 @@ void inserir(ListaDEnc* lista, int item, int pos) {
 		inserir_no_fim(lista, item);
 	} else {
 		// Encontra o nó localizado na posição de inserção
-        DNoh* aux = lista->inicio;
-        for(int i = 0; i < pos; i++) {
-            aux = aux->prox;
-        }
+        DNoh* aux = localizar(lista, pos);
 
-        DNoh* novo_noh = criar_noh(item, aux->ant, aux);
+        DNoh* novo_noh = criar_noh(lista, item, aux->ant, aux);
         aux->ant->prox = novo_noh; 
         aux->ant = novo_noh;
         
+        // O novo nó passa a ocupar a posição "pos" e o dedo passa a apontar para ele.
+        lista->dedo = novo_noh;
         lista->tam++;
+        ESTATISTICA(contar_insercoes(&lista->estat, 1));
     }
 }
 
@@ -128,9 +196,11 @@ int remover_inicio(ListaDEnc* lista) {
         lista->inicio->ant = NULL;
     }
      
+    ajustar_dedo_remocao(lista, aux, 0);
     int item = aux->item;
-    delete aux;
+    devolver_noh(lista->pool, aux);
     lista->tam--;
+    ESTATISTICA(contar_remocoes(&lista->estat, 1));
     
     return item; 
 }
@@ -148,9 +218,11 @@ int remover_fim(ListaDEnc* lista) {
         lista->fim->prox = NULL;
     }
      
+    ajustar_dedo_remocao(lista, aux, lista->tam - 1);
     int item = aux->item;
-    delete aux;
+    devolver_noh(lista->pool, aux);
     lista->tam--;
+    ESTATISTICA(contar_remocoes(&lista->estat, 1));
     
     return item; 
 }
@@ -166,17 +238,18 @@ int remover(ListaDEnc* lista, int pos) {
 		return remover_fim(lista);
 	} else {
 		// Encontra o nó localizado na posição de remoção
-        DNoh* aux = lista->inicio;
-        for(int i = 0; i < pos; i++) {
-            aux = aux->prox;
-        }
+        DNoh* aux = localizar(lista, pos);
         
         aux->ant->prox = aux->prox;
         aux->prox->ant = aux->ant;
+        
+        // O sucessor do nó removido passa a ocupar a posição "pos" e o dedo passa a apontar para ele.
+        lista->dedo = aux->prox;
 
 		int item = aux->item;
-		delete aux;
+		devolver_noh(lista->pool, aux);
 		lista->tam--;
+		ESTATISTICA(contar_remocoes(&lista->estat, 1));
     
 		return item; 
     } 
@@ -186,6 +259,7 @@ int obter_inicio(ListaDEnc* lista) {
     assert(lista != NULL);
 	assert(!estah_vazia(lista));
 	
+	ESTATISTICA(contar_consulta(&lista->estat));
 	return lista->inicio->item;
 }
 
@@ -193,6 +267,7 @@ int obter_fim(ListaDEnc* lista) {
     assert(lista != NULL);
 	assert(!estah_vazia(lista));
 	
+	ESTATISTICA(contar_consulta(&lista->estat));
 	return lista->fim->item;
 }
 
@@ -206,12 +281,10 @@ int obter_elemento(ListaDEnc* lista, int pos) {
     } else if (pos == lista->tam - 1) {
 		return obter_fim(lista);
 	} else {
-		// Encontra o nó localizado na posição de remoção
-        DNoh* aux = lista->inicio;
-        for(int i = 0; i < pos; i++) {
-            aux = aux->prox;
-        }
+		// Encontra o nó localizado na posição desejada
+        DNoh* aux = localizar(lista, pos);
         
+        ESTATISTICA(contar_consulta(&lista->estat));
         return aux->item; 
     }
 }
@@ -222,3 +295,313 @@ int obter_tamanho(ListaDEnc *lista) {
 	return lista->tam;
 }
 
+
+void inserir_intervalo(ListaDEnc* lista, int pos, const int* primeiro, const int* ultimo) {
+    assert((lista != NULL) and (primeiro != NULL) and (ultimo != NULL));
+    assert(primeiro <= ultimo);
+	assert((pos >= 0) and (pos <= lista->tam));
+	
+	int n = (int) (ultimo - primeiro);
+	if (n == 0) {
+		return;
+	}
+	
+	// Encontra os nós entre os quais a cadeia será ligada (NULL, nas extremidades)
+	DNoh* ant = (pos == 0) ? NULL : localizar(lista, pos - 1);
+	DNoh* prox = (ant == NULL) ? lista->inicio : ant->prox;
+	
+	// Monta a cadeia de nós à parte, na ordem do intervalo
+	DNoh* cabeca = criar_noh(lista, primeiro[0], ant, NULL);
+	DNoh* cauda = cabeca;
+	for (int i = 1; i < n; i++) {
+		cauda->prox = criar_noh(lista, primeiro[i], cauda, NULL);
+		cauda = cauda->prox;
+	}
+	
+	// Liga a cadeia à lista de uma só vez
+	cauda->prox = prox;
+	if (ant == NULL) {
+		lista->inicio = cabeca;
+	} else {
+		ant->prox = cabeca;
+	}
+	if (prox == NULL) {
+		lista->fim = cauda;
+	} else {
+		prox->ant = cauda;
+	}
+	
+	if ((lista->dedo != NULL) and (pos <= lista->pos_dedo)) {
+		lista->pos_dedo += n;
+	}
+	lista->tam += n;
+	ESTATISTICA(contar_insercoes(&lista->estat, n));
+}
+
+void remover_intervalo(ListaDEnc* lista, int pos, int n, int* saida) {
+    assert(lista != NULL);
+    assert((pos >= 0) and (n >= 0) and (pos + n <= lista->tam));
+    
+	if (n == 0) {
+		return;
+	}
+	
+	DNoh* aux = localizar(lista, pos);
+	DNoh* ant = aux->ant;
+	
+	// Devolve os "n" nós ao pool
+	for (int i = 0; i < n; i++) {
+		DNoh* prox = aux->prox;
+		if (saida != NULL) {
+			saida[i] = aux->item;
+		}
+		devolver_noh(lista->pool, aux);
+		aux = prox;
+	}
+	
+	// Religa a lista de uma só vez; "aux" é o nó que passa a ocupar a posição "pos"
+	if (ant == NULL) {
+		lista->inicio = aux;
+	} else {
+		ant->prox = aux;
+	}
+	if (aux == NULL) {
+		lista->fim = ant;
+	} else {
+		aux->ant = ant;
+	}
+	
+	// O dedo apontava para o primeiro nó removido e passa a apontar para o seu substituto
+	lista->dedo = aux;
+	lista->tam -= n;
+	ESTATISTICA(contar_remocoes(&lista->estat, n));
+}
+
+/* Desliga da lista a cadeia de "n" nós que vai de "primeiro" até "ultimo". */
+static void desligar_cadeia(ListaDEnc* lista, DNoh* primeiro, DNoh* ultimo, int n) {
+	DNoh* ant = primeiro->ant;
+	DNoh* prox = ultimo->prox;
+	if (ant == NULL) {
+		lista->inicio = prox;
+	} else {
+		ant->prox = prox;
+	}
+	if (prox == NULL) {
+		lista->fim = ant;
+	} else {
+		prox->ant = ant;
+	}
+	primeiro->ant = NULL;
+	ultimo->prox = NULL;
+
+	lista->dedo = NULL;
+	lista->tam -= n;
+	ESTATISTICA(contar_remocoes(&lista->estat, n));
+}
+
+/* Liga à lista, logo após o nó "ant" (ou no início, se "ant" for NULL), uma cadeia de "n" nós. */
+static void ligar_cadeia(ListaDEnc* lista, DNoh* ant, DNoh* primeiro, DNoh* ultimo, int n) {
+	DNoh* prox = (ant == NULL) ? lista->inicio : ant->prox;
+	primeiro->ant = ant;
+	ultimo->prox = prox;
+	if (ant == NULL) {
+		lista->inicio = primeiro;
+	} else {
+		ant->prox = primeiro;
+	}
+	if (prox == NULL) {
+		lista->fim = ultimo;
+	} else {
+		prox->ant = ultimo;
+	}
+
+	lista->dedo = NULL;
+	lista->tam += n;
+	ESTATISTICA(contar_insercoes(&lista->estat, n));
+}
+
+/*
+ * Move para "destino", logo após o nó "ant", a cadeia de "n" nós de "origem" que vai de "primeiro"
+ * até "ultimo". Os nós são apenas religados, a menos que os pools das listas não possam ser
+ * unificados: nesse caso, os elementos são copiados para nós do pool de "destino".
+ */
+static void mover_cadeia(ListaDEnc* destino, DNoh* ant, ListaDEnc* origem, DNoh* primeiro, DNoh* ultimo, int n) {
+	desligar_cadeia(origem, primeiro, ultimo, n);
+	if (!unificar_pools(&destino->pool, &origem->pool)) {
+		DNoh* copia = NULL;
+		DNoh* aux = primeiro;
+		for (int i = 0; i < n; i++) {
+			DNoh* prox = aux->prox;
+			DNoh* novo_noh = criar_noh(destino, aux->item, copia, NULL);
+			if (copia == NULL) {
+				primeiro = novo_noh;
+			} else {
+				copia->prox = novo_noh;
+			}
+			copia = novo_noh;
+			devolver_noh(origem->pool, aux);
+			aux = prox;
+		}
+		ultimo = copia;
+	}
+	ligar_cadeia(destino, ant, primeiro, ultimo, n);
+}
+
+void concatenar(ListaDEnc* a, ListaDEnc* b) {
+	assert((a != NULL) and (b != NULL) and (a != b));
+
+	if (b->tam > 0) {
+		mover_cadeia(a, a->fim, b, b->inicio, b->fim, b->tam);
+	}
+}
+
+ListaDEnc* dividir(ListaDEnc* lista, int pos) {
+	assert(lista != NULL);
+	assert((pos >= 0) and (pos <= lista->tam));
+
+	// A nova lista já nasce usando o mesmo pool, de modo que os nós são sempre apenas religados.
+	ListaDEnc* nova = criar_lista_com_pool(compartilhar_pool(lista->pool));
+	if (pos < lista->tam) {
+		mover_cadeia(nova, NULL, lista, localizar(lista, pos), lista->fim, lista->tam - pos);
+	}
+	return nova;
+}
+
+void transferir(ListaDEnc* destino, int pos, ListaDEnc* origem, int de, int ate) {
+	assert((destino != NULL) and (origem != NULL) and (destino != origem));
+	assert((pos >= 0) and (pos <= destino->tam));
+	assert((de >= 0) and (de <= ate) and (ate <= origem->tam));
+
+	if (de == ate) {
+		return;
+	}
+
+	// Com o dedo, o segundo percurso parte do primeiro nó do intervalo ou do fim, o mais próximo.
+	DNoh* primeiro = localizar(origem, de);
+	DNoh* ultimo = localizar(origem, ate - 1);
+	DNoh* ant = (pos == 0) ? NULL : localizar(destino, pos - 1);
+	mover_cadeia(destino, ant, origem, primeiro, ultimo, ate - de);
+}
+
+void ordenar(ListaDEnc* lista) {
+	ordenar_paralelo(lista, 1);
+}
+
+void ordenar_paralelo(ListaDEnc* lista, int qtd_threads) {
+	assert(lista != NULL);
+
+	Cadeia<DNoh> c = {lista->inicio, lista->fim};
+	c = ordenar_cadeia_paralelo(c, lista->tam, qtd_threads);
+	lista->inicio = c.inicio;
+	lista->fim = c.fim;
+
+	// A ordenação religa apenas os ponteiros "prox": os ponteiros "ant" são refeitos em um percurso.
+	DNoh* ant = NULL;
+	for (DNoh* aux = lista->inicio; aux != NULL; aux = aux->prox) {
+		aux->ant = ant;
+		ant = aux;
+	}
+	lista->dedo = NULL;
+}
+
+CursorDEnc iniciar_cursor(ListaDEnc* lista) {
+    assert(lista != NULL);
+
+    CursorDEnc c = {lista, lista->inicio};
+    return c;
+}
+
+CursorDEnc cursor_no_fim_da_lista(ListaDEnc* lista) {
+    assert(lista != NULL);
+
+    CursorDEnc c = {lista, NULL};
+    return c;
+}
+
+bool cursor_no_fim(CursorDEnc* c) {
+    assert(c != NULL);
+
+    return (c->atual == NULL);
+}
+
+void avancar(CursorDEnc* c) {
+    assert((c != NULL) and (c->atual != NULL));
+
+    c->atual = c->atual->prox;
+}
+
+bool retroceder(CursorDEnc* c) {
+    assert(c != NULL);
+
+    DNoh* anterior = (c->atual == NULL) ? c->lista->fim : c->atual->ant;
+    if (anterior == NULL) {
+        return false;
+    }
+    c->atual = anterior;
+    return true;
+}
+
+int valor(CursorDEnc* c) {
+    assert((c != NULL) and (c->atual != NULL));
+
+    return c->atual->item;
+}
+
+int* endereco_do_valor(CursorDEnc* c) {
+    assert((c != NULL) and (c->atual != NULL));
+
+    return &c->atual->item;
+}
+
+void inserir_no_cursor(CursorDEnc* c, int item) {
+    assert(c != NULL);
+
+    ListaDEnc* lista = c->lista;
+    if (c->atual == NULL) {
+        inserir_no_fim(lista, item);
+    } else if (c->atual == lista->inicio) {
+        inserir_no_inicio(lista, item);
+    } else {
+        DNoh* novo_noh = criar_noh(lista, item, c->atual->ant, c->atual);
+        c->atual->ant->prox = novo_noh;
+        c->atual->ant = novo_noh;
+
+        // A posição do novo nó não é conhecida, então o dedo não pode mais ser ajustado.
+        lista->dedo = NULL;
+        lista->tam++;
+        ESTATISTICA(contar_insercoes(&lista->estat, 1));
+    }
+}
+
+int remover_no_cursor(CursorDEnc* c) {
+    assert((c != NULL) and (c->atual != NULL));
+
+    ListaDEnc* lista = c->lista;
+    DNoh* aux = c->atual;
+    c->atual = aux->prox;
+
+    if (aux == lista->inicio) {
+        return remover_inicio(lista);
+    } else if (aux == lista->fim) {
+        return remover_fim(lista);
+    }
+
+    aux->ant->prox = aux->prox;
+    aux->prox->ant = aux->ant;
+
+    // A posição do nó removido não é conhecida, então o dedo não pode mais ser ajustado.
+    lista->dedo = NULL;
+    int item = aux->item;
+    devolver_noh(lista->pool, aux);
+    lista->tam--;
+    ESTATISTICA(contar_remocoes(&lista->estat, 1));
+    return item;
+}
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+const Estatisticas* obter_estatisticas(ListaDEnc* lista) {
+	assert(lista != NULL);
+
+	return &lista->estat;
+}
+#endif
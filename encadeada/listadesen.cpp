@@ -0,0 +1,229 @@
+#include <assert.h> /**< Necessário para uso da macro "assert". */
+#include <cstddef> /**< Necessário para uso da macro "offsetof". */
+#include <cstdlib> /**< Necessário para uso do NULL. */
+#include <cstring> /**< Necessário para uso da função "memmove". */
+#include "listadesen.hpp"
+#include "poolnoh.hpp"
+
+/*
+ * O vetor "itens" é declarado com uma única posição, mas cada nó é alocado com espaço para
+ * "itens_por_noh" posições logo após o campo "qtd" (técnica conhecida como "struct hack").
+ * Com 13 posições, o nó inteiro ocupa 8 + 4 + 13 * 4 = 64 bytes. Como os nós do PoolNoh ficam logo
+ * após o cabeçalho de cada bloco, sem alinhamento a 64 bytes, um nó pode ocupar partes de duas linhas de cache.
+ */
+struct NohDesen {
+	NohDesen* prox; /**< É um ponteiro para o próximo nó da lista. */
+	int qtd; /**< Quantidade de posições ocupadas do vetor "itens". */
+	int itens[1]; /**< Elementos armazenados no nó, nas posições [0, qtd - 1]. */
+};
+
+struct ListaDesen {
+	NohDesen* inicio; /**< É um ponteiro para o primeiro nó da lista. */
+	NohDesen* fim; /**< É um ponteiro para o último nó da lista (acelera as inserções no final). */
+	int tam; /**< Representa a quantidade de elementos da lista. */
+	int itens_por_noh; /**< Capacidade do vetor de cada nó. */
+	PoolNoh* pool; /**< Pool de onde são alocados os nós da lista. */
+#ifdef ESTRUTURAS_ESTATISTICAS
+	Estatisticas estat; /**< Contadores de uso (veja estatisticas.hpp). */
+#endif
+};
+
+ListaDesen* criar_lista_desen(int itens_por_noh) {
+	assert(itens_por_noh >= 2);
+
+	/*
+	 * Caso não seja possível alocar o espaço solicitado, o próprio operador "new"
+	 * irá lançar uma exceção abortando a execução do programa.
+	 */
+	ListaDesen* lista = new ListaDesen;
+
+	lista->inicio = NULL;
+	lista->fim = NULL;
+	lista->tam = 0;
+	lista->itens_por_noh = itens_por_noh;
+	lista->pool = criar_pool(offsetof(NohDesen, itens) + itens_por_noh * sizeof(int), NOHS_POR_BLOCO);
+	ESTATISTICA(zerar_estatisticas(&lista->estat));
+	return lista;
+}
+
+void liberar_lista(ListaDesen* lista) {
+	/*
+	 * Macro da biblioteca \file assert.h. Aborta a execução do programa e envia uma mensagem
+	 * de erro para a saída de erro padrão, caso a expressão entre parênteses seja avaliada
+	 * como false.
+	 */
+	assert(lista != NULL);
+
+	// Todos os nós da lista estão nos blocos do pool, que são liberados de uma só vez.
+	liberar_pool(lista->pool);
+	delete lista;
+}
+
+bool estah_vazia(ListaDesen* lista) {
+	assert(lista != NULL);
+
+	return (lista->tam == 0);
+}
+
+/* Cria um nó vazio e o liga logo após o nó "ant" (ou no início da lista, se "ant" for NULL). */
+static NohDesen* criar_noh_apos(ListaDesen* lista, NohDesen* ant) {
+	NohDesen* novo_noh = static_cast<NohDesen*>(alocar_noh(lista->pool));
+	novo_noh->qtd = 0;
+	ESTATISTICA(contar_alocacoes(&lista->estat, 1));
+	if (ant == NULL) {
+		novo_noh->prox = lista->inicio;
+		lista->inicio = novo_noh;
+	} else {
+		novo_noh->prox = ant->prox;
+		ant->prox = novo_noh;
+	}
+	if (novo_noh->prox == NULL) {
+		lista->fim = novo_noh;
+	}
+	return novo_noh;
+}
+
+/* Desliga e devolve ao pool o nó "noh", cujo antecessor é "ant" (NULL, se "noh" for o primeiro). */
+static void remover_noh(ListaDesen* lista, NohDesen* ant, NohDesen* noh) {
+	if (ant == NULL) {
+		lista->inicio = noh->prox;
+	} else {
+		ant->prox = noh->prox;
+	}
+	if (lista->fim == noh) {
+		lista->fim = ant;
+	}
+	devolver_noh(lista->pool, noh);
+}
+
+/*
+ * Encontra o nó que contém a posição "pos" da lista. Em "*ant" é armazenado o antecessor do
+ * nó encontrado e, em "*desloc", a posição correspondente dentro do vetor do nó.
+ * Cada passo do laço avança "qtd" elementos de uma só vez.
+ */
+static NohDesen* localizar(ListaDesen* lista, int pos, NohDesen** ant, int* desloc) {
+	NohDesen* anterior = NULL;
+	NohDesen* aux = lista->inicio;
+	ESTATISTICA(int passos = 0);
+	while (pos >= aux->qtd) {
+		pos -= aux->qtd;
+		anterior = aux;
+		aux = aux->prox;
+		ESTATISTICA(passos++);
+	}
+	ESTATISTICA(contar_distancia(&lista->estat, passos));
+	*ant = anterior;
+	*desloc = pos;
+	return aux;
+}
+
+void inserir(ListaDesen* lista, int item, int pos) {
+	assert(lista != NULL);
+	assert((pos >= 0) and (pos <= lista->tam));
+
+	int cap = lista->itens_por_noh;
+	NohDesen* noh;
+	int desloc;
+
+	if (lista->inicio == NULL) {
+		noh = criar_noh_apos(lista, NULL);
+		desloc = 0;
+	} else if (pos == lista->tam) {
+		// Inserção no final: não é necessário percorrer a lista.
+		noh = lista->fim;
+		desloc = noh->qtd;
+		if (noh->qtd == cap) {
+			// O último nó está cheio: o elemento inicia um novo nó, deixando o anterior cheio.
+			noh = criar_noh_apos(lista, noh);
+			desloc = 0;
+		}
+	} else {
+		NohDesen* ant;
+		noh = localizar(lista, pos, &ant, &desloc);
+		if (noh->qtd == cap) {
+			// Divide o nó cheio: a segunda metade dos elementos vai para um novo nó.
+			NohDesen* novo_noh = criar_noh_apos(lista, noh);
+			int metade = cap / 2;
+			novo_noh->qtd = cap - metade;
+			memcpy(novo_noh->itens, noh->itens + metade, novo_noh->qtd * sizeof(int));
+			noh->qtd = metade;
+			if (desloc > metade) {
+				noh = novo_noh;
+				desloc -= metade;
+			}
+		}
+	}
+
+	// Desloca os elementos do nó uma posição para a direita, abrindo espaço para o novo elemento.
+	memmove(noh->itens + desloc + 1, noh->itens + desloc, (noh->qtd - desloc) * sizeof(int));
+	// O histograma já registrou os nós percorridos até a posição (veja localizar), e não os elementos deslocados.
+	ESTATISTICA(contar_bytes_deslocados(&lista->estat, noh->qtd - desloc, sizeof(int)));
+	noh->itens[desloc] = item;
+	noh->qtd++;
+	lista->tam++;
+	ESTATISTICA(contar_insercoes(&lista->estat, 1));
+}
+
+int remover(ListaDesen* lista, int pos) {
+	assert(lista != NULL);
+	assert(!estah_vazia(lista));
+	assert((pos >= 0) and (pos < lista->tam));
+
+	int desloc;
+	NohDesen* ant;
+	NohDesen* noh = localizar(lista, pos, &ant, &desloc);
+
+	int item = noh->itens[desloc];
+	memmove(noh->itens + desloc, noh->itens + desloc + 1, (noh->qtd - desloc - 1) * sizeof(int));
+	ESTATISTICA(contar_bytes_deslocados(&lista->estat, noh->qtd - desloc - 1, sizeof(int)));
+	noh->qtd--;
+	lista->tam--;
+	ESTATISTICA(contar_remocoes(&lista->estat, 1));
+
+	int cap = lista->itens_por_noh;
+	if (noh->qtd == 0) {
+		remover_noh(lista, ant, noh);
+	} else if ((noh->qtd < cap / 2) && (noh->prox != NULL)) {
+		NohDesen* prox = noh->prox;
+		if (noh->qtd + prox->qtd <= cap) {
+			// Os dois nós cabem em um só: funde o próximo nó a este.
+			memcpy(noh->itens + noh->qtd, prox->itens, prox->qtd * sizeof(int));
+			noh->qtd += prox->qtd;
+			remover_noh(lista, noh, prox);
+		} else {
+			// Equilibra os dois nós, trazendo elementos do início do próximo nó.
+			int qtd_mover = (prox->qtd - noh->qtd) / 2;
+			memcpy(noh->itens + noh->qtd, prox->itens, qtd_mover * sizeof(int));
+			memmove(prox->itens, prox->itens + qtd_mover, (prox->qtd - qtd_mover) * sizeof(int));
+			noh->qtd += qtd_mover;
+			prox->qtd -= qtd_mover;
+		}
+	}
+	return item;
+}
+
+int obter_elemento(ListaDesen* lista, int pos) {
+	assert(lista != NULL);
+	assert(!estah_vazia(lista));
+	assert((pos >= 0) and (pos < lista->tam));
+
+	int desloc;
+	NohDesen* ant;
+	NohDesen* noh = localizar(lista, pos, &ant, &desloc);
+	ESTATISTICA(contar_consulta(&lista->estat));
+	return noh->itens[desloc];
+}
+
+int obter_tamanho(ListaDesen* lista) {
+	assert(lista != NULL);
+
+	return lista->tam;
+}
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+const Estatisticas* obter_estatisticas(ListaDesen* lista) {
+	assert(lista != NULL);
+
+	return &lista->estat;
+}
+#endif
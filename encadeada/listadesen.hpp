@@ -0,0 +1,200 @@
+/**
+ * \file listadesen.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Interface do TAD ListaDesen
+ *
+ * Disponibiliza as funções necessárias para manipulação de uma Lista Encadeada Desenrolada
+ * (unrolled linked list).
+ *
+ * Na ListaEnc, cada nó armazena um único elemento, de modo que percorrer a lista acessa uma
+ * região diferente da memória (e, provavelmente, uma linha de cache diferente) a cada elemento.
+ * Na ListaDesen, cada nó armazena um pequeno vetor com até "itens_por_noh" elementos, além da
+ * quantidade de elementos ocupados. Assim, as buscas por posição saltam de nó em nó, avançando
+ * vários elementos por vez, e os elementos vizinhos ficam lado a lado na memória.
+ *
+ * As operações de inserção e remoção mantêm os nós razoavelmente cheios: um nó cheio é dividido
+ * ao meio antes de uma inserção e um nó com menos da metade da capacidade é completado com
+ * elementos do nó seguinte (ou fundido a ele) após uma remoção.
+ */
+
+#ifndef LISTADESEN_HPP
+#define LISTADESEN_HPP
+
+#include "../comum/estatisticas.hpp"
+
+/**
+ * \def ITENS_POR_NOH_PADRAO
+ * \brief Define a quantidade padrão de elementos por nó, escolhida para que cada nó ocupe 64 bytes.
+ * \hideinitializer
+ */
+#define ITENS_POR_NOH_PADRAO 13
+
+/**
+ * \struct ListaDesen
+ * \brief Declaração opaca da estrutura de uma lista.
+ *
+ * Isso significa que os detalhes de implementação desta estrutura estão escondidos do usuário do TAD.
+ * A definição da estrutura ListaDesen encontra-se no arquivo \file listadesen.cpp.
+ */
+struct ListaDesen;
+
+/**
+ * \brief Cria dinamicamente uma lista vazia e retorna o endereço onde ela se encontra alocada.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include "listadesen.hpp"
+
+ * int main() {
+ *     ListaDesen *li = criar_lista_desen(ITENS_POR_NOH_PADRAO);
+ *     liberar_lista(li);
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * \pre \p itens_por_noh deve ser maior ou igual a 2.
+ *
+ * \param itens_por_noh representa a quantidade máxima de elementos de cada nó.
+ *
+ * \return O endereço de memória da lista alocada dinamicamente.
+ */
+ListaDesen* criar_lista_desen(int itens_por_noh);
+
+/**
+ * \brief Libera o espaço de memória anteriormente reservado para a lista.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista a ser liberada da memória.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+void liberar_lista(ListaDesen* li);
+
+/**
+ * \brief Verifica se a lista está vazia.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista cuja situação será consultada.
+ *
+ * \return \p true, se a lista estiver vazia e \p false, caso contrário.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+bool estah_vazia(ListaDesen* li);
+
+/**
+ * \brief Insere um novo elemento em uma posição pré-determinada da lista.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include "listadesen.hpp"
+ *
+ * using namespace std;
+ *
+ * int main() {
+ *     ListaDesen *li = criar_lista_desen(4);
+ *     for (int i = 0; i < 10; i++) {
+ *         inserir(li, i, obter_tamanho(li));
+ *     }
+ *     inserir(li, 100, 5);
+ *     cout << obter_elemento(li, 5) << " " << obter_elemento(li, 6) << endl;
+ *     liberar_lista(li);
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * Saída esperada:
+ * \code {.unparsed}
+ * 		100 5
+ * \endcode
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista onde o elemento será inserido.
+ * \param item representa o item a ser inserido na lista.
+ * \param pos representa a posição onde o elemento será inserido na lista,
+ * 		  sendo 0 a posição inicial da lista e TAM a posição, onde TAM refere-se à quantidade de elementos da lista.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ * \warning O programa será abortado, caso o valor do parâmetro \p pos seja menor do que 0 ou maior do que TAM, onde TAM refere-se à quantidade de elementos da lista.
+ */
+void inserir(ListaDesen* li, int item, int pos);
+
+/**
+ * \brief Remove e retorna o elemento de uma posição pré-determinada da lista.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre A lista não deve estar vazia.
+ *
+ * \param *li representa um ponteiro para a lista de onde o elemento será removido.
+ * \param pos representa a posição do elemento a ser removido na lista,
+ * 		  sendo 0 a posição do primeiro elemento da lista e TAM - 1 a posição do último, onde TAM refere-se à quantidade de elementos da lista.
+ *
+ * \return O elemento removido da posição \p pos da lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL ou
+ * 			caso a lista esteja vazia.
+ * \warning O programa será abortado, caso o valor do parâmetro \p pos seja menor do que 0 ou maior do que TAM - 1, onde TAM refere-se à quantidade de elementos da lista.
+ */
+int remover(ListaDesen* li, int pos);
+
+/**
+ * \brief Apenas retorna o elemento de uma posição pré-determinada da lista.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre A lista não deve estar vazia.
+ *
+ * \param *li representa um ponteiro para a lista de onde o elemento será obtido.
+ * \param pos representa a posição do elemento a ser retornado na lista,
+ * 		  sendo 0 a posição do primeiro elemento da lista e TAM - 1 a posição do último, onde TAM refere-se à quantidade de elementos da lista.
+ *
+ * \return O elemento da posição \p pos da lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL ou
+ * 			caso a lista esteja vazia.
+ * \warning O programa será abortado, caso o valor do parâmetro \p pos seja menor do que 0 ou maior do que TAM - 1, onde TAM refere-se à quantidade de elementos da lista.
+ */
+int obter_elemento(ListaDesen* li, int pos);
+
+/**
+ * \brief Retorna a quantidade de elementos da lista.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista cuja quantidade de elementos será obtida.
+ *
+ * \return A quantidade de elementos existentes na lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+int obter_tamanho(ListaDesen* li);
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+/**
+ * \brief Retorna os contadores de uso da lista.
+ *
+ * Disponível apenas quando a macro ESTRUTURAS_ESTATISTICAS é definida na compilação. Os contadores
+ * continuam sendo atualizados pelas operações seguintes; veja o arquivo estatisticas.hpp.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista.
+ *
+ * \return O endereço dos contadores da lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+const Estatisticas* obter_estatisticas(ListaDesen* li);
+#endif
+
+#endif
@@ -0,0 +1,376 @@
+#include <assert.h> /**< Necessário para uso da macro "assert" */
+#include <climits> /**< Necessário para uso do INT_MAX */
+#include <cstdio> /**< Necessário para uso de fprintf */
+#include <cstdlib> /**< Necessário para uso do NULL e das funções "abs" e "abort" */
+#include <cstring> /**< Necessário para uso da função "memcpy" */
+#include "listadind.hpp"
+
+/* Índice que representa a ausência de nó, como o NULL nas listas com ponteiros. */
+static const int NENHUM = -1;
+
+struct DNohInd {
+	int item; /**< Representa a informação a ser armazenada em cada nó da lista. */
+	int ant; /**< Índice do nó anterior no vetor de nós (NENHUM, no primeiro nó). */
+	int prox; /**< Índice do próximo nó no vetor de nós (NENHUM, no último nó). */
+};
+
+struct ListaDInd {
+	DNohInd* nohs; /**< Vetor alocado dinamicamente que armazena todos os nós da lista. */
+	int capacidade; /**< Quantidade de nós que cabem no vetor "nohs". */
+	int usados; /**< Quantidade de posições do vetor já usadas alguma vez (as demais nunca foram ocupadas). */
+	int livres; /**< Índice do primeiro nó da lista de nós livres, encadeada pelo campo "prox". */
+	int inicio; /**< Índice do primeiro nó da lista. */
+	int fim; /**< Índice do último nó da lista. */
+	int tam; /**< Representa a quantidade de elementos da lista. */
+	int dedo; /**< Índice do último nó acessado por posição (NENHUM, se não houver). */
+	int pos_dedo; /**< Posição do nó indicado por "dedo". */
+#ifdef ESTRUTURAS_ESTATISTICAS
+	Estatisticas estat; /**< Contadores de uso (veja estatisticas.hpp). */
+#endif
+};
+
+ListaDInd* criar_lista_dind() {
+	/*
+	 * Caso não seja possível alocar o espaço solicitado, o próprio operador "new"
+	 * irá lançar uma exceção abortando a execução do programa.
+	 */
+	ListaDInd* lista = new ListaDInd;
+
+	lista->nohs = NULL;
+	lista->capacidade = 0;
+	lista->usados = 0;
+	lista->livres = NENHUM;
+	lista->inicio = NENHUM;
+	lista->fim = NENHUM;
+	lista->tam = 0;
+	lista->dedo = NENHUM;
+	lista->pos_dedo = 0;
+	ESTATISTICA(zerar_estatisticas(&lista->estat));
+	return lista;
+}
+
+void liberar_lista(ListaDInd* lista) {
+	assert(lista != NULL);
+
+	// Todos os nós estão em um único vetor, liberado de uma só vez.
+	delete[] lista->nohs;
+	delete lista;
+}
+
+bool estah_vazia(ListaDInd* lista) {
+	assert(lista != NULL);
+
+	return (lista->inicio == NENHUM);
+}
+
+/*
+ * Retorna o índice de um nó livre, preenchido com os valores informados. Os nós devolvidos são
+ * reaproveitados primeiro; depois, as posições ainda não usadas do vetor. Quando o vetor está
+ * cheio, a sua capacidade é dobrada, até o limite de INT_MAX nós imposto pelos índices de 32 bits.
+ * Como os nós são ligados por índices, e não por endereços, basta copiar o vetor antigo para o novo.
+ */
+static int criar_noh(ListaDInd* lista, int item, int ant, int prox) {
+	int i = lista->livres;
+	if (i != NENHUM) {
+		lista->livres = lista->nohs[i].prox;
+	} else {
+		if (lista->usados == lista->capacidade) {
+			// Não usa assert para que o programa não continue com índices inválidos quando NDEBUG é definida.
+			if (lista->capacidade == INT_MAX) {
+				fprintf(stderr, "ListaDInd: a lista não pode ter mais de %d elementos\n", INT_MAX);
+				abort();
+			}
+			long long capacidade = (lista->capacidade == 0) ? CAPACIDADE_INICIAL_DIND : 2LL * lista->capacidade;
+			if (capacidade > INT_MAX) {
+				capacidade = INT_MAX;
+			}
+			DNohInd* novos_nohs = new DNohInd[capacidade];
+			ESTATISTICA(contar_alocacoes(&lista->estat, 1));
+			if (lista->usados > 0) {
+				memcpy(novos_nohs, lista->nohs, lista->usados * sizeof(DNohInd));
+			}
+			delete[] lista->nohs;
+			lista->nohs = novos_nohs;
+			lista->capacidade = (int) capacidade;
+		}
+		i = lista->usados++;
+	}
+
+	DNohInd* novo_noh = &lista->nohs[i];
+	novo_noh->item = item;
+	novo_noh->ant = ant;
+	novo_noh->prox = prox;
+	return i;
+}
+
+/* Coloca o nó de índice "i" no início da lista de nós livres. */
+static void devolver_noh(ListaDInd* lista, int i) {
+	lista->nohs[i].prox = lista->livres;
+	lista->livres = i;
+}
+
+/*
+ * Encontra o índice do nó localizado na posição "pos", partindo do ponto de partida mais próximo
+ * entre o início, o fim e o "dedo", e move o dedo para o nó encontrado (como na ListaDEnc).
+ */
+static int localizar(ListaDInd* lista, int pos) {
+	DNohInd* nohs = lista->nohs;
+	int aux = lista->inicio;
+	int i = 0;
+	int distancia = pos;
+
+	if (lista->tam - 1 - pos < distancia) {
+		aux = lista->fim;
+		i = lista->tam - 1;
+		distancia = i - pos;
+	}
+	if ((lista->dedo != NENHUM) and (abs(pos - lista->pos_dedo) < distancia)) {
+		aux = lista->dedo;
+		i = lista->pos_dedo;
+	}
+	ESTATISTICA(contar_distancia(&lista->estat, abs(pos - i)));
+
+	for (; i < pos; i++) {
+		aux = nohs[aux].prox;
+	}
+	for (; i > pos; i--) {
+		aux = nohs[aux].ant;
+	}
+
+	lista->dedo = aux;
+	lista->pos_dedo = pos;
+	return aux;
+}
+
+/* Mantém o dedo válido após a remoção do nó de índice "i", que estava na posição "pos". */
+static void ajustar_dedo_remocao(ListaDInd* lista, int i, int pos) {
+	if (lista->dedo == i) {
+		lista->dedo = NENHUM;
+	} else if ((lista->dedo != NENHUM) and (pos < lista->pos_dedo)) {
+		lista->pos_dedo--;
+	}
+}
+
+void inserir_no_inicio(ListaDInd* lista, int item) {
+	assert(lista != NULL);
+
+	int novo_noh = criar_noh(lista, item, NENHUM, lista->inicio);
+
+	if (lista->inicio == NENHUM) {
+		lista->fim = novo_noh;
+	} else {
+		lista->nohs[lista->inicio].ant = novo_noh;
+	}
+	lista->inicio = novo_noh;
+
+	if (lista->dedo != NENHUM) {
+		lista->pos_dedo++;
+	}
+	lista->tam++;
+	ESTATISTICA(contar_insercoes(&lista->estat, 1));
+}
+
+void inserir_no_fim(ListaDInd* lista, int item) {
+	assert(lista != NULL);
+
+	int novo_noh = criar_noh(lista, item, lista->fim, NENHUM);
+
+	if (lista->fim == NENHUM) {
+		lista->inicio = novo_noh;
+	} else {
+		lista->nohs[lista->fim].prox = novo_noh;
+	}
+	lista->fim = novo_noh;
+
+	lista->tam++;
+	ESTATISTICA(contar_insercoes(&lista->estat, 1));
+}
+
+void inserir(ListaDInd* lista, int item, int pos) {
+	assert(lista != NULL);
+	assert((pos >= 0) and (pos <= lista->tam));
+
+	if (pos == 0) {
+		inserir_no_inicio(lista, item);
+	} else if (pos == lista->tam) {
+		inserir_no_fim(lista, item);
+	} else {
+		// Encontra o nó localizado na posição de inserção
+		int aux = localizar(lista, pos);
+		int ant = lista->nohs[aux].ant;
+
+		// criar_noh pode realocar o vetor: por isso, os nós são acessados pelo índice depois dela.
+		int novo_noh = criar_noh(lista, item, ant, aux);
+		lista->nohs[ant].prox = novo_noh;
+		lista->nohs[aux].ant = novo_noh;
+
+		// O novo nó passa a ocupar a posição "pos" e o dedo passa a indicá-lo.
+		lista->dedo = novo_noh;
+		lista->tam++;
+		ESTATISTICA(contar_insercoes(&lista->estat, 1));
+	}
+}
+
+int remover_inicio(ListaDInd* lista) {
+	assert(lista != NULL);
+	assert(!estah_vazia(lista));
+
+	int aux = lista->inicio;
+	lista->inicio = lista->nohs[aux].prox;
+
+	if (lista->inicio == NENHUM) {
+		lista->fim = NENHUM;
+	} else {
+		lista->nohs[lista->inicio].ant = NENHUM;
+	}
+
+	ajustar_dedo_remocao(lista, aux, 0);
+	int item = lista->nohs[aux].item;
+	devolver_noh(lista, aux);
+	lista->tam--;
+	ESTATISTICA(contar_remocoes(&lista->estat, 1));
+
+	return item;
+}
+
+int remover_fim(ListaDInd* lista) {
+	assert(lista != NULL);
+	assert(!estah_vazia(lista));
+
+	int aux = lista->fim;
+	lista->fim = lista->nohs[aux].ant;
+
+	if (lista->fim == NENHUM) {
+		lista->inicio = NENHUM;
+	} else {
+		lista->nohs[lista->fim].prox = NENHUM;
+	}
+
+	ajustar_dedo_remocao(lista, aux, lista->tam - 1);
+	int item = lista->nohs[aux].item;
+	devolver_noh(lista, aux);
+	lista->tam--;
+	ESTATISTICA(contar_remocoes(&lista->estat, 1));
+
+	return item;
+}
+
+int remover(ListaDInd* lista, int pos) {
+	assert(lista != NULL);
+	assert((pos >= 0) and (pos < lista->tam));
+	assert(!estah_vazia(lista));
+
+	if (pos == 0) {
+		return remover_inicio(lista);
+	} else if (pos == lista->tam - 1) {
+		return remover_fim(lista);
+	} else {
+		// Encontra o nó localizado na posição de remoção
+		int aux = localizar(lista, pos);
+		DNohInd* noh = &lista->nohs[aux];
+
+		lista->nohs[noh->ant].prox = noh->prox;
+		lista->nohs[noh->prox].ant = noh->ant;
+
+		// O sucessor do nó removido passa a ocupar a posição "pos" e o dedo passa a indicá-lo.
+		lista->dedo = noh->prox;
+
+		int item = noh->item;
+		devolver_noh(lista, aux);
+		lista->tam--;
+		ESTATISTICA(contar_remocoes(&lista->estat, 1));
+
+		return item;
+	}
+}
+
+int obter_inicio(ListaDInd* lista) {
+	assert(lista != NULL);
+	assert(!estah_vazia(lista));
+
+	ESTATISTICA(contar_consulta(&lista->estat));
+	return lista->nohs[lista->inicio].item;
+}
+
+int obter_fim(ListaDInd* lista) {
+	assert(lista != NULL);
+	assert(!estah_vazia(lista));
+
+	ESTATISTICA(contar_consulta(&lista->estat));
+	return lista->nohs[lista->fim].item;
+}
+
+int obter_elemento(ListaDInd* lista, int pos) {
+	assert(lista != NULL);
+	assert((pos >= 0) and (pos < lista->tam));
+	assert(!estah_vazia(lista));
+
+	if (pos == 0) {
+		return obter_inicio(lista);
+	} else if (pos == lista->tam - 1) {
+		return obter_fim(lista);
+	} else {
+		// Encontra o nó localizado na posição desejada
+		int aux = localizar(lista, pos);
+
+		ESTATISTICA(contar_consulta(&lista->estat));
+		return lista->nohs[aux].item;
+	}
+}
+
+int obter_tamanho(ListaDInd* lista) {
+	assert(lista != NULL);
+
+	return lista->tam;
+}
+
+int obter_capacidade(ListaDInd* lista) {
+	assert(lista != NULL);
+
+	return lista->capacidade;
+}
+
+void compactar(ListaDInd* lista) {
+	assert(lista != NULL);
+
+	if (lista->capacidade == 0) {
+		return;
+	}
+
+	// Copia os nós para um novo vetor, na ordem da lista: o nó da posição i vai para o índice i.
+	DNohInd* novos_nohs = new DNohInd[lista->capacidade];
+	ESTATISTICA(contar_alocacoes(&lista->estat, 1));
+	int aux = lista->inicio;
+	for (int i = 0; i < lista->tam; i++) {
+		novos_nohs[i].item = lista->nohs[aux].item;
+		novos_nohs[i].ant = i - 1;
+		novos_nohs[i].prox = i + 1;
+		aux = lista->nohs[aux].prox;
+	}
+	delete[] lista->nohs;
+	lista->nohs = novos_nohs;
+
+	if (lista->tam == 0) {
+		lista->inicio = NENHUM;
+		lista->fim = NENHUM;
+	} else {
+		novos_nohs[lista->tam - 1].prox = NENHUM;
+		lista->inicio = 0;
+		lista->fim = lista->tam - 1;
+	}
+
+	// Não há mais nós livres no meio do vetor, e a posição do dedo passa a ser o seu índice.
+	lista->usados = lista->tam;
+	lista->livres = NENHUM;
+	if (lista->dedo != NENHUM) {
+		lista->dedo = lista->pos_dedo;
+	}
+}
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+const Estatisticas* obter_estatisticas(ListaDInd* lista) {
+	assert(lista != NULL);
+
+	return &lista->estat;
+}
+#endif
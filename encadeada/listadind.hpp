@@ -0,0 +1,334 @@
+/**
+ * \file listadind.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Interface do TAD ListaDInd
+ *
+ * Disponibiliza as funções necessárias para manipulação de uma Lista Duplamente Encadeada por
+ * índices, com as mesmas operações por posição e nas extremidades da ListaDEnc.
+ *
+ * Na ListaDEnc, cada nó guarda o elemento e dois ponteiros de 8 bytes: são 24 bytes por int
+ * armazenado. Na ListaDInd, todos os nós ficam em um único vetor, que dobra de tamanho quando fica
+ * cheio, e cada nó guarda os índices (de 32 bits) do nó anterior e do próximo nesse vetor, e não os
+ * seus endereços: são 12 bytes por nó. Os nós removidos formam uma lista de nós livres, reaproveitados
+ * pelas inserções seguintes, e a liberação da lista inteira é feita em O(1), com um único "delete".
+ * Por causa dos índices de 32 bits, a lista pode ter no máximo INT_MAX elementos: a inserção de mais
+ * um elemento aborta o programa.
+ *
+ * Após muitas inserções e remoções no meio, nós vizinhos na lista podem ficar distantes no vetor.
+ * A operação \p compactar reorganiza o vetor na ordem da lista, de modo que os percursos voltam a
+ * ler a memória em sequência.
+ */
+
+#ifndef LISTADIND_HPP
+#define LISTADIND_HPP
+
+#include "../comum/estatisticas.hpp"
+
+/**
+ * \def CAPACIDADE_INICIAL_DIND
+ * \brief Define a quantidade de nós do vetor alocado na primeira inserção.
+ * \hideinitializer
+ */
+#ifndef CAPACIDADE_INICIAL_DIND
+#define CAPACIDADE_INICIAL_DIND 16
+#endif
+
+/**
+ * \struct ListaDInd
+ * \brief Declaração opaca da estrutura de uma lista.
+ *
+ * Isso significa que os detalhes de implementação desta estrutura estão escondidos do usuário do TAD.
+ * A definição da estrutura ListaDInd encontra-se no arquivo \file listadind.cpp.
+ */
+struct ListaDInd;
+
+/**
+ * \brief Cria dinamicamente uma lista vazia e retorna o endereço onde ela se encontra alocada.
+ *
+ * O vetor de nós só é alocado na primeira inserção.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include "listadind.hpp"
+
+ * int main() {
+ *     ListaDInd *li = criar_lista_dind();
+ *     liberar_lista(li);
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * \return O endereço de memória da lista alocada dinamicamente.
+ */
+ListaDInd* criar_lista_dind();
+
+/**
+ * \brief Libera o espaço de memória anteriormente reservado para a lista, em tempo O(1).
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista a ser liberada da memória.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+void liberar_lista(ListaDInd* li);
+
+/**
+ * \brief Verifica se a lista está vazia.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista cuja situação será consultada.
+ *
+ * \return \p true, se a lista estiver vazia e \p false, caso contrário.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+bool estah_vazia(ListaDInd* li);
+
+/**
+ * \brief Insere um novo elemento em uma posição pré-determinada da lista.
+ *
+ * Como na ListaDEnc, o percurso parte do início, do fim ou do último nó acessado por posição,
+ * o que estiver mais próximo de \p pos.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include "listadind.hpp"
+ *
+ * using namespace std;
+ *
+ * int main() {
+ *     ListaDInd *li = criar_lista_dind();
+ *     for (int i = 0; i < 10; i++) {
+ *         inserir_no_fim(li, i);
+ *     }
+ *     inserir(li, 100, 5);
+ *     cout << obter_elemento(li, 5) << " " << obter_elemento(li, 6) << endl;
+ *     liberar_lista(li);
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * Saída esperada:
+ * \code {.unparsed}
+ * 		100 5
+ * \endcode
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista onde o elemento será inserido.
+ * \param item representa o item a ser inserido na lista.
+ * \param pos representa a posição onde o elemento será inserido na lista,
+ * 		  sendo 0 a posição inicial da lista e TAM a posição, onde TAM refere-se à quantidade de elementos da lista.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ * \warning O programa será abortado, caso o valor do parâmetro \p pos seja menor do que 0 ou maior do que TAM, onde TAM refere-se à quantidade de elementos da lista.
+ */
+void inserir(ListaDInd* li, int item, int pos);
+
+/**
+ * \brief Insere um novo elemento no início da lista, em tempo O(1) amortizado.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista onde o elemento será inserido.
+ * \param item representa o item a ser inserido na lista.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+void inserir_no_inicio(ListaDInd* li, int item);
+
+/**
+ * \brief Insere um novo elemento no final da lista, em tempo O(1) amortizado.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista onde o elemento será inserido.
+ * \param item representa o item a ser inserido na lista.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+void inserir_no_fim(ListaDInd* li, int item);
+
+/**
+ * \brief Remove e retorna o elemento de uma posição pré-determinada da lista.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre A lista não deve estar vazia.
+ *
+ * \param *li representa um ponteiro para a lista de onde o elemento será removido.
+ * \param pos representa a posição do elemento a ser removido na lista,
+ * 		  sendo 0 a posição do primeiro elemento da lista e TAM - 1 a posição do último, onde TAM refere-se à quantidade de elementos da lista.
+ *
+ * \return O elemento removido da posição \p pos da lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL ou
+ * 			caso a lista esteja vazia.
+ * \warning O programa será abortado, caso o valor do parâmetro \p pos seja menor do que 0 ou maior do que TAM - 1, onde TAM refere-se à quantidade de elementos da lista.
+ */
+int remover(ListaDInd* li, int pos);
+
+/**
+ * \brief Remove e retorna o elemento do início da lista.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre A lista não deve estar vazia.
+ *
+ * \param *li representa um ponteiro para a lista de onde o elemento será removido.
+ *
+ * \return O elemento removido do início da lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL ou
+ * 			caso a lista esteja vazia.
+ */
+int remover_inicio(ListaDInd* li);
+
+/**
+ * \brief Remove e retorna o elemento do fim da lista.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre A lista não deve estar vazia.
+ *
+ * \param *li representa um ponteiro para a lista de onde o elemento será removido.
+ *
+ * \return O elemento removido do fim da lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL ou
+ * 			caso a lista esteja vazia.
+ */
+int remover_fim(ListaDInd* li);
+
+/**
+ * \brief Apenas retorna o elemento de uma posição pré-determinada da lista.
+ *
+ * Percorrer a lista com obter_elemento(li, i), para i = 0, 1, 2, ..., custa O(1) por chamada.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre A lista não deve estar vazia.
+ *
+ * \param *li representa um ponteiro para a lista de onde o elemento será obtido.
+ * \param pos representa a posição do elemento a ser retornado na lista,
+ * 		  sendo 0 a posição do primeiro elemento da lista e TAM - 1 a posição do último, onde TAM refere-se à quantidade de elementos da lista.
+ *
+ * \return O elemento da posição \p pos da lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL ou
+ * 			caso a lista esteja vazia.
+ * \warning O programa será abortado, caso o valor do parâmetro \p pos seja menor do que 0 ou maior do que TAM - 1, onde TAM refere-se à quantidade de elementos da lista.
+ */
+int obter_elemento(ListaDInd* li, int pos);
+
+/**
+ * \brief Apenas retorna o elemento do início da lista.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre A lista não deve estar vazia.
+ *
+ * \param *li representa um ponteiro para a lista de onde o elemento será obtido.
+ *
+ * \return O primeiro elemento da lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL ou
+ * 			caso a lista esteja vazia.
+ */
+int obter_inicio(ListaDInd* li);
+
+/**
+ * \brief Apenas retorna o elemento do fim da lista.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre A lista não deve estar vazia.
+ *
+ * \param *li representa um ponteiro para a lista de onde o elemento será obtido.
+ *
+ * \return O último elemento da lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL ou
+ * 			caso a lista esteja vazia.
+ */
+int obter_fim(ListaDInd* li);
+
+/**
+ * \brief Retorna a quantidade de elementos da lista.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista cuja quantidade de elementos será obtida.
+ *
+ * \return A quantidade de elementos existentes na lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+int obter_tamanho(ListaDInd* li);
+
+/**
+ * \brief Retorna a quantidade de nós que cabem no vetor de nós atualmente alocado.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista.
+ *
+ * \return A capacidade do vetor de nós (0, se nenhum elemento foi inserido ainda).
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+int obter_capacidade(ListaDInd* li);
+
+/**
+ * \brief Reorganiza o vetor de nós na ordem da lista, em tempo O(n).
+ *
+ * Após a operação, o elemento da posição i fica no índice i do vetor, e os nós livres ficam
+ * todos após o último elemento. Assim, percorrer a lista volta a ler o vetor em sequência, como
+ * logo após uma série de inserções no fim. A capacidade do vetor não é alterada.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ *     // Depois de muitas inserções e remoções em posições aleatórias:
+ *     compactar(li);
+ *     for (int i = 0; i < obter_tamanho(li); i++) {
+ *         soma += obter_elemento(li, i); // leitura sequencial do vetor de nós
+ *     }
+ * \endcode
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+void compactar(ListaDInd* li);
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+/**
+ * \brief Retorna os contadores de uso da lista.
+ *
+ * Disponível apenas quando a macro ESTRUTURAS_ESTATISTICAS é definida na compilação. Os contadores
+ * continuam sendo atualizados pelas operações seguintes; veja o arquivo estatisticas.hpp.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista.
+ *
+ * \return O endereço dos contadores da lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+const Estatisticas* obter_estatisticas(ListaDInd* li);
+#endif
+
+#endif
@@ -0,0 +1,279 @@
+#include <assert.h> /**< Necessário para uso da macro "assert" */
+#include <climits> /**< Necessário para uso do INT_MAX */
+#include <cstdio> /**< Necessário para uso de fprintf */
+#include <cstdlib> /**< Necessário para uso do NULL e da função "abort" */
+#include <cstring> /**< Necessário para uso da função "memcpy" */
+#include "listadxor.hpp"
+
+/*
+ * Os nós ficam em um vetor e são identificados pela sua posição no vetor mais 1, de modo que o
+ * identificador 0 representa a ausência de nó, como o NULL nas listas com ponteiros.
+ */
+static const unsigned NENHUM = 0;
+
+struct XNoh {
+	int item; /**< Representa a informação a ser armazenada em cada nó da lista. */
+	unsigned ligacao; /**< Identificador do nó anterior XOR identificador do próximo nó. */
+};
+
+struct ListaDXor {
+	XNoh* nohs; /**< Vetor alocado dinamicamente que armazena todos os nós da lista. */
+	unsigned capacidade; /**< Quantidade de nós que cabem no vetor "nohs". */
+	unsigned usados; /**< Quantidade de posições do vetor já usadas alguma vez. */
+	unsigned livres; /**< Primeiro nó da lista de nós livres, encadeada pelo campo "ligacao". */
+	unsigned inicio; /**< Identificador do primeiro nó da lista. */
+	unsigned fim; /**< Identificador do último nó da lista. */
+	int tam; /**< Representa a quantidade de elementos da lista. */
+#ifdef ESTRUTURAS_ESTATISTICAS
+	Estatisticas estat; /**< Contadores de uso (veja estatisticas.hpp). */
+#endif
+};
+
+/* Retorna o endereço do nó com o identificador "id" (diferente de NENHUM). */
+static inline XNoh* noh(ListaDXor* lista, unsigned id) {
+	return &lista->nohs[id - 1];
+}
+
+ListaDXor* criar_lista_dxor() {
+	/*
+	 * Caso não seja possível alocar o espaço solicitado, o próprio operador "new"
+	 * irá lançar uma exceção abortando a execução do programa.
+	 */
+	ListaDXor* lista = new ListaDXor;
+
+	lista->nohs = NULL;
+	lista->capacidade = 0;
+	lista->usados = 0;
+	lista->livres = NENHUM;
+	lista->inicio = NENHUM;
+	lista->fim = NENHUM;
+	lista->tam = 0;
+	ESTATISTICA(zerar_estatisticas(&lista->estat));
+	return lista;
+}
+
+void liberar_lista(ListaDXor* lista) {
+	assert(lista != NULL);
+
+	// Todos os nós estão em um único vetor, liberado de uma só vez.
+	delete[] lista->nohs;
+	delete lista;
+}
+
+bool estah_vazia(ListaDXor* lista) {
+	assert(lista != NULL);
+
+	return (lista->inicio == NENHUM);
+}
+
+/*
+ * Retorna o identificador de um nó livre, com o item e a ligação informados. Os nós devolvidos
+ * são reaproveitados primeiro; quando o vetor está cheio, a sua capacidade é dobrada, até o
+ * limite de INT_MAX nós (o tamanho da lista é um int).
+ */
+static unsigned criar_noh(ListaDXor* lista, int item, unsigned ligacao) {
+	unsigned id = lista->livres;
+	if (id != NENHUM) {
+		lista->livres = noh(lista, id)->ligacao;
+	} else {
+		if (lista->usados == lista->capacidade) {
+			// Não usa assert para que o programa não continue com um vetor menor do que o necessário quando NDEBUG é definida.
+			if (lista->capacidade == INT_MAX) {
+				fprintf(stderr, "ListaDXor: a lista não pode ter mais de %d elementos\n", INT_MAX);
+				abort();
+			}
+			unsigned long long capacidade = (lista->capacidade == 0) ? CAPACIDADE_INICIAL_DXOR : 2ULL * lista->capacidade;
+			if (capacidade > INT_MAX) {
+				capacidade = INT_MAX;
+			}
+			XNoh* novos_nohs = new XNoh[capacidade];
+			ESTATISTICA(contar_alocacoes(&lista->estat, 1));
+			if (lista->usados > 0) {
+				memcpy(novos_nohs, lista->nohs, lista->usados * sizeof(XNoh));
+			}
+			delete[] lista->nohs;
+			lista->nohs = novos_nohs;
+			lista->capacidade = (unsigned) capacidade;
+		}
+		id = ++lista->usados;
+	}
+
+	XNoh* novo_noh = noh(lista, id);
+	novo_noh->item = item;
+	novo_noh->ligacao = ligacao;
+	return id;
+}
+
+/* Coloca o nó "id" no início da lista de nós livres. */
+static void devolver_noh(ListaDXor* lista, unsigned id) {
+	noh(lista, id)->ligacao = lista->livres;
+	lista->livres = id;
+}
+
+/*
+ * Insere um nó antes do nó "extremo", que é o primeiro ou o último da lista. Como a ligação é
+ * simétrica, a mesma função serve às duas extremidades: basta trocar "inicio" por "fim".
+ */
+static void inserir_na_extremidade(ListaDXor* lista, int item, unsigned* extremo, unsigned* oposto) {
+	// O novo nó tem apenas um vizinho: o antigo extremo (XOR com NENHUM não altera o valor).
+	unsigned novo_noh = criar_noh(lista, item, *extremo);
+
+	if (*extremo == NENHUM) {
+		*oposto = novo_noh;
+	} else {
+		noh(lista, *extremo)->ligacao ^= novo_noh;
+	}
+	*extremo = novo_noh;
+
+	lista->tam++;
+	ESTATISTICA(contar_insercoes(&lista->estat, 1));
+}
+
+static int remover_da_extremidade(ListaDXor* lista, unsigned* extremo, unsigned* oposto) {
+	unsigned aux = *extremo;
+
+	// O único vizinho do extremo é o nó que passa a ocupar o seu lugar.
+	unsigned vizinho = noh(lista, aux)->ligacao;
+	*extremo = vizinho;
+
+	if (vizinho == NENHUM) {
+		*oposto = NENHUM;
+	} else {
+		noh(lista, vizinho)->ligacao ^= aux;
+	}
+
+	int item = noh(lista, aux)->item;
+	devolver_noh(lista, aux);
+	lista->tam--;
+	ESTATISTICA(contar_remocoes(&lista->estat, 1));
+
+	return item;
+}
+
+void inserir_no_inicio(ListaDXor* lista, int item) {
+	assert(lista != NULL);
+
+	inserir_na_extremidade(lista, item, &lista->inicio, &lista->fim);
+}
+
+void inserir_no_fim(ListaDXor* lista, int item) {
+	assert(lista != NULL);
+
+	inserir_na_extremidade(lista, item, &lista->fim, &lista->inicio);
+}
+
+int remover_inicio(ListaDXor* lista) {
+	assert(lista != NULL);
+	assert(!estah_vazia(lista));
+
+	return remover_da_extremidade(lista, &lista->inicio, &lista->fim);
+}
+
+int remover_fim(ListaDXor* lista) {
+	assert(lista != NULL);
+	assert(!estah_vazia(lista));
+
+	return remover_da_extremidade(lista, &lista->fim, &lista->inicio);
+}
+
+int obter_inicio(ListaDXor* lista) {
+	assert(lista != NULL);
+	assert(!estah_vazia(lista));
+
+	ESTATISTICA(contar_consulta(&lista->estat));
+	return noh(lista, lista->inicio)->item;
+}
+
+int obter_fim(ListaDXor* lista) {
+	assert(lista != NULL);
+	assert(!estah_vazia(lista));
+
+	ESTATISTICA(contar_consulta(&lista->estat));
+	return noh(lista, lista->fim)->item;
+}
+
+int obter_elemento(ListaDXor* lista, int pos) {
+	assert(lista != NULL);
+	assert((pos >= 0) and (pos < lista->tam));
+
+	// Parte da extremidade mais próxima: do fim, a posição "pos" fica a tam - 1 - pos passos.
+	unsigned atual = lista->inicio;
+	int passos = pos;
+	if (lista->tam - 1 - pos < pos) {
+		atual = lista->fim;
+		passos = lista->tam - 1 - pos;
+	}
+	ESTATISTICA(contar_distancia(&lista->estat, passos));
+
+	// A cada passo, o próximo nó é a ligação do atual XOR o nó de onde se veio.
+	unsigned anterior = NENHUM;
+	for (int i = 0; i < passos; i++) {
+		unsigned proximo = noh(lista, atual)->ligacao ^ anterior;
+		anterior = atual;
+		atual = proximo;
+	}
+
+	ESTATISTICA(contar_consulta(&lista->estat));
+	return noh(lista, atual)->item;
+}
+
+int obter_tamanho(ListaDXor* lista) {
+	assert(lista != NULL);
+
+	return lista->tam;
+}
+
+CursorDXor iniciar_cursor(ListaDXor* lista) {
+	assert(lista != NULL);
+
+	CursorDXor c = {lista, NENHUM, lista->inicio};
+	return c;
+}
+
+CursorDXor cursor_no_fim_da_lista(ListaDXor* lista) {
+	assert(lista != NULL);
+
+	CursorDXor c = {lista, lista->fim, NENHUM};
+	return c;
+}
+
+bool cursor_no_fim(CursorDXor* c) {
+	assert(c != NULL);
+
+	return (c->atual == NENHUM);
+}
+
+void avancar(CursorDXor* c) {
+	assert((c != NULL) and (c->atual != NENHUM));
+
+	unsigned proximo = noh(c->lista, c->atual)->ligacao ^ c->anterior;
+	c->anterior = c->atual;
+	c->atual = proximo;
+}
+
+bool retroceder(CursorDXor* c) {
+	assert(c != NULL);
+
+	if (c->anterior == NENHUM) {
+		return false;
+	}
+	// O nó antes de "anterior" é a ligação de "anterior" XOR o seu outro vizinho, o nó atual.
+	unsigned antes_do_anterior = noh(c->lista, c->anterior)->ligacao ^ c->atual;
+	c->atual = c->anterior;
+	c->anterior = antes_do_anterior;
+	return true;
+}
+
+int valor(CursorDXor* c) {
+	assert((c != NULL) and (c->atual != NENHUM));
+
+	return noh(c->lista, c->atual)->item;
+}
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+const Estatisticas* obter_estatisticas(ListaDXor* lista) {
+	assert(lista != NULL);
+
+	return &lista->estat;
+}
+#endif
@@ -0,0 +1,389 @@
+/**
+ * \file listadxor.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Interface do TAD ListaDXor
+ *
+ * Disponibiliza as funções necessárias para manipulação de uma Lista Duplamente Encadeada compacta,
+ * com ligações XOR (XOR linked list).
+ *
+ * Na ListaDEnc, cada nó guarda o elemento e dois ponteiros de 8 bytes (24 bytes por int
+ * armazenado). Na ListaDXor, os nós ficam em um único vetor, que dobra de tamanho quando fica
+ * cheio, e são identificados por números de 32 bits. Cada nó guarda um único campo de ligação: o
+ * identificador do nó anterior XOR o identificador do próximo nó, ou seja, 8 bytes por nó. A lista
+ * pode ter no máximo INT_MAX elementos: a inserção de mais um elemento aborta o programa.
+ *
+ * Como (anterior XOR próximo) XOR anterior == próximo, quem chega a um nó vindo de um vizinho
+ * descobre o outro vizinho. Por isso, a lista só pode ser percorrida a partir das extremidades,
+ * com um cursor que guarda dois nós vizinhos, nos dois sentidos: não há como ir direto de um nó
+ * qualquer para o seu vizinho, como faz a ListaDEnc nas operações por posição. Assim, a ListaDXor
+ * oferece as operações nas extremidades, em O(1), o acesso por posição (percorrendo a partir da
+ * extremidade mais próxima) e os cursores, mas não a inserção nem a remoção no meio da lista.
+ */
+
+#ifndef LISTADXOR_HPP
+#define LISTADXOR_HPP
+
+#include "../comum/estatisticas.hpp"
+
+/**
+ * \def CAPACIDADE_INICIAL_DXOR
+ * \brief Define a quantidade de nós do vetor alocado na primeira inserção.
+ *
+ * O valor é pequeno porque a ListaDXor é voltada para programas com muitas listas curtas.
+ * \hideinitializer
+ */
+#ifndef CAPACIDADE_INICIAL_DXOR
+#define CAPACIDADE_INICIAL_DXOR 4
+#endif
+
+/**
+ * \struct ListaDXor
+ * \brief Declaração opaca da estrutura de uma lista.
+ *
+ * Isso significa que os detalhes de implementação desta estrutura estão escondidos do usuário do TAD.
+ * A definição da estrutura ListaDXor encontra-se no arquivo \file listadxor.cpp.
+ */
+struct ListaDXor;
+
+/**
+ * \brief Cria dinamicamente uma lista vazia e retorna o endereço onde ela se encontra alocada.
+ *
+ * O vetor de nós só é alocado na primeira inserção.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include "listadxor.hpp"
+
+ * int main() {
+ *     ListaDXor *li = criar_lista_dxor();
+ *     liberar_lista(li);
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * \return O endereço de memória da lista alocada dinamicamente.
+ */
+ListaDXor* criar_lista_dxor();
+
+/**
+ * \brief Libera o espaço de memória anteriormente reservado para a lista, em tempo O(1).
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista a ser liberada da memória.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+void liberar_lista(ListaDXor* li);
+
+/**
+ * \brief Verifica se a lista está vazia.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista cuja situação será consultada.
+ *
+ * \return \p true, se a lista estiver vazia e \p false, caso contrário.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+bool estah_vazia(ListaDXor* li);
+
+/**
+ * \brief Insere um novo elemento no início da lista, em tempo O(1) amortizado.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include "listadxor.hpp"
+ *
+ * using namespace std;
+ *
+ * int main() {
+ *     ListaDXor *li = criar_lista_dxor();
+ *     inserir_no_inicio(li, 2);
+ *     inserir_no_inicio(li, 1);
+ *     inserir_no_fim(li, 3);
+ *     while (!estah_vazia(li)) {
+ *         cout << remover_fim(li) << endl;
+ *     }
+ *     liberar_lista(li);
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * Saída esperada:
+ * \code {.unparsed}
+ *     3
+ *     2
+ *     1
+ * \endcode
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista onde o elemento será inserido.
+ * \param item representa o item a ser inserido na lista.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+void inserir_no_inicio(ListaDXor* li, int item);
+
+/**
+ * \brief Insere um novo elemento no final da lista, em tempo O(1) amortizado.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista onde o elemento será inserido.
+ * \param item representa o item a ser inserido na lista.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+void inserir_no_fim(ListaDXor* li, int item);
+
+/**
+ * \brief Remove e retorna o elemento do início da lista, em tempo O(1).
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre A lista não deve estar vazia.
+ *
+ * \param *li representa um ponteiro para a lista de onde o elemento será removido.
+ *
+ * \return O elemento removido do início da lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL ou
+ * 			caso a lista esteja vazia.
+ */
+int remover_inicio(ListaDXor* li);
+
+/**
+ * \brief Remove e retorna o elemento do fim da lista, em tempo O(1).
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre A lista não deve estar vazia.
+ *
+ * \param *li representa um ponteiro para a lista de onde o elemento será removido.
+ *
+ * \return O elemento removido do fim da lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL ou
+ * 			caso a lista esteja vazia.
+ */
+int remover_fim(ListaDXor* li);
+
+/**
+ * \brief Apenas retorna o elemento do início da lista.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre A lista não deve estar vazia.
+ *
+ * \param *li representa um ponteiro para a lista de onde o elemento será obtido.
+ *
+ * \return O primeiro elemento da lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL ou
+ * 			caso a lista esteja vazia.
+ */
+int obter_inicio(ListaDXor* li);
+
+/**
+ * \brief Apenas retorna o elemento do fim da lista.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre A lista não deve estar vazia.
+ *
+ * \param *li representa um ponteiro para a lista de onde o elemento será obtido.
+ *
+ * \return O último elemento da lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL ou
+ * 			caso a lista esteja vazia.
+ */
+int obter_fim(ListaDXor* li);
+
+/**
+ * \brief Apenas retorna o elemento de uma posição pré-determinada da lista.
+ *
+ * O percurso parte do início ou do fim, o que estiver mais próximo de \p pos. Para percorrer a
+ * lista inteira, use um cursor, que custa O(1) por passo.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre A lista não deve estar vazia.
+ *
+ * \param *li representa um ponteiro para a lista de onde o elemento será obtido.
+ * \param pos representa a posição do elemento a ser retornado na lista,
+ * 		  sendo 0 a posição do primeiro elemento da lista e TAM - 1 a posição do último, onde TAM refere-se à quantidade de elementos da lista.
+ *
+ * \return O elemento da posição \p pos da lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL ou
+ * 			caso a lista esteja vazia.
+ * \warning O programa será abortado, caso o valor do parâmetro \p pos seja menor do que 0 ou maior do que TAM - 1, onde TAM refere-se à quantidade de elementos da lista.
+ */
+int obter_elemento(ListaDXor* li, int pos);
+
+/**
+ * \brief Retorna a quantidade de elementos da lista.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista cuja quantidade de elementos será obtida.
+ *
+ * \return A quantidade de elementos existentes na lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+int obter_tamanho(ListaDXor* li);
+
+/**
+ * \struct CursorDXor
+ * \brief Cursor que marca uma posição da lista, permitindo percorrê-la nos dois sentidos em tempo
+ * O(1) por passo.
+ *
+ * O cursor guarda o nó da posição corrente e o nó anterior a ele, necessários para decodificar as
+ * ligações XOR. Os campos do cursor não devem ser acessados diretamente: use as funções abaixo.
+ * Um cursor deixa de ser válido após qualquer inserção ou remoção na lista.
+ */
+struct CursorDXor {
+	ListaDXor* lista; /**< Lista percorrida pelo cursor. */
+	unsigned anterior; /**< Nó anterior ao da posição corrente (0, se não houver). */
+	unsigned atual; /**< Nó da posição corrente (0, se o cursor estiver após o último elemento). */
+};
+
+/**
+ * \brief Retorna um cursor posicionado no primeiro elemento da lista.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include "listadxor.hpp"
+ *
+ * using namespace std;
+ *
+ * int main() {
+ *     ListaDXor *li = criar_lista_dxor();
+ *     for (int i = 1; i <= 3; i++) {
+ *         inserir_no_fim(li, i);
+ *     }
+ *     for (CursorDXor c = iniciar_cursor(li); !cursor_no_fim(&c); avancar(&c)) {
+ *         cout << valor(&c) << " ";
+ *     }
+ *     CursorDXor c = cursor_no_fim_da_lista(li);
+ *     while (retroceder(&c)) {
+ *         cout << valor(&c) << " ";
+ *     }
+ *     cout << endl;
+ *     liberar_lista(li);
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * Saída esperada:
+ * \code {.unparsed}
+ *     1 2 3 3 2 1
+ * \endcode
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \param *li representa um ponteiro para a lista a ser percorrida.
+ *
+ * \return Um cursor no primeiro elemento da lista ou, caso a lista esteja vazia, após o último.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+CursorDXor iniciar_cursor(ListaDXor* li);
+
+/**
+ * \brief Retorna um cursor posicionado após o último elemento da lista, de onde se pode retroceder.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \param *li representa um ponteiro para a lista a ser percorrida.
+ *
+ * \return Um cursor após o último elemento da lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+CursorDXor cursor_no_fim_da_lista(ListaDXor* li);
+
+/**
+ * \brief Verifica se o cursor já passou do último elemento da lista.
+ *
+ * \pre O ponteiro \p *c deve ser diferente de \p NULL.
+ * \param *c representa um ponteiro para o cursor.
+ *
+ * \return \p true, se o cursor estiver após o último elemento e \p false, caso contrário.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *c seja igual a \p NULL.
+ */
+bool cursor_no_fim(CursorDXor* c);
+
+/**
+ * \brief Move o cursor para o próximo elemento da lista, em tempo O(1).
+ *
+ * \pre O ponteiro \p *c deve ser diferente de \p NULL.
+ * \pre O cursor não deve estar após o último elemento.
+ * \param *c representa um ponteiro para o cursor.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *c seja igual a \p NULL ou
+ * 			caso o cursor esteja após o último elemento.
+ */
+void avancar(CursorDXor* c);
+
+/**
+ * \brief Move o cursor para o elemento anterior da lista, em tempo O(1).
+ *
+ * Se o cursor estiver após o último elemento, ele passa para o último elemento.
+ *
+ * \pre O ponteiro \p *c deve ser diferente de \p NULL.
+ * \param *c representa um ponteiro para o cursor.
+ *
+ * \return \p true, se o cursor foi movido e \p false, caso ele já estivesse no primeiro elemento
+ *         (ou a lista esteja vazia). Neste caso, o cursor não é alterado.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *c seja igual a \p NULL.
+ */
+bool retroceder(CursorDXor* c);
+
+/**
+ * \brief Retorna o elemento da posição corrente do cursor.
+ *
+ * \pre O ponteiro \p *c deve ser diferente de \p NULL.
+ * \pre O cursor não deve estar após o último elemento.
+ * \param *c representa um ponteiro para o cursor.
+ *
+ * \return O elemento da posição corrente.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *c seja igual a \p NULL ou
+ * 			caso o cursor esteja após o último elemento.
+ */
+int valor(CursorDXor* c);
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+/**
+ * \brief Retorna os contadores de uso da lista.
+ *
+ * Disponível apenas quando a macro ESTRUTURAS_ESTATISTICAS é definida na compilação. Os contadores
+ * continuam sendo atualizados pelas operações seguintes; veja o arquivo estatisticas.hpp.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista.
+ *
+ * \return O endereço dos contadores da lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+const Estatisticas* obter_estatisticas(ListaDXor* li);
+#endif
+
+#endif
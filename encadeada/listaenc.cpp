@@ -1,6 +1,8 @@
 #include <assert.h> /**< Necessário para uso da macro "assert" */
 #include <cstdlib> /**< Necessário para uso do NULL */
 #include "listaenc.hpp"
+#include "ordenacaonoh.hpp"
+#include "poolnoh.hpp"
 
 struct Noh {
 	int item; /**< Representa a informação a ser armazenada em cada nó da lista. */
@@ -9,10 +11,16 @@ struct Noh {
 
 struct ListaEnc {
     Noh* inicio; /**< É um ponteiro para o início da lista. */
+    Noh* fim; /**< É um ponteiro para o último nó da lista. */
     int tam; /**< Representa a quantidade de elementos da lista. */
+    PoolNoh* pool; /**< Pool de onde são alocados os nós da lista. */
+#ifdef ESTRUTURAS_ESTATISTICAS
+	Estatisticas estat; /**< Contadores de uso (veja estatisticas.hpp). */
+#endif
 };
 
-ListaEnc* criar_lista() {
+/* Cria uma lista vazia que aloca os seus nós do pool informado. */
+static ListaEnc* criar_lista_com_pool(PoolNoh* pool) {
     /* 
 	 * Caso não seja possível alocar o espaço solicitado, o próprio operador "new"
 	 * irá lançar uma exceção abortando a execução do programa.
@@ -20,10 +28,17 @@ ListaEnc* criar_lista() {
 	ListaEnc* lista = new ListaEnc;    
     
     lista->inicio = NULL;
+    lista->fim = NULL;
     lista->tam = 0;
+    lista->pool = pool;
+    ESTATISTICA(zerar_estatisticas(&lista->estat));
     return lista;
 }
 
+ListaEnc* criar_lista() {
+	return criar_lista_com_pool(criar_pool(sizeof(Noh), NOHS_POR_BLOCO));
+}
+
 void liberar_lista(ListaEnc* lista) {
     /* 
 	 * Macro da biblioteca \file assert.h. Aborta a execução do programa e envia uma mensagem 
@@ -32,10 +47,8 @@ void liberar_lista(ListaEnc* lista) {
 	*/
 	assert(lista != NULL);
 	
-	// Libera a memória alocada para cada nó da lista individualmente.
-	while(lista->inicio != NULL) {
-		remover(lista, 0);
-	}	
+	// Todos os nós da lista estão nos blocos do pool, que são liberados de uma só vez.
+	liberar_pool(lista->pool);
 	delete lista;		
 }
 
@@ -49,24 +62,36 @@ void inserir(ListaEnc* lista, int item, int pos) {
     assert(lista != NULL);
 	assert((pos >=0) and (pos <= lista->tam));
 	
-    Noh* novo_noh = new Noh;
+    Noh* novo_noh = static_cast<Noh*>(alocar_noh(lista->pool));
     novo_noh->item = item;
     
     if (pos == 0) {		
         novo_noh->prox = lista->inicio;
         lista->inicio = novo_noh;
+        ESTATISTICA(contar_distancia(&lista->estat, 0));
+    } else if (pos == lista->tam) {
+        // No final da lista, o nó anterior é o próprio nó "fim"
+        novo_noh->prox = NULL;
+        lista->fim->prox = novo_noh;
+        ESTATISTICA(contar_distancia(&lista->estat, 0));
     } else {
         // Encontra o nó anterior à posição de inserção
         Noh* aux = lista->inicio;
         for(int i = 0; i < pos - 1; i++) {
             aux = aux->prox;
         }
+        ESTATISTICA(contar_distancia(&lista->estat, pos - 1));
 
         // Adiciona o novo nó
         novo_noh->prox = aux->prox;
         aux->prox = novo_noh;
     }
+    if (novo_noh->prox == NULL) {
+        lista->fim = novo_noh;
+    }
     lista->tam++;
+    ESTATISTICA(contar_alocacoes(&lista->estat, 1));
+    ESTATISTICA(contar_insercoes(&lista->estat, 1));
 }
 
 int remover(ListaEnc* lista, int pos) {
@@ -88,11 +113,16 @@ int remover(ListaEnc* lista, int pos) {
         // Atualiza o ponteiro "prox" do nó "ant"
         ant->prox = aux->prox;       
     }
+    if (aux->prox == NULL) {
+        lista->fim = (pos == 0) ? NULL : ant;
+    }
     
     // Remove o nó "aux"
     int item = aux->item;
-    delete aux;
+    devolver_noh(lista->pool, aux);
     lista->tam--;
+    ESTATISTICA(contar_distancia(&lista->estat, pos));
+    ESTATISTICA(contar_remocoes(&lista->estat, 1));
     return item; 
 }
 
@@ -105,6 +135,8 @@ int obter_elemento(ListaEnc* lista, int pos) {
     for(int i = 0; i < pos; i++) {
         aux = aux->prox;
     }    
+    ESTATISTICA(contar_distancia(&lista->estat, pos));
+    ESTATISTICA(contar_consulta(&lista->estat));
     return aux->item; 
 }
 
@@ -114,3 +146,282 @@ int obter_tamanho(ListaEnc *lista) {
 	return lista->tam;
 }
 
+
+void inserir_intervalo(ListaEnc* lista, int pos, const int* primeiro, const int* ultimo) {
+    assert((lista != NULL) and (primeiro != NULL) and (ultimo != NULL));
+    assert(primeiro <= ultimo);
+	assert((pos >=0) and (pos <= lista->tam));
+	
+	int n = (int) (ultimo - primeiro);
+	if (n == 0) {
+		return;
+	}
+	
+	// Monta a cadeia de nós à parte, na ordem do intervalo
+	Noh* cabeca = static_cast<Noh*>(alocar_noh(lista->pool));
+	cabeca->item = primeiro[0];
+	Noh* cauda = cabeca;
+	for (int i = 1; i < n; i++) {
+		Noh* novo_noh = static_cast<Noh*>(alocar_noh(lista->pool));
+		novo_noh->item = primeiro[i];
+		cauda->prox = novo_noh;
+		cauda = novo_noh;
+	}
+	
+	// Encontra o ponteiro que deve passar a apontar para a cadeia e a liga de uma só vez
+	Noh** ligacao = &lista->inicio;
+	if ((pos > 0) and (pos == lista->tam)) {
+		ligacao = &lista->fim->prox;
+	} else {
+		for (int i = 0; i < pos; i++) {
+			ligacao = &(*ligacao)->prox;
+		}
+	}
+	cauda->prox = *ligacao;
+	*ligacao = cabeca;
+	if (cauda->prox == NULL) {
+		lista->fim = cauda;
+	}
+	lista->tam += n;
+	ESTATISTICA(contar_distancia(&lista->estat, pos));
+	ESTATISTICA(contar_alocacoes(&lista->estat, n));
+	ESTATISTICA(contar_insercoes(&lista->estat, n));
+}
+
+void remover_intervalo(ListaEnc* lista, int pos, int n, int* saida) {
+    assert(lista != NULL);
+    assert((pos >= 0) and (n >= 0) and (pos + n <= lista->tam));
+    
+	Noh* ant = NULL;
+	Noh** ligacao = &lista->inicio;
+	for (int i = 0; i < pos; i++) {
+		ant = *ligacao;
+		ligacao = &(*ligacao)->prox;
+	}
+	
+	// Devolve os "n" nós ao pool e religa a lista de uma só vez
+	Noh* aux = *ligacao;
+	for (int i = 0; i < n; i++) {
+		Noh* prox = aux->prox;
+		if (saida != NULL) {
+			saida[i] = aux->item;
+		}
+		devolver_noh(lista->pool, aux);
+		aux = prox;
+	}
+	*ligacao = aux;
+	if (aux == NULL) {
+		lista->fim = ant;
+	}
+	lista->tam -= n;
+	ESTATISTICA(contar_distancia(&lista->estat, pos));
+	ESTATISTICA(contar_remocoes(&lista->estat, n));
+}
+
+/* Retorna o nó da posição "pos" (NULL, se pos for -1), percorrendo a lista desde o início. */
+static Noh* localizar(ListaEnc* lista, int pos) {
+	if (pos < 0) {
+		return NULL;
+	}
+	if (pos == lista->tam - 1) {
+		return lista->fim;
+	}
+	Noh* aux = lista->inicio;
+	for (int i = 0; i < pos; i++) {
+		aux = aux->prox;
+	}
+	ESTATISTICA(contar_distancia(&lista->estat, pos));
+	return aux;
+}
+
+/*
+ * Move para "destino", logo após o nó "ant_destino" (ou no início, se ele for NULL), os "n" nós de
+ * "origem" que seguem o nó "ant_origem" (ou que começam no início) e terminam em "ultimo".
+ * Os nós são apenas religados, a menos que os pools das listas não possam ser unificados: nesse
+ * caso, os elementos são copiados para nós do pool de "destino".
+ */
+static void mover_cadeia(ListaEnc* destino, Noh* ant_destino, ListaEnc* origem, Noh* ant_origem, Noh* ultimo, int n) {
+	// Desliga a cadeia da origem
+	Noh** ligacao_origem = (ant_origem == NULL) ? &origem->inicio : &ant_origem->prox;
+	Noh* primeiro = *ligacao_origem;
+	*ligacao_origem = ultimo->prox;
+	if (origem->fim == ultimo) {
+		origem->fim = ant_origem;
+	}
+	ultimo->prox = NULL;
+	origem->tam -= n;
+	ESTATISTICA(contar_remocoes(&origem->estat, n));
+
+	if (!unificar_pools(&destino->pool, &origem->pool)) {
+		Noh* cauda = NULL;
+		Noh* aux = primeiro;
+		for (int i = 0; i < n; i++) {
+			Noh* prox = aux->prox;
+			Noh* novo_noh = static_cast<Noh*>(alocar_noh(destino->pool));
+			novo_noh->item = aux->item;
+			novo_noh->prox = NULL;
+			if (cauda == NULL) {
+				primeiro = novo_noh;
+			} else {
+				cauda->prox = novo_noh;
+			}
+			cauda = novo_noh;
+			devolver_noh(origem->pool, aux);
+			aux = prox;
+		}
+		ultimo = cauda;
+		ESTATISTICA(contar_alocacoes(&destino->estat, n));
+	}
+
+	// Liga a cadeia ao destino
+	Noh** ligacao_destino = (ant_destino == NULL) ? &destino->inicio : &ant_destino->prox;
+	ultimo->prox = *ligacao_destino;
+	*ligacao_destino = primeiro;
+	if (ultimo->prox == NULL) {
+		destino->fim = ultimo;
+	}
+	destino->tam += n;
+	ESTATISTICA(contar_insercoes(&destino->estat, n));
+}
+
+void concatenar(ListaEnc* a, ListaEnc* b) {
+	assert((a != NULL) and (b != NULL) and (a != b));
+
+	if (b->tam > 0) {
+		mover_cadeia(a, a->fim, b, NULL, b->fim, b->tam);
+	}
+}
+
+ListaEnc* dividir(ListaEnc* lista, int pos) {
+	assert(lista != NULL);
+	assert((pos >= 0) and (pos <= lista->tam));
+
+	// A nova lista já nasce usando o mesmo pool, de modo que os nós são sempre apenas religados.
+	ListaEnc* nova = criar_lista_com_pool(compartilhar_pool(lista->pool));
+	if (pos < lista->tam) {
+		mover_cadeia(nova, NULL, lista, localizar(lista, pos - 1), lista->fim, lista->tam - pos);
+	}
+	return nova;
+}
+
+void transferir(ListaEnc* destino, int pos, ListaEnc* origem, int de, int ate) {
+	assert((destino != NULL) and (origem != NULL) and (destino != origem));
+	assert((pos >= 0) and (pos <= destino->tam));
+	assert((de >= 0) and (de <= ate) and (ate <= origem->tam));
+
+	if (de == ate) {
+		return;
+	}
+
+	// O último nó do intervalo é alcançado a partir do anterior ao primeiro, sem voltar ao início.
+	Noh* ant_origem = localizar(origem, de - 1);
+	Noh* ultimo = (ant_origem == NULL) ? origem->inicio : ant_origem->prox;
+	if (ate == origem->tam) {
+		ultimo = origem->fim;
+	} else {
+		for (int i = de; i < ate - 1; i++) {
+			ultimo = ultimo->prox;
+		}
+	}
+	mover_cadeia(destino, localizar(destino, pos - 1), origem, ant_origem, ultimo, ate - de);
+}
+
+void ordenar(ListaEnc* lista) {
+	ordenar_paralelo(lista, 1);
+}
+
+void ordenar_paralelo(ListaEnc* lista, int qtd_threads) {
+	assert(lista != NULL);
+
+	Cadeia<Noh> c = {lista->inicio, lista->fim};
+	c = ordenar_cadeia_paralelo(c, lista->tam, qtd_threads);
+	lista->inicio = c.inicio;
+	lista->fim = c.fim;
+}
+
+CursorEnc iniciar_cursor(ListaEnc* lista) {
+    assert(lista != NULL);
+
+    CursorEnc c = {lista, NULL, lista->inicio};
+    return c;
+}
+
+bool cursor_no_fim(CursorEnc* c) {
+    assert(c != NULL);
+
+    return (c->atual == NULL);
+}
+
+void avancar(CursorEnc* c) {
+    assert((c != NULL) and (c->atual != NULL));
+
+    c->ant = c->atual;
+    c->atual = c->atual->prox;
+}
+
+int valor(CursorEnc* c) {
+    assert((c != NULL) and (c->atual != NULL));
+
+    return c->atual->item;
+}
+
+int* endereco_do_valor(CursorEnc* c) {
+    assert((c != NULL) and (c->atual != NULL));
+
+    return &c->atual->item;
+}
+
+void inserir_no_cursor(CursorEnc* c, int item) {
+    assert(c != NULL);
+
+    ListaEnc* lista = c->lista;
+    Noh* novo_noh = static_cast<Noh*>(alocar_noh(lista->pool));
+    novo_noh->item = item;
+    novo_noh->prox = c->atual;
+
+    // O novo nó fica entre "ant" e "atual" e passa a ser o antecessor da posição corrente
+    if (c->ant == NULL) {
+        lista->inicio = novo_noh;
+    } else {
+        c->ant->prox = novo_noh;
+    }
+    if (c->atual == NULL) {
+        lista->fim = novo_noh;
+    }
+    c->ant = novo_noh;
+    lista->tam++;
+    ESTATISTICA(contar_alocacoes(&lista->estat, 1));
+    ESTATISTICA(contar_insercoes(&lista->estat, 1));
+}
+
+int remover_no_cursor(CursorEnc* c) {
+    assert((c != NULL) and (c->atual != NULL));
+
+    ListaEnc* lista = c->lista;
+    Noh* aux = c->atual;
+
+    // Desliga o nó "aux", cujo antecessor é conhecido pelo cursor
+    if (c->ant == NULL) {
+        lista->inicio = aux->prox;
+    } else {
+        c->ant->prox = aux->prox;
+    }
+    c->atual = aux->prox;
+    if (aux->prox == NULL) {
+        lista->fim = c->ant;
+    }
+
+    int item = aux->item;
+    devolver_noh(lista->pool, aux);
+    lista->tam--;
+    ESTATISTICA(contar_remocoes(&lista->estat, 1));
+    return item;
+}
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+const Estatisticas* obter_estatisticas(ListaEnc* lista) {
+	assert(lista != NULL);
+
+	return &lista->estat;
+}
+#endif
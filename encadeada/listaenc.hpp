@@ -10,6 +10,11 @@
 #ifndef LISTAENC_HPP
 #define LISTAENC_HPP
 
+#include "../comum/estatisticas.hpp"
+
+#include <cstddef> /**< Necessário para uso do NULL e do tipo "std::ptrdiff_t". */
+#include <iterator> /**< Necessário para uso da etiqueta "std::forward_iterator_tag". */
+
 /** 
  * \struct ListaEnc
  * \brief Declaração opaca da estrutura de uma lista.
@@ -49,6 +54,9 @@ ListaEnc* criar_lista();
 /** 
  * \brief Libera o espaço de memória anteriormente reservado para a lista.
  *  
+ * Os nós da lista são alocados em blocos por um pool (veja \file poolnoh.hpp). Por isso, a liberação
+ * é feita bloco a bloco, sem percorrer os elementos da lista.
+ *
  * Exemplo de uso:
  * \code {.cpp}
  * #include<cstdlib>
@@ -281,4 +289,475 @@ int obter_elemento(ListaEnc* li, int pos);
  */
 int obter_tamanho(ListaEnc* li);
 
+/** 
+ * \brief Insere, de uma só vez, os elementos do intervalo [primeiro, ultimo) a partir da posição \p pos.
+ * 
+ * Após a operação, *primeiro ocupa a posição \p pos, *(primeiro + 1) a posição pos + 1 e assim por
+ * diante. A cadeia de nós é montada à parte e ligada à lista de uma só vez, com um único percurso
+ * até a posição \p pos, em vez de um percurso por elemento inserido.
+ * 
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include "listaenc.hpp"
+ * 
+ * using namespace std;
+ *
+ * int main() {
+ *     ListaEnc *li = criar_lista();
+ *     int v[] = {2, 3, 4};
+ *     inserir(li, 1, 0);
+ *     inserir(li, 5, 1);
+ *     inserir_intervalo(li, 1, v, v + 3);
+ *     remover_intervalo(li, 0, 2, NULL);
+ *     for (int i = 0; i < obter_tamanho(li); i++) {
+ *         cout << obter_elemento(li, i) << " ";
+ *     }
+ *     cout << endl;
+ *     liberar_lista(li);
+ *     return EXIT_SUCCESS;
+ * }  
+ * \endcode
+ * 
+ * Saída esperada:
+ * \code {.unparsed}
+ *     3 4 5
+ * \endcode
+ * 
+ * \pre Os ponteiros \p *li, \p *primeiro e \p *ultimo devem ser diferentes de \p NULL, com primeiro <= ultimo.
+ * \pre A posição \p pos deve estar no intervalo [0, tamanho_da_lista].
+ * 
+ * \param *li representa um ponteiro para a lista.
+ * \param pos representa a posição onde o primeiro elemento do intervalo será inserido.
+ * \param *primeiro representa o endereço do primeiro elemento a ser inserido.
+ * \param *ultimo representa o endereço seguinte ao último elemento a ser inserido.
+ * 
+ * \return void
+ * 
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL
+ * 			ou caso a posição informada seja inválida.
+ */
+void inserir_intervalo(ListaEnc* li, int pos, const int* primeiro, const int* ultimo);
+
+/** 
+ * \brief Remove, de uma só vez, os \p n elementos a partir da posição \p pos.
+ * 
+ * Os nós removidos são devolvidos ao pool durante um único percurso, e a lista é religada uma só vez.
+ * 
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre O intervalo [pos, pos + n - 1] deve estar contido em [0, tamanho_da_lista - 1].
+ * 
+ * \param *li representa um ponteiro para a lista.
+ * \param pos representa a posição do primeiro elemento a ser removido.
+ * \param n representa a quantidade de elementos a serem removidos.
+ * \param *saida representa o vetor, com pelo menos \p n posições, que receberá os elementos removidos,
+ * 		  na ordem em que estavam na lista. Se for \p NULL, os elementos são apenas descartados.
+ * 
+ * \return void
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL ou
+ * 			caso o intervalo seja inválido.
+ */
+void remover_intervalo(ListaEnc* li, int pos, int n, int* saida);
+
+/** 
+ * \brief Move todos os elementos de \p b para o final de \p a, em tempo O(1), deixando \p b vazia.
+ * 
+ * A lista guarda um ponteiro para o seu último nó, de modo que basta ligá-lo ao primeiro nó de \p b.
+ * Esta operação, \p dividir e \p transferir apenas religam os nós, sem alocar nem liberar memória.
+ * Para isso, as listas envolvidas passam a alocar os seus nós de um mesmo pool (veja poolnoh.hpp),
+ * que só é liberado junto com a última delas. A única exceção é quando as duas listas já
+ * compartilham pools diferentes com outras listas: nesse caso, os elementos são copiados.
+ * 
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include "listaenc.hpp"
+ * 
+ * using namespace std;
+ *
+ * int main() {
+ *     ListaEnc *a = criar_lista();
+ *     ListaEnc *b = criar_lista();
+ *     for (int i = 1; i <= 3; i++) {
+ *         inserir(a, i, i - 1);
+ *         inserir(b, 10 * i, i - 1);
+ *     }
+ *     concatenar(a, b);               // a: 1 2 3 10 20 30; b: vazia
+ *     ListaEnc *c = dividir(a, 4);    // a: 1 2 3 10; c: 20 30
+ *     transferir(b, 0, a, 1, 3);      // a: 1 10; b: 2 3
+ *     for (int x : a) {
+ *         cout << x << " ";
+ *     }
+ *     cout << endl;
+ *     liberar_lista(a);
+ *     liberar_lista(b);
+ *     liberar_lista(c);
+ *     return EXIT_SUCCESS;
+ * }  
+ * \endcode
+ * 
+ * Saída esperada:
+ * \code {.unparsed}
+ *     1 10
+ * \endcode
+ * 
+ * \pre Os ponteiros \p *a e \p *b devem ser diferentes de \p NULL e entre si.
+ * 
+ * \param *a representa um ponteiro para a lista que receberá os elementos.
+ * \param *b representa um ponteiro para a lista cujos elementos serão movidos.
+ * 
+ * \return void
+ * 
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL ou caso \p a e \p b sejam a mesma lista.
+ */
+void concatenar(ListaEnc* a, ListaEnc* b);
+
+/** 
+ * \brief Move os elementos das posições [pos, tamanho_da_lista - 1] para uma nova lista, que é retornada.
+ * 
+ * Os nós são apenas religados: o custo é o de percorrer a lista até a posição pos - 1.
+ * A nova lista usa o mesmo pool de \p li e deve ser liberada com \p liberar_lista.
+ * 
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \pre A posição \p pos deve estar no intervalo [0, tamanho_da_lista].
+ * 
+ * \param *li representa um ponteiro para a lista a ser dividida.
+ * \param pos representa a posição do primeiro elemento que passará para a nova lista.
+ * 
+ * \return O endereço da nova lista (vazia, caso \p pos seja igual ao tamanho da lista).
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL ou
+ * 			caso a posição informada seja inválida.
+ */
+ListaEnc* dividir(ListaEnc* li, int pos);
+
+/** 
+ * \brief Move os elementos das posições [de, ate) de \p origem para \p destino, a partir da posição \p pos.
+ * 
+ * Após a operação, o elemento que estava na posição \p de de \p origem ocupa a posição \p pos de
+ * \p destino. Os nós são apenas religados (veja \p concatenar): o custo é o de percorrer \p origem
+ * até a posição ate - 1 e \p destino até a posição pos - 1 (as duas em O(1) no fim da lista).
+ * 
+ * \pre Os ponteiros \p *destino e \p *origem devem ser diferentes de \p NULL e entre si.
+ * \pre A posição \p pos deve estar no intervalo [0, tamanho_de_destino].
+ * \pre 0 <= de <= ate <= tamanho_de_origem.
+ * 
+ * \param *destino representa um ponteiro para a lista que receberá os elementos.
+ * \param pos representa a posição de \p destino onde o primeiro elemento movido será inserido.
+ * \param *origem representa um ponteiro para a lista de onde os elementos serão retirados.
+ * \param de representa a posição do primeiro elemento a ser movido.
+ * \param ate representa a posição seguinte à do último elemento a ser movido.
+ * 
+ * \return void
+ * 
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL,
+ * 			caso as listas sejam a mesma ou caso alguma posição seja inválida.
+ */
+void transferir(ListaEnc* destino, int pos, ListaEnc* origem, int de, int ate);
+
+/** 
+ * \brief Coloca os elementos da lista em ordem não decrescente, apenas religando os nós.
+ * 
+ * A ordenação é um merge sort de baixo para cima, estável, que não aloca nem copia nenhum nó e usa
+ * espaço extra constante (veja ordenacaonoh.hpp). O custo é O(n log n); sequências que já estão
+ * em ordem, crescente ou decrescente, são aproveitadas, de modo que uma lista já ordenada ou em
+ * ordem inversa é ordenada em O(n).
+ * 
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include "listaenc.hpp"
+ * 
+ * using namespace std;
+ *
+ * int main() {
+ *     ListaEnc *li = criar_lista();
+ *     int v[] = {5, -1, 4, 1, 3};
+ *     inserir_intervalo(li, 0, v, v + 5);
+ *     ordenar(li);
+ *     for (int x : li) {
+ *         cout << x << " ";
+ *     }
+ *     cout << endl;
+ *     liberar_lista(li);
+ *     return EXIT_SUCCESS;
+ * }  
+ * \endcode
+ * 
+ * Saída esperada:
+ * \code {.unparsed}
+ *     -1 1 3 4 5
+ * \endcode
+ * 
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * 
+ * \param *li representa um ponteiro para a lista.
+ * 
+ * \return void
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+void ordenar(ListaEnc* li);
+
+/** 
+ * \brief Faz o mesmo que \p ordenar, usando até \p qtd_threads threads.
+ * 
+ * A lista é dividida em partes com a mesma quantidade de nós (pelo menos LIMIAR_ORDENACAO_PARALELA
+ * cada), que são ordenadas ao mesmo tempo, e as partes ordenadas são intercaladas duas a duas, também
+ * ao mesmo tempo. A divisão e a última intercalação percorrem a lista inteira em uma só thread, o
+ * que limita o ganho com muitas threads.
+ * 
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * 
+ * \param *li representa um ponteiro para a lista.
+ * \param qtd_threads representa a quantidade máxima de threads (1 ou menos: o mesmo que \p ordenar).
+ * 
+ * \return void
+ * 
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+void ordenar_paralelo(ListaEnc* li, int qtd_threads);
+
+/** 
+ * \struct CursorEnc
+ * \brief Cursor que marca uma posição da lista, permitindo percorrê-la e modificá-la em tempo O(1) por passo.
+ * 
+ * Percorrer a lista com obter_elemento(li, i), para i = 0, 1, 2, ..., recomeça do início a cada
+ * chamada e custa O(n^2) no total. O cursor guarda o nó da posição corrente (e o seu antecessor,
+ * necessário para inserir e remover em O(1) em uma lista simplesmente encadeada), de modo que o
+ * percurso completo custa O(n).
+ * 
+ * Os campos do cursor não devem ser acessados diretamente: use as funções abaixo. Um cursor deixa
+ * de ser válido se a lista for modificada por outro meio que não ele próprio (por exemplo, pelas
+ * funções inserir e remover ou por outro cursor).
+ */
+struct CursorEnc {
+	ListaEnc* lista; /**< Lista percorrida pelo cursor. */
+	Noh* ant; /**< Nó anterior à posição corrente (NULL, se o cursor estiver no início da lista). */
+	Noh* atual; /**< Nó da posição corrente (NULL, se o cursor estiver após o último elemento). */
+};
+
+/** 
+ * \brief Retorna um cursor posicionado no primeiro elemento da lista.
+ * 
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include "listaenc.hpp"
+ * 
+ * using namespace std;
+ *
+ * int main() {
+ *     ListaEnc *li = criar_lista();
+ *     inserir(li, 1, 0);
+ *     inserir(li, 3, 1);
+ *     CursorEnc c = iniciar_cursor(li);
+ *     avancar(&c);
+ *     inserir_no_cursor(&c, 2);
+ *     for (c = iniciar_cursor(li); !cursor_no_fim(&c); avancar(&c)) {
+ *         cout << valor(&c) << " ";
+ *     }
+ *     cout << endl;
+ *     liberar_lista(li);
+ *     return EXIT_SUCCESS;
+ * }  
+ * \endcode
+ * 
+ * Saída esperada:
+ * \code {.unparsed}
+ *     1 2 3
+ * \endcode
+ * 
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ * \param *li representa um ponteiro para a lista a ser percorrida.
+ * 
+ * \return Um cursor no primeiro elemento da lista ou, caso a lista esteja vazia, após o último.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+CursorEnc iniciar_cursor(ListaEnc* li);
+
+/** 
+ * \brief Verifica se o cursor já passou do último elemento da lista.
+ * 
+ * \pre O ponteiro \p *c deve ser diferente de \p NULL.
+ * \param *c representa um ponteiro para o cursor.
+ * 
+ * \return \p true, se o cursor estiver após o último elemento e \p false, caso contrário.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *c seja igual a \p NULL.
+ */
+bool cursor_no_fim(CursorEnc* c);
+
+/** 
+ * \brief Move o cursor para o próximo elemento da lista, em tempo O(1).
+ * 
+ * \pre O ponteiro \p *c deve ser diferente de \p NULL.
+ * \pre O cursor não deve estar após o último elemento.
+ * \param *c representa um ponteiro para o cursor.
+ * 
+ * \return void
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *c seja igual a \p NULL ou
+ * 			caso o cursor esteja após o último elemento.
+ */
+void avancar(CursorEnc* c);
+
+/** 
+ * \brief Retorna o elemento da posição corrente do cursor.
+ * 
+ * \pre O ponteiro \p *c deve ser diferente de \p NULL.
+ * \pre O cursor não deve estar após o último elemento.
+ * \param *c representa um ponteiro para o cursor.
+ * 
+ * \return O elemento da posição corrente.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *c seja igual a \p NULL ou
+ * 			caso o cursor esteja após o último elemento.
+ */
+int valor(CursorEnc* c);
+
+/** 
+ * \brief Retorna o endereço onde está armazenado o elemento da posição corrente do cursor,
+ * permitindo alterá-lo. O endereço é válido enquanto o elemento permanecer na lista.
+ * 
+ * \pre O ponteiro \p *c deve ser diferente de \p NULL.
+ * \pre O cursor não deve estar após o último elemento.
+ * \param *c representa um ponteiro para o cursor.
+ * 
+ * \return O endereço do elemento da posição corrente.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *c seja igual a \p NULL ou
+ * 			caso o cursor esteja após o último elemento.
+ */
+int* endereco_do_valor(CursorEnc* c);
+
+/** 
+ * \brief Insere um novo elemento imediatamente antes da posição corrente do cursor, em tempo O(1).
+ * 
+ * O cursor continua no mesmo elemento, de modo que inserções sucessivas ficam na ordem em que
+ * foram feitas. Com o cursor após o último elemento, a inserção é feita no final da lista.
+ * 
+ * \pre O ponteiro \p *c deve ser diferente de \p NULL.
+ * \param *c representa um ponteiro para o cursor.
+ * \param item representa o item a ser inserido na lista.
+ * 
+ * \return void
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *c seja igual a \p NULL.
+ */
+void inserir_no_cursor(CursorEnc* c, int item);
+
+/** 
+ * \brief Remove e retorna o elemento da posição corrente do cursor, em tempo O(1).
+ * 
+ * Após a remoção, o cursor passa para o elemento seguinte ao removido.
+ * 
+ * \pre O ponteiro \p *c deve ser diferente de \p NULL.
+ * \pre O cursor não deve estar após o último elemento.
+ * \param *c representa um ponteiro para o cursor.
+ * 
+ * \return O elemento removido.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *c seja igual a \p NULL ou
+ * 			caso o cursor esteja após o último elemento.
+ */
+int remover_no_cursor(CursorEnc* c);
+
+/** 
+ * \class IteradorEnc
+ * \brief Iterador compatível com a biblioteca padrão, que permite usar a lista em laços
+ * "for (int x : li)" e com os algoritmos de <algorithm> (std::find, std::accumulate, std::fill etc.).
+ * 
+ * É apenas um invólucro sobre o CursorEnc: cada incremento chama \p avancar.
+ * 
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<algorithm>
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include "listaenc.hpp"
+ * 
+ * using namespace std;
+ *
+ * int main() {
+ *     ListaEnc *li = criar_lista();
+ *     for (int i = 0; i < 5; i++) {
+ *         inserir(li, i, i);
+ *     }
+ *     for (int x : li) {
+ *         cout << x << " ";
+ *     }
+ *     cout << endl << *max_element(begin(li), end(li)) << endl;
+ *     liberar_lista(li);
+ *     return EXIT_SUCCESS;
+ * }  
+ * \endcode
+ * 
+ * Saída esperada:
+ * \code {.unparsed}
+ *     0 1 2 3 4
+ *     4
+ * \endcode
+ */
+class IteradorEnc {
+public:
+	typedef std::forward_iterator_tag iterator_category;
+	typedef int value_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef int* pointer;
+	typedef int& reference;
+
+	IteradorEnc() : cursor() {}
+	explicit IteradorEnc(const CursorEnc& c) : cursor(c) {}
+
+	int& operator*() { return *endereco_do_valor(&cursor); }
+	int* operator->() { return endereco_do_valor(&cursor); }
+	IteradorEnc& operator++() { avancar(&cursor); return *this; }
+	IteradorEnc operator++(int) { IteradorEnc copia = *this; avancar(&cursor); return copia; }
+	bool operator==(const IteradorEnc& outro) const { return cursor.atual == outro.cursor.atual; }
+	bool operator!=(const IteradorEnc& outro) const { return cursor.atual != outro.cursor.atual; }
+
+private:
+	CursorEnc cursor; /**< Cursor na posição corrente do iterador. */
+};
+
+/** 
+ * \brief Retorna um iterador para o primeiro elemento da lista (encontrado pelo laço "for" por ADL).
+ */
+inline IteradorEnc begin(ListaEnc* li) {
+	return IteradorEnc(iniciar_cursor(li));
+}
+
+/** 
+ * \brief Retorna um iterador para a posição após o último elemento da lista.
+ */
+inline IteradorEnc end(ListaEnc* li) {
+	CursorEnc c = {li, NULL, NULL};
+	return IteradorEnc(c);
+}
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+/**
+ * \brief Retorna os contadores de uso da lista.
+ *
+ * Disponível apenas quando a macro ESTRUTURAS_ESTATISTICAS é definida na compilação. Os contadores
+ * continuam sendo atualizados pelas operações seguintes; veja o arquivo estatisticas.hpp.
+ *
+ * \pre O ponteiro \p *li deve ser diferente de \p NULL.
+ *
+ * \param *li representa um ponteiro para a lista.
+ *
+ * \return O endereço dos contadores da lista.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *li seja igual a \p NULL.
+ */
+const Estatisticas* obter_estatisticas(ListaEnc* li);
+#endif
+
 #endif
@@ -0,0 +1,240 @@
+/**
+ * \file ordenacaonoh.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Ordenação por intercalação de cadeias de nós
+ *
+ * Disponibiliza a ordenação usada internamente por \p ordenar e \p ordenar_paralelo da ListaEnc e da
+ * ListaDEnc. As funções são modelos (templates) que servem a qualquer tipo de nó com os campos
+ * "item" e "prox" e apenas religam os ponteiros "prox": nenhum nó é alocado, copiado ou liberado.
+ * Quem as chama atualiza o restante da estrutura (por exemplo, os ponteiros "ant" da ListaDEnc).
+ *
+ * A ordenação é um merge sort de baixo para cima e estável:
+ *  - a cadeia é percorrida uma única vez e dividida nas sequências que já estão em ordem não
+ *    decrescente ou estritamente decrescente (estas são invertidas ao serem retiradas);
+ *  - as sequências são intercaladas como em um contador binário: a posição k de um vetor de 64
+ *    posições guarda uma cadeia formada por cerca de 2^k sequências, e cada nova sequência é
+ *    intercalada com as posições ocupadas, da menor para a maior, até encontrar uma vazia.
+ * Assim, o espaço extra é constante, o custo é O(n log n) e uma cadeia já ordenada ou em ordem
+ * inversa é resolvida em O(n).
+ */
+
+#ifndef ORDENACAONOH_HPP
+#define ORDENACAONOH_HPP
+
+#include <cstddef> /**< Necessário para uso do NULL. */
+#include <thread> /**< Necessário para uso da classe "std::thread". */
+#include <vector> /**< Necessário para uso da classe "std::vector". */
+
+/**
+ * \def LIMIAR_ORDENACAO_PARALELA
+ * \brief Define a quantidade mínima de nós de cada parte ordenada por uma thread em
+ * \p ordenar_cadeia_paralelo. Com menos nós, o custo de criar as threads não compensa.
+ * \hideinitializer
+ */
+#ifndef LIMIAR_ORDENACAO_PARALELA
+#define LIMIAR_ORDENACAO_PARALELA 16384
+#endif
+
+/**
+ * \struct Cadeia
+ * \brief Sequência de nós ligados pelo campo "prox", do nó \p inicio até o nó \p fim, cujo "prox" é NULL.
+ */
+template <typename N>
+struct Cadeia {
+	N* inicio; /**< Primeiro nó da cadeia (NULL, se ela estiver vazia). */
+	N* fim; /**< Último nó da cadeia (NULL, se ela estiver vazia). */
+};
+
+/**
+ * \brief Intercala duas cadeias ordenadas e retorna a cadeia resultante.
+ *
+ * Os elementos iguais de \p a vêm antes dos de \p b, o que torna a ordenação estável.
+ */
+template <typename N>
+Cadeia<N> intercalar(Cadeia<N> a, Cadeia<N> b) {
+	if (a.inicio == NULL) {
+		return b;
+	}
+	if (b.inicio == NULL) {
+		return a;
+	}
+
+	// Cadeias que não se sobrepõem são apenas ligadas, sem percorrê-las.
+	if (a.fim->item <= b.inicio->item) {
+		a.fim->prox = b.inicio;
+		Cadeia<N> c = {a.inicio, b.fim};
+		return c;
+	}
+	if (b.fim->item < a.inicio->item) {
+		b.fim->prox = a.inicio;
+		Cadeia<N> c = {b.inicio, a.fim};
+		return c;
+	}
+
+	/*
+	 * "ligacao" aponta para o ponteiro que deve receber o próximo nó da cadeia resultante. Depois
+	 * das primeiras intercalações, nós vizinhos na cadeia ficam distantes na memória: por isso, o
+	 * sucessor de cada uma das duas cadeias é pedido à cache antes de ser necessário, para que as
+	 * duas buscas à memória aconteçam ao mesmo tempo.
+	 */
+	Cadeia<N> c;
+	N** ligacao = &c.inicio;
+	N* x = a.inicio;
+	N* y = b.inicio;
+	while (true) {
+#if defined(__GNUC__)
+		__builtin_prefetch(x->prox);
+		__builtin_prefetch(y->prox);
+#endif
+		if (y->item < x->item) {
+			*ligacao = y;
+			ligacao = &y->prox;
+			y = y->prox;
+			if (y == NULL) {
+				*ligacao = x;
+				c.fim = a.fim;
+				return c;
+			}
+		} else {
+			*ligacao = x;
+			ligacao = &x->prox;
+			x = x->prox;
+			if (x == NULL) {
+				*ligacao = y;
+				c.fim = b.fim;
+				return c;
+			}
+		}
+	}
+}
+
+/**
+ * \brief Retira do início da cadeia que começa em \p inicio a maior sequência em ordem não
+ * decrescente ou estritamente decrescente (que é invertida) e retorna o primeiro nó que sobrou.
+ *
+ * Apenas as sequências estritamente decrescentes são invertidas, para que elementos iguais não
+ * troquem de ordem.
+ */
+template <typename N>
+N* retirar_sequencia(N* inicio, Cadeia<N>* sequencia) {
+	N* aux = inicio->prox;
+	if ((aux != NULL) and (aux->item < inicio->item)) {
+		// Cada nó da sequência decrescente passa para a frente dos já retirados.
+		N* invertida = inicio;
+		inicio->prox = NULL;
+		while ((aux != NULL) and (aux->item < invertida->item)) {
+			N* prox = aux->prox;
+			aux->prox = invertida;
+			invertida = aux;
+			aux = prox;
+		}
+		sequencia->inicio = invertida;
+		sequencia->fim = inicio;
+		return aux;
+	}
+
+	N* ultimo = inicio;
+	while ((ultimo->prox != NULL) and (ultimo->prox->item >= ultimo->item)) {
+		ultimo = ultimo->prox;
+	}
+	N* resto = ultimo->prox;
+	ultimo->prox = NULL;
+	sequencia->inicio = inicio;
+	sequencia->fim = ultimo;
+	return resto;
+}
+
+/**
+ * \brief Ordena a cadeia \p c em ordem não decrescente e retorna a cadeia ordenada.
+ */
+template <typename N>
+Cadeia<N> ordenar_cadeia(Cadeia<N> c) {
+	// A posição k guarda o resultado de intercalar cerca de 2^k sequências (ou está vazia).
+	Cadeia<N> niveis[64];
+	int qtd_niveis = 0;
+
+	N* resto = c.inicio;
+	while (resto != NULL) {
+		Cadeia<N> sequencia;
+		resto = retirar_sequencia(resto, &sequencia);
+
+		// As cadeias dos níveis têm elementos anteriores aos da sequência e, por isso, vêm primeiro.
+		int k = 0;
+		while ((k < qtd_niveis) and (niveis[k].inicio != NULL)) {
+			sequencia = intercalar(niveis[k], sequencia);
+			niveis[k].inicio = NULL;
+			k++;
+		}
+		if (k == qtd_niveis) {
+			qtd_niveis++;
+		}
+		niveis[k] = sequencia;
+	}
+
+	// Os níveis mais altos têm os elementos mais antigos da cadeia original.
+	Cadeia<N> ordenada = {NULL, NULL};
+	for (int k = 0; k < qtd_niveis; k++) {
+		if (niveis[k].inicio != NULL) {
+			ordenada = intercalar(niveis[k], ordenada);
+		}
+	}
+	return ordenada;
+}
+
+/**
+ * \brief Ordena a cadeia \p c, com \p n nós, usando até \p qtd_threads threads.
+ *
+ * A cadeia é dividida em partes com o mesmo número de nós, que são ordenadas ao mesmo tempo por
+ * \p ordenar_cadeia, uma em cada thread. Em seguida, as partes são intercaladas duas a duas, também
+ * ao mesmo tempo, até restar uma só. A divisão e a última intercalação percorrem todos os nós em
+ * uma única thread.
+ */
+template <typename N>
+Cadeia<N> ordenar_cadeia_paralelo(Cadeia<N> c, int n, int qtd_threads) {
+	if (qtd_threads > n / LIMIAR_ORDENACAO_PARALELA) {
+		qtd_threads = n / LIMIAR_ORDENACAO_PARALELA;
+	}
+	if (qtd_threads <= 1) {
+		return ordenar_cadeia(c);
+	}
+
+	// Divide a cadeia em "qtd_threads" partes, cada uma terminada por NULL.
+	std::vector<Cadeia<N>> partes(qtd_threads);
+	N* aux = c.inicio;
+	for (int t = 0; t < qtd_threads; t++) {
+		int tam = (t < qtd_threads - 1) ? n / qtd_threads : n - (qtd_threads - 1) * (n / qtd_threads);
+		partes[t].inicio = aux;
+		for (int i = 1; i < tam; i++) {
+			aux = aux->prox;
+		}
+		partes[t].fim = aux;
+		aux = aux->prox;
+		partes[t].fim->prox = NULL;
+	}
+
+	// A thread que chamou a função ordena a primeira parte.
+	std::vector<std::thread> threads;
+	for (int t = 1; t < qtd_threads; t++) {
+		threads.emplace_back([&partes, t]() { partes[t] = ordenar_cadeia(partes[t]); });
+	}
+	partes[0] = ordenar_cadeia(partes[0]);
+	for (std::thread& th : threads) {
+		th.join();
+	}
+
+	// A cada rodada, a parte t recebe a intercalação dela com a parte t + passo.
+	for (int passo = 1; passo < qtd_threads; passo *= 2) {
+		threads.clear();
+		for (int t = 2 * passo; t + passo < qtd_threads; t += 2 * passo) {
+			threads.emplace_back([&partes, t, passo]() { partes[t] = intercalar(partes[t], partes[t + passo]); });
+		}
+		partes[0] = intercalar(partes[0], partes[passo]);
+		for (std::thread& th : threads) {
+			th.join();
+		}
+	}
+	return partes[0];
+}
+
+#endif
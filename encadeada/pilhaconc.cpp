@@ -0,0 +1,183 @@
+#include <assert.h> /**< Necessário para uso da macro "assert". */
+#include <atomic> /**< Necessário para uso de std::atomic. */
+#include <cstdlib> /**< Necessário para uso do NULL. */
+#include <stdint.h> /**< Necessário para uso de uint64_t e uint32_t. */
+#include "../comum/cache.hpp"
+#include "pilhaconc.hpp"
+#include "riscos.hpp"
+
+using namespace std;
+
+/* Quantidade de iterações que uma oferta fica disponível no vetor de eliminação. */
+#define ESPERA_ELIMINACAO 128
+
+struct NohPConc {
+	int item; /**< Representa a informação a ser armazenada em cada nó da pilha. */
+	NohPConc* prox; /**< É um ponteiro para o próximo nó da pilha. */
+};
+
+/*
+ * Posição do vetor de eliminação, codificada em 64 bits:
+ *  - bits 0 a 31: item oferecido;
+ *  - bit 32: indica se há uma oferta na posição;
+ *  - bits 33 a 63: versão, incrementada a cada mudança.
+ * A versão impede que uma thread confunda a sua oferta com outra oferta idêntica feita depois.
+ */
+struct PosicaoEliminacao {
+	alignas(TAM_LINHA_CACHE) atomic<uint64_t> valor;
+};
+
+#define BIT_OFERTA ((uint64_t) 1 << 32)
+#define UMA_VERSAO ((uint64_t) 1 << 33)
+
+struct PilhaConc {
+	alignas(TAM_LINHA_CACHE) atomic<NohPConc*> topo; /**< É um ponteiro para o topo da pilha. */
+	PosicaoEliminacao* eliminacao; /**< Vetor de eliminação (NULL, se desativado). */
+	int tam_eliminacao; /**< Quantidade de posições do vetor de eliminação. */
+};
+
+static void liberar_noh(void* noh) {
+	delete static_cast<NohPConc*>(noh);
+}
+
+/* Gerador pseudoaleatório (xorshift) de cada thread, usado para escolher a posição de eliminação. */
+static int posicao_aleatoria(int n) {
+	static thread_local uint32_t estado = 0;
+	if (estado == 0) {
+		estado = (uint32_t) (uintptr_t) &estado | 1;
+	}
+	estado ^= estado << 13;
+	estado ^= estado >> 17;
+	estado ^= estado << 5;
+	return (int) (estado % (uint32_t) n);
+}
+
+PilhaConc* criar_pilha_conc(int tam_eliminacao) {
+	assert(tam_eliminacao >= 0);
+
+	/*
+	 * Caso não seja possível alocar o espaço solicitado, o próprio operador "new"
+	 * irá lançar uma exceção abortando a execução do programa.
+	 */
+	PilhaConc* pilha = new PilhaConc;
+
+	pilha->topo.store(NULL, memory_order_relaxed);
+	pilha->tam_eliminacao = tam_eliminacao;
+	pilha->eliminacao = NULL;
+	if (tam_eliminacao > 0) {
+		pilha->eliminacao = new PosicaoEliminacao[tam_eliminacao];
+		for (int i = 0; i < tam_eliminacao; i++) {
+			pilha->eliminacao[i].valor.store(0, memory_order_relaxed);
+		}
+	}
+	return pilha;
+}
+
+void liberar_pilha(PilhaConc* pilha) {
+	/*
+	 * Macro da biblioteca \file assert.h. Aborta a execução do programa e envia uma mensagem
+	 * de erro para a saída de erro padrão, caso a expressão entre parênteses seja avaliada
+	 * como false.
+	 */
+	assert(pilha != NULL);
+
+	// Nenhuma outra thread usa a pilha: os nós podem ser liberados diretamente.
+	NohPConc* aux = pilha->topo.load(memory_order_acquire);
+	while (aux != NULL) {
+		NohPConc* prox = aux->prox;
+		delete aux;
+		aux = prox;
+	}
+	delete[] pilha->eliminacao;
+	delete pilha;
+}
+
+/*
+ * Oferece "item" em uma posição do vetor de eliminação e aguarda que uma thread o recolha.
+ * Retorna true se o item foi recolhido (e, portanto, o empilhamento está concluído).
+ */
+static bool oferecer(PilhaConc* pilha, int item) {
+	PosicaoEliminacao* pos = &pilha->eliminacao[posicao_aleatoria(pilha->tam_eliminacao)];
+	uint64_t atual = pos->valor.load(memory_order_relaxed);
+	if (atual & BIT_OFERTA) {
+		return false;
+	}
+	uint64_t oferta = (atual & ~(BIT_OFERTA - 1)) + UMA_VERSAO + BIT_OFERTA + (uint32_t) item;
+	if (!pos->valor.compare_exchange_strong(atual, oferta, memory_order_release, memory_order_relaxed)) {
+		return false;
+	}
+	for (int i = 0; i < ESPERA_ELIMINACAO; i++) {
+		if (pos->valor.load(memory_order_acquire) != oferta) {
+			return true;
+		}
+	}
+	/* Ninguém recolheu: retira a oferta. Se a retirada falhar, é porque alguém a recolheu agora. */
+	uint64_t retirada = (oferta & ~(BIT_OFERTA - 1)) - BIT_OFERTA + UMA_VERSAO;
+	return !pos->valor.compare_exchange_strong(oferta, retirada, memory_order_acq_rel, memory_order_acquire);
+}
+
+/* Tenta recolher uma oferta do vetor de eliminação. Retorna true e preenche "item" em caso de sucesso. */
+static bool recolher(PilhaConc* pilha, int* item) {
+	PosicaoEliminacao* pos = &pilha->eliminacao[posicao_aleatoria(pilha->tam_eliminacao)];
+	uint64_t atual = pos->valor.load(memory_order_acquire);
+	if (!(atual & BIT_OFERTA)) {
+		return false;
+	}
+	uint64_t vazia = (atual & ~(BIT_OFERTA - 1)) - BIT_OFERTA + UMA_VERSAO;
+	if (pos->valor.compare_exchange_strong(atual, vazia, memory_order_acq_rel, memory_order_relaxed)) {
+		*item = (int) (uint32_t) atual;
+		return true;
+	}
+	return false;
+}
+
+void empilhar(PilhaConc* pilha, int item) {
+	assert(pilha != NULL);
+
+	NohPConc* novo_noh = new NohPConc;
+	novo_noh->item = item;
+	novo_noh->prox = pilha->topo.load(memory_order_relaxed);
+
+	/* O novo nó ainda não é visível para outras threads; por isso, não precisa de ponteiro de risco. */
+	while (!pilha->topo.compare_exchange_weak(novo_noh->prox, novo_noh, memory_order_release, memory_order_relaxed)) {
+		if ((pilha->eliminacao != NULL) && oferecer(pilha, item)) {
+			delete novo_noh;
+			return;
+		}
+	}
+}
+
+bool desempilhar(PilhaConc* pilha, int* item) {
+	assert(pilha != NULL);
+	assert(item != NULL);
+
+	while (true) {
+		NohPConc* topo = pilha->topo.load(memory_order_acquire);
+		if (topo == NULL) {
+			liberar_riscos();
+			return false;
+		}
+		/* Confirma que o topo publicado ainda está na pilha antes de ler o seu campo "prox". */
+		proteger(0, topo);
+		if (topo != pilha->topo.load(memory_order_acquire)) {
+			continue;
+		}
+		NohPConc* prox = topo->prox;
+		if (pilha->topo.compare_exchange_strong(topo, prox, memory_order_acq_rel, memory_order_relaxed)) {
+			*item = topo->item;
+			liberar_riscos();
+			aposentar(topo, liberar_noh);
+			return true;
+		}
+		if ((pilha->eliminacao != NULL) && recolher(pilha, item)) {
+			liberar_riscos();
+			return true;
+		}
+	}
+}
+
+bool estah_vazia(PilhaConc* pilha) {
+	assert(pilha != NULL);
+
+	return (pilha->topo.load(memory_order_acquire) == NULL);
+}
@@ -0,0 +1,122 @@
+/**
+ * \file pilhaconc.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Interface do TAD PilhaConc
+ *
+ * Disponibiliza as funções necessárias para manipulação de uma Pilha encadeada concorrente, que
+ * pode ser usada por várias threads ao mesmo tempo sem nenhuma trava.
+ *
+ * A implementação segue o algoritmo de Treiber: assim como na PilhaEnc, a pilha mantém apenas um
+ * ponteiro para o topo, que é atualizado com operações atômicas de comparação e troca
+ * (compare-and-swap). Os nós desempilhados são aposentados por meio do módulo de ponteiros de
+ * risco (\file riscos.hpp). Como um nó publicado como ponteiro de risco nunca é liberado nem
+ * reutilizado, o problema ABA (o topo voltar a ter o mesmo endereço entre a leitura e a troca)
+ * não pode ocorrer.
+ *
+ * Opcionalmente, a pilha possui um vetor de eliminação: quando uma troca no topo falha por causa
+ * da disputa entre threads, a thread que empilha oferece o seu item em uma posição aleatória do
+ * vetor, e uma thread que desempilha pode recolhê-lo ali. Os dois pares de operações se anulam
+ * sem tocar no topo, o que reduz a disputa quando há muitas threads.
+ */
+
+#ifndef PILHACONC_HPP
+#define PILHACONC_HPP
+
+/**
+ * \struct PilhaConc
+ * \brief Declaração opaca da estrutura de uma pilha.
+ *
+ * Isso significa que os detalhes de implementação desta estrutura estão escondidos do usuário do TAD.
+ * A definição da estrutura PilhaConc encontra-se no arquivo \file pilhaconc.cpp.
+ */
+struct PilhaConc;
+
+/**
+ * \brief Cria dinamicamente uma pilha vazia e retorna o endereço onde ela se encontra alocada.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include "pilhaconc.hpp"
+
+ * int main() {
+ *     PilhaConc *p = criar_pilha_conc(0);   // sem vetor de eliminação
+ *     PilhaConc *q = criar_pilha_conc(16);  // com 16 posições de eliminação
+ *     liberar_pilha(p);
+ *     liberar_pilha(q);
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * \pre \p tam_eliminacao deve ser maior ou igual a zero.
+ *
+ * \param tam_eliminacao representa a quantidade de posições do vetor de eliminação
+ *        (zero desativa a eliminação).
+ *
+ * \return O endereço de memória da pilha alocada dinamicamente.
+ */
+PilhaConc* criar_pilha_conc(int tam_eliminacao);
+
+/**
+ * \brief Libera o espaço de memória anteriormente reservado para a pilha e para os seus elementos.
+ *
+ * \pre O ponteiro \p *p deve ser diferente de \p NULL.
+ * \pre Nenhuma outra thread pode estar utilizando a pilha.
+ *
+ * \param *p representa um ponteiro para a pilha a ser liberada da memória.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *p seja igual a \p NULL.
+ */
+void liberar_pilha(PilhaConc* p);
+
+/**
+ * \brief Insere um elemento no topo da pilha. Pode ser chamada por várias threads ao mesmo tempo.
+ *
+ * \pre O ponteiro \p *p deve ser diferente de \p NULL.
+ *
+ * \param *p representa um ponteiro para a pilha.
+ * \param item representa o item a ser empilhado.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *p seja igual a \p NULL.
+ */
+void empilhar(PilhaConc* p, int item);
+
+/**
+ * \brief Tenta remover o elemento do topo da pilha. Pode ser chamada por várias threads ao mesmo tempo.
+ *
+ * Diferentemente da PilhaEnc, desempilhar de uma pilha vazia não aborta o programa: a função
+ * retorna \p false, pois outra thread pode ter esvaziado a pilha depois de qualquer verificação.
+ *
+ * \pre Os ponteiros \p *p e \p *item devem ser diferentes de \p NULL.
+ *
+ * \param *p representa um ponteiro para a pilha.
+ * \param *item representa o endereço onde o elemento desempilhado será armazenado.
+ *
+ * \return \p true, se um elemento foi desempilhado e \p false, caso a pilha estivesse vazia.
+ *
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL.
+ */
+bool desempilhar(PilhaConc* p, int* item);
+
+/**
+ * \brief Verifica se a pilha está vazia.
+ *
+ * Quando outras threads estão usando a pilha, o resultado reflete um instante recente e pode
+ * estar desatualizado quando for usado.
+ *
+ * \pre O ponteiro \p *p deve ser diferente de \p NULL.
+ *
+ * \param *p representa um ponteiro para a pilha cuja situação será consultada.
+ *
+ * \return \p true, se a pilha estiver vazia e \p false, caso contrário.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *p seja igual a \p NULL.
+ */
+bool estah_vazia(PilhaConc* p);
+
+#endif
@@ -1,6 +1,7 @@
 #include <assert.h> /**< Necessário para uso da macro "assert". */
 #include <cstdlib> /**< Necessário para uso do NULL. */
 #include "pilhaenc.hpp"
+#include "poolnoh.hpp"
 
 struct Noh {
 	int item; /**< Representa a informação a ser armazenada em cada nó da pilha. */
@@ -9,6 +10,10 @@ struct Noh {
 
 struct PilhaEnc {
     Noh* topo; /**< É um ponteiro para o todo da pilha. */
+    PoolNoh* pool; /**< Pool de onde são alocados os nós da pilha. */
+#ifdef ESTRUTURAS_ESTATISTICAS
+	Estatisticas estat; /**< Contadores de uso (veja estatisticas.hpp). */
+#endif
 };
 
 PilhaEnc* criar_pilha() {
@@ -19,6 +24,8 @@ PilhaEnc* criar_pilha() {
 	PilhaEnc* pilha = new PilhaEnc;    
     
     pilha->topo = NULL;
+    pilha->pool = criar_pool(sizeof(Noh), NOHS_POR_BLOCO);
+    ESTATISTICA(zerar_estatisticas(&pilha->estat));
     return pilha;
 }
 
@@ -30,10 +37,8 @@ void liberar_pilha(PilhaEnc* pilha) {
 	 */
 	assert(pilha != NULL);
 	
-	// Libera a memória alocada para cada nó da pilha individualmente.
-	while(pilha->topo != NULL) {
-		desempilhar(pilha);
-	}	
+	// Todos os nós da pilha estão nos blocos do pool, que são liberados de uma só vez.
+	liberar_pool(pilha->pool);
 	delete pilha;
 }
 
@@ -46,11 +51,13 @@ bool estah_vazia(PilhaEnc* pilha) {
 void empilhar(PilhaEnc* pilha, int item) {
     assert(pilha != NULL);
 	
-	Noh* novo_noh = new Noh;
+	Noh* novo_noh = static_cast<Noh*>(alocar_noh(pilha->pool));
 	novo_noh->item = item;
 	novo_noh->prox = pilha->topo;
 	 
 	pilha->topo = novo_noh;
+	ESTATISTICA(contar_alocacoes(&pilha->estat, 1));
+	ESTATISTICA(contar_insercoes(&pilha->estat, 1));
 }
 
 int desempilhar(PilhaEnc* pilha) {
@@ -60,7 +67,8 @@ int desempilhar(PilhaEnc* pilha) {
     int item = pilha->topo->item;    
     Noh* aux = pilha->topo;
     pilha->topo = pilha->topo->prox;
-    delete aux;
+    devolver_noh(pilha->pool, aux);
+    ESTATISTICA(contar_remocoes(&pilha->estat, 1));
     
     return item;    
 }
@@ -69,6 +77,49 @@ int obter_topo(PilhaEnc* pilha) {
     assert(pilha != NULL);
 	assert(pilha->topo != NULL);    
     
+    ESTATISTICA(contar_consulta(&pilha->estat));
     return pilha->topo->item;
 }
 
+void empilhar_varios(PilhaEnc* pilha, const int* itens, int n) {
+	assert((pilha != NULL) and (itens != NULL));
+	assert(n >= 0);
+	
+	// Monta a cadeia de nós, com itens[n - 1] na frente, e a liga à pilha de uma só vez.
+	Noh* topo = pilha->topo;
+	for (int i = 0; i < n; i++) {
+		Noh* novo_noh = static_cast<Noh*>(alocar_noh(pilha->pool));
+		novo_noh->item = itens[i];
+		novo_noh->prox = topo;
+		topo = novo_noh;
+	}
+	pilha->topo = topo;
+	ESTATISTICA(contar_alocacoes(&pilha->estat, n));
+	ESTATISTICA(contar_insercoes(&pilha->estat, n));
+}
+
+void desempilhar_varios(PilhaEnc* pilha, int* saida, int n) {
+	assert((pilha != NULL) and (saida != NULL));
+	assert(n >= 0);
+	
+	// O topo vai para saida[n - 1], de modo que empilhar_varios(p, saida, n) desfaz a operação.
+	Noh* topo = pilha->topo;
+	for (int i = n - 1; i >= 0; i--) {
+		assert(topo != NULL);
+		
+		Noh* aux = topo;
+		topo = aux->prox;
+		saida[i] = aux->item;
+		devolver_noh(pilha->pool, aux);
+	}
+	pilha->topo = topo;
+	ESTATISTICA(contar_remocoes(&pilha->estat, n));
+}
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+const Estatisticas* obter_estatisticas(PilhaEnc* pilha) {
+	assert(pilha != NULL);
+
+	return &pilha->estat;
+}
+#endif
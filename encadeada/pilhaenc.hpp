@@ -10,6 +10,8 @@
 #ifndef PILHAENC_HPP
 #define PILHAENC_HPP
 
+#include "../comum/estatisticas.hpp"
+
 /** 
  * \struct PilhaEnc
  * \brief Declaração opaca da estrutura de uma pilha.
@@ -49,6 +51,9 @@ PilhaEnc* criar_pilha();
 /** 
  * \brief Libera o espaço de memória anteriormente reservado para a pilha.
  *  
+ * Os nós da pilha são alocados em blocos por um pool (veja \file poolnoh.hpp). Por isso, a liberação
+ * é feita bloco a bloco, sem percorrer os elementos da pilha.
+ *
  * Exemplo de uso:
  * \code {.cpp}
  * #include<cstdlib>
@@ -234,4 +239,85 @@ int desempilhar(PilhaEnc* p);
  */
 int obter_topo(PilhaEnc* p);
 
+/** 
+ * \brief Empilha, de uma só vez, os \p n elementos do vetor \p itens.
+ * 
+ * O resultado é o mesmo de chamar empilhar(p, itens[i]) para i = 0, 1, ..., n - 1 (ou seja,
+ * itens[n - 1] fica no topo), mas a cadeia de nós é montada à parte e ligada à pilha de uma só vez.
+ * 
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include "pilhaenc.hpp"
+ * 
+ * using namespace std;
+ *
+ * int main() {
+ *     PilhaEnc *p = criar_pilha();
+ *     int v[] = {1, 2, 3, 4};
+ *     empilhar_varios(p, v, 4);
+ *     int topo[2];
+ *     desempilhar_varios(p, topo, 2);
+ *     cout << topo[0] << " " << topo[1] << " " << obter_topo(p) << endl;
+ *     liberar_pilha(p);
+ *     return EXIT_SUCCESS;
+ * }  
+ * \endcode
+ * 
+ * Saída esperada:
+ * \code {.unparsed}
+ *     3 4 2
+ * \endcode
+ * 
+ * \pre Os ponteiros \p *p e \p *itens devem ser diferentes de \p NULL.
+ * 
+ * \param *p representa um ponteiro para a pilha.
+ * \param *itens representa o vetor com os elementos a serem empilhados.
+ * \param n representa a quantidade de elementos a serem empilhados.
+ * 
+ * \return void
+ * 
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL.
+ */
+void empilhar_varios(PilhaEnc* p, const int* itens, int n);
+
+/** 
+ * \brief Desempilha, de uma só vez, os \p n elementos do topo da pilha.
+ * 
+ * Os elementos são armazenados em \p saida na ordem em que estavam na pilha, de baixo para cima:
+ * saida[n - 1] é o antigo topo. Assim, empilhar_varios(p, saida, n) desfaz a operação.
+ * 
+ * \pre Os ponteiros \p *p e \p *saida devem ser diferentes de \p NULL.
+ * \pre A pilha deve ter pelo menos \p n elementos.
+ * 
+ * \param *p representa um ponteiro para a pilha.
+ * \param *saida representa o vetor, com pelo menos \p n posições, que receberá os elementos.
+ * \param n representa a quantidade de elementos a serem desempilhados.
+ * 
+ * \return void
+ * 
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL ou
+ * 			caso a pilha tenha menos do que \p n elementos.
+ */
+void desempilhar_varios(PilhaEnc* p, int* saida, int n);
+
+#ifdef ESTRUTURAS_ESTATISTICAS
+/**
+ * \brief Retorna os contadores de uso da pilha.
+ *
+ * Disponível apenas quando a macro ESTRUTURAS_ESTATISTICAS é definida na compilação. Os contadores
+ * continuam sendo atualizados pelas operações seguintes; veja o arquivo estatisticas.hpp.
+ *
+ * \pre O ponteiro \p *p deve ser diferente de \p NULL.
+ *
+ * \param *p representa um ponteiro para a pilha.
+ *
+ * \return O endereço dos contadores da pilha.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *p seja igual a \p NULL.
+ */
+const Estatisticas* obter_estatisticas(PilhaEnc* p);
+#endif
+
 #endif
@@ -0,0 +1,215 @@
+#include <assert.h> /**< Necessário para uso da macro "assert". */
+#include <cstdlib> /**< Necessário para uso do NULL. */
+#include "poolnoh.hpp"
+
+/*
+ * Cabeçalho de cada bloco alocado pelo pool. Os nós ficam logo após o cabeçalho, na mesma
+ * região de memória. A união com "double" e "void*" garante que o primeiro nó comece em um
+ * endereço adequadamente alinhado.
+ */
+union Bloco {
+	struct {
+		Bloco* prox; /**< Ponteiro para o bloco alocado anteriormente. */
+		int qtd_nohs; /**< Quantidade de nós que cabem neste bloco. */
+	} info;
+	double alinhamento_d;
+	void* alinhamento_p;
+};
+
+/* Nó livre: enquanto está na lista de livres, o início do nó guarda o endereço do próximo nó livre. */
+struct NohLivre {
+	NohLivre* prox; /**< Ponteiro para o próximo nó livre. */
+};
+
+struct PoolNoh {
+	Bloco* blocos; /**< Ponteiro para o bloco mais recente (os blocos formam uma lista encadeada). */
+	Bloco* primeiro_bloco; /**< Ponteiro para o bloco mais antigo, o último da lista de blocos. */
+	NohLivre* livres; /**< Ponteiro para o primeiro nó da lista de nós devolvidos. */
+	NohLivre* ultimo_livre; /**< Ponteiro para o último nó da lista de nós devolvidos (válido se "livres" não for NULL). */
+	char* proximo; /**< Próximo nó ainda não utilizado do bloco mais recente. */
+	char* limite; /**< Endereço logo após o último nó do bloco mais recente. */
+	int tam_noh; /**< Tamanho de cada nó, arredondado para múltiplo do tamanho de um ponteiro. */
+	int nohs_por_bloco; /**< Quantidade de nós do próximo bloco a ser alocado. */
+	int qtd_blocos; /**< Quantidade de blocos alocados desde a criação do pool. */
+	int qtd_usuarios; /**< Quantidade de estruturas que usam o pool (veja compartilhar_pool). */
+};
+
+PoolNoh* criar_pool(int tam_noh, int nohs_por_bloco) {
+	assert(tam_noh > 0);
+	assert(nohs_por_bloco > 0);
+
+	/*
+	 * Caso não seja possível alocar o espaço solicitado, o próprio operador "new"
+	 * irá lançar uma exceção abortando a execução do programa.
+	 */
+	PoolNoh* pool = new PoolNoh;
+
+	/* Todo nó precisa comportar o ponteiro da lista de livres e manter o alinhamento do seguinte. */
+	int tam_ptr = sizeof(void*);
+	if (tam_noh < tam_ptr) {
+		tam_noh = tam_ptr;
+	}
+	pool->tam_noh = ((tam_noh + tam_ptr - 1) / tam_ptr) * tam_ptr;
+
+	pool->blocos = NULL;
+	pool->primeiro_bloco = NULL;
+	pool->livres = NULL;
+	pool->ultimo_livre = NULL;
+	pool->proximo = NULL;
+	pool->limite = NULL;
+	pool->nohs_por_bloco = nohs_por_bloco;
+	pool->qtd_blocos = 0;
+	pool->qtd_usuarios = 1;
+	return pool;
+}
+
+void liberar_pool(PoolNoh* pool) {
+	/*
+	 * Macro da biblioteca \file assert.h. Aborta a execução do programa e envia uma mensagem
+	 * de erro para a saída de erro padrão, caso a expressão entre parênteses seja avaliada
+	 * como false.
+	 */
+	assert(pool != NULL);
+
+	// Enquanto outra estrutura usar o pool, os seus nós continuam válidos.
+	if (--pool->qtd_usuarios > 0) {
+		return;
+	}
+
+	// Libera bloco a bloco: os nós contidos em cada bloco são liberados juntos.
+	while (pool->blocos != NULL) {
+		Bloco* aux = pool->blocos;
+		pool->blocos = aux->info.prox;
+		delete[] reinterpret_cast<char*>(aux);
+	}
+	delete pool;
+}
+
+/*
+ * Aloca um novo bloco e o torna o bloco corrente do pool. O tamanho dos blocos cresce
+ * geometricamente, de modo que a quantidade de blocos é logarítmica no número de nós
+ * (até o limite NOHS_POR_BLOCO_MAX).
+ */
+static void alocar_bloco(PoolNoh* pool) {
+	int qtd_nohs = pool->nohs_por_bloco;
+	char* memoria = new char[sizeof(Bloco) + (size_t) qtd_nohs * pool->tam_noh];
+
+	Bloco* bloco = reinterpret_cast<Bloco*>(memoria);
+	bloco->info.prox = pool->blocos;
+	bloco->info.qtd_nohs = qtd_nohs;
+	if (pool->blocos == NULL) {
+		pool->primeiro_bloco = bloco;
+	}
+	pool->blocos = bloco;
+	pool->qtd_blocos++;
+
+	pool->proximo = memoria + sizeof(Bloco);
+	pool->limite = pool->proximo + (size_t) qtd_nohs * pool->tam_noh;
+
+	if (pool->nohs_por_bloco <= NOHS_POR_BLOCO_MAX / 2) {
+		pool->nohs_por_bloco *= 2;
+	}
+}
+
+void* alocar_noh(PoolNoh* pool) {
+	assert(pool != NULL);
+
+	// Dá preferência aos nós devolvidos, que provavelmente ainda estão na cache.
+	if (pool->livres != NULL) {
+		NohLivre* noh = pool->livres;
+		pool->livres = noh->prox;
+		return noh;
+	}
+
+	if (pool->proximo == pool->limite) {
+		alocar_bloco(pool);
+	}
+	void* noh = pool->proximo;
+	pool->proximo += pool->tam_noh;
+	return noh;
+}
+
+void devolver_noh(PoolNoh* pool, void* noh) {
+	assert(pool != NULL);
+	assert(noh != NULL);
+
+	NohLivre* livre = static_cast<NohLivre*>(noh);
+	if (pool->livres == NULL) {
+		pool->ultimo_livre = livre;
+	}
+	livre->prox = pool->livres;
+	pool->livres = livre;
+}
+
+PoolNoh* compartilhar_pool(PoolNoh* pool) {
+	assert(pool != NULL);
+
+	pool->qtd_usuarios++;
+	return pool;
+}
+
+bool pool_exclusivo(PoolNoh* pool) {
+	assert(pool != NULL);
+
+	return (pool->qtd_usuarios == 1);
+}
+
+void juntar_pools(PoolNoh* destino, PoolNoh* origem) {
+	assert((destino != NULL) && (origem != NULL) && (destino != origem));
+	assert(pool_exclusivo(origem));
+	assert(destino->tam_noh == origem->tam_noh);
+
+	// Os blocos da origem são ligados antes dos blocos do destino, graças ao ponteiro para o mais antigo.
+	if (origem->blocos != NULL) {
+		origem->primeiro_bloco->info.prox = destino->blocos;
+		if (destino->blocos == NULL) {
+			destino->primeiro_bloco = origem->primeiro_bloco;
+		}
+		destino->blocos = origem->blocos;
+	}
+
+	// O mesmo vale para os nós livres.
+	if (origem->livres != NULL) {
+		origem->ultimo_livre->prox = destino->livres;
+		if (destino->livres == NULL) {
+			destino->ultimo_livre = origem->ultimo_livre;
+		}
+		destino->livres = origem->livres;
+	}
+
+	// Só um bloco pode continuar sendo usado em sequência: o destino fica com o que tiver mais nós sobrando.
+	if (origem->limite - origem->proximo > destino->limite - destino->proximo) {
+		destino->proximo = origem->proximo;
+		destino->limite = origem->limite;
+	}
+
+	destino->qtd_blocos += origem->qtd_blocos;
+	if (origem->nohs_por_bloco > destino->nohs_por_bloco) {
+		destino->nohs_por_bloco = origem->nohs_por_bloco;
+	}
+	delete origem;
+}
+
+bool unificar_pools(PoolNoh** a, PoolNoh** b) {
+	assert((a != NULL) && (b != NULL) && (*a != NULL) && (*b != NULL));
+
+	if (*a == *b) {
+		return true;
+	}
+	if (pool_exclusivo(*b)) {
+		juntar_pools(*a, *b);
+		*b = compartilhar_pool(*a);
+	} else if (pool_exclusivo(*a)) {
+		juntar_pools(*b, *a);
+		*a = compartilhar_pool(*b);
+	} else {
+		return false;
+	}
+	return true;
+}
+
+int obter_qtd_blocos(PoolNoh* pool) {
+	assert(pool != NULL);
+
+	return pool->qtd_blocos;
+}
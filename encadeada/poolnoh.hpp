@@ -0,0 +1,222 @@
+/**
+ * \file poolnoh.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Interface do TAD PoolNoh
+ *
+ * Disponibiliza um alocador de nós de tamanho fixo (pool), usado internamente pelas estruturas
+ * encadeadas (FilaEnc, PilhaEnc, ListaEnc e ListaDEnc).
+ *
+ * Em vez de chamar os operadores "new" e "delete" a cada nó inserido ou removido, cada estrutura
+ * possui o seu próprio pool. O pool reserva memória em blocos (slabs) capazes de armazenar vários
+ * nós de uma só vez e mantém uma lista de nós livres, formada pelos nós devolvidos. Assim:
+ *  - a maior parte das inserções e remoções não faz nenhuma chamada ao alocador do sistema;
+ *  - nós consecutivos ficam próximos na memória, o que favorece o uso da cache; e
+ *  - a liberação da estrutura inteira é feita bloco a bloco, sem percorrer os nós.
+ *
+ * Para que as operações que religam nós entre duas estruturas (concatenar, dividir e transferir)
+ * não precisem copiar os elementos, as estruturas envolvidas passam a usar um único pool: os pools
+ * podem ser juntados (\p juntar_pools) e compartilhados (\p compartilhar_pool), e um pool
+ * compartilhado só é liberado quando a última estrutura que o usa o libera.
+ */
+
+#ifndef POOLNOH_HPP
+#define POOLNOH_HPP
+
+/**
+ * \def NOHS_POR_BLOCO
+ * \brief Define a quantidade de nós do primeiro bloco alocado pelo pool.
+ *
+ * Cada novo bloco tem o dobro de nós do bloco anterior, até o limite NOHS_POR_BLOCO_MAX.
+ * O valor pode ser alterado na compilação (por exemplo, -DNOHS_POR_BLOCO=256).
+ * \hideinitializer
+ */
+#ifndef NOHS_POR_BLOCO
+#define NOHS_POR_BLOCO 32
+#endif
+
+/**
+ * \def NOHS_POR_BLOCO_MAX
+ * \brief Define a quantidade máxima de nós de um bloco do pool.
+ * \hideinitializer
+ */
+#ifndef NOHS_POR_BLOCO_MAX
+#define NOHS_POR_BLOCO_MAX 65536
+#endif
+
+/**
+ * \struct PoolNoh
+ * \brief Declaração opaca da estrutura do pool.
+ *
+ * Isso significa que os detalhes de implementação desta estrutura estão escondidos do usuário do TAD.
+ * A definição da estrutura PoolNoh encontra-se no arquivo \file poolnoh.cpp.
+ */
+struct PoolNoh;
+
+/**
+ * \brief Cria dinamicamente um pool vazio para nós de \p tam_noh bytes.
+ *
+ * Nenhum bloco é alocado na criação: o primeiro bloco, com \p nohs_por_bloco nós, só é reservado
+ * na primeira chamada a \p alocar_noh.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include "poolnoh.hpp"
+ *
+ * struct Noh {
+ *     int item;
+ *     Noh* prox;
+ * };
+ *
+ * int main() {
+ *     PoolNoh *pool = criar_pool(sizeof(Noh), NOHS_POR_BLOCO);
+ *     Noh *n = static_cast<Noh*>(alocar_noh(pool));
+ *     devolver_noh(pool, n);
+ *     liberar_pool(pool);
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * \pre \p tam_noh e \p nohs_por_bloco devem ser maiores que zero.
+ *
+ * \param tam_noh representa o tamanho, em bytes, de cada nó.
+ * \param nohs_por_bloco representa a quantidade de nós do primeiro bloco.
+ *
+ * \return O endereço de memória do pool alocado dinamicamente.
+ */
+PoolNoh* criar_pool(int tam_noh, int nohs_por_bloco);
+
+/**
+ * \brief Libera todos os blocos do pool e o próprio pool.
+ *
+ * Todos os nós obtidos por meio de \p alocar_noh, devolvidos ou não, deixam de ser válidos.
+ * O custo é proporcional à quantidade de blocos, e não à quantidade de nós. Se o pool foi
+ * compartilhado, apenas a última chamada (uma para cada usuário) o libera de fato.
+ *
+ * \pre O ponteiro \p *pool deve ser diferente de \p NULL.
+ *
+ * \param *pool representa um ponteiro para o pool a ser liberado.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *pool seja igual a \p NULL.
+ */
+void liberar_pool(PoolNoh* pool);
+
+/**
+ * \brief Retorna o endereço de um nó livre do pool.
+ *
+ * O nó é retirado da lista de nós livres ou, caso ela esteja vazia, do bloco mais recente.
+ * Um novo bloco só é alocado quando não há nenhum nó disponível. O conteúdo do nó retornado
+ * é indefinido.
+ *
+ * \pre O ponteiro \p *pool deve ser diferente de \p NULL.
+ *
+ * \param *pool representa um ponteiro para o pool.
+ *
+ * \return O endereço de memória do nó.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *pool seja igual a \p NULL.
+ */
+void* alocar_noh(PoolNoh* pool);
+
+/**
+ * \brief Devolve ao pool um nó obtido por meio de \p alocar_noh, tornando-o disponível para reuso.
+ *
+ * \pre O ponteiro \p *pool deve ser diferente de \p NULL.
+ * \pre O ponteiro \p *noh deve ter sido obtido do mesmo pool e não pode ter sido devolvido antes.
+ *
+ * \param *pool representa um ponteiro para o pool.
+ * \param *noh representa um ponteiro para o nó a ser devolvido.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado, caso algum dos ponteiros seja igual a \p NULL.
+ */
+void devolver_noh(PoolNoh* pool, void* noh);
+
+/**
+ * \brief Registra mais um usuário do pool e retorna o próprio pool.
+ *
+ * Cada usuário deve chamar \p liberar_pool uma vez; os blocos só são liberados na última chamada.
+ *
+ * \pre O ponteiro \p *pool deve ser diferente de \p NULL.
+ *
+ * \param *pool representa um ponteiro para o pool.
+ *
+ * \return O endereço do pool.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *pool seja igual a \p NULL.
+ */
+PoolNoh* compartilhar_pool(PoolNoh* pool);
+
+/**
+ * \brief Indica se o pool tem um único usuário.
+ *
+ * \pre O ponteiro \p *pool deve ser diferente de \p NULL.
+ *
+ * \param *pool representa um ponteiro para o pool.
+ *
+ * \return \p true, se o pool não foi compartilhado e \p false, caso contrário.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *pool seja igual a \p NULL.
+ */
+bool pool_exclusivo(PoolNoh* pool);
+
+/**
+ * \brief Transfere para \p destino os blocos e os nós livres de \p origem, em tempo O(1), e libera \p origem.
+ *
+ * Os nós obtidos de \p origem continuam válidos e passam a pertencer a \p destino: podem ser
+ * devolvidos a ele e só são liberados com ele. Quem usava \p origem deve passar a usar
+ * compartilhar_pool(destino). Dos dois blocos correntes, apenas o que tiver mais nós ainda não
+ * usados continua sendo usado pelas alocações; os nós restantes do outro são descartados.
+ *
+ * \pre Os ponteiros \p *destino e \p *origem devem ser diferentes de \p NULL e entre si.
+ * \pre \p origem deve ter um único usuário (veja \p pool_exclusivo).
+ * \pre Os dois pools devem ter sido criados com o mesmo tamanho de nó.
+ *
+ * \param *destino representa um ponteiro para o pool que receberá os blocos.
+ * \param *origem representa um ponteiro para o pool que será liberado.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado, caso alguma das pré-condições não seja satisfeita.
+ */
+void juntar_pools(PoolNoh* destino, PoolNoh* origem);
+
+/**
+ * \brief Faz com que dois usuários passem a usar o mesmo pool, para que nós obtidos de um possam ser devolvidos ao outro.
+ *
+ * Se os pools forem diferentes, o que tiver um único usuário é juntado ao outro (veja \p juntar_pools)
+ * e o ponteiro correspondente passa a apontar para o pool resultante.
+ *
+ * \pre Os ponteiros \p a, \p b, \p *a e \p *b devem ser diferentes de \p NULL.
+ * \pre Os dois pools devem ter sido criados com o mesmo tamanho de nó.
+ *
+ * \param a representa o endereço do ponteiro para o pool do primeiro usuário.
+ * \param b representa o endereço do ponteiro para o pool do segundo usuário.
+ *
+ * \return \p true, se os dois passaram a usar o mesmo pool e \p false, caso os dois pools sejam
+ *         diferentes e compartilhados com outros usuários (nesse caso, nada é alterado).
+ *
+ * \warning O programa será abortado, caso alguma das pré-condições não seja satisfeita.
+ */
+bool unificar_pools(PoolNoh** a, PoolNoh** b);
+
+/**
+ * \brief Retorna a quantidade de blocos que o pool já solicitou ao alocador do sistema.
+ *
+ * Corresponde ao número de chamadas ao operador "new" feitas pelo pool desde a sua criação.
+ *
+ * \pre O ponteiro \p *pool deve ser diferente de \p NULL.
+ *
+ * \param *pool representa um ponteiro para o pool.
+ *
+ * \return A quantidade de blocos alocados.
+ *
+ * \warning O programa será abortado, caso o ponteiro \p *pool seja igual a \p NULL.
+ */
+int obter_qtd_blocos(PoolNoh* pool);
+
+#endif
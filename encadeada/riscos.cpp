@@ -0,0 +1,159 @@
+#include <assert.h> /**< Necessário para uso da macro "assert". */
+#include <algorithm> /**< Necessário para uso de "sort" e "binary_search". */
+#include <atomic> /**< Necessário para uso de std::atomic. */
+#include <cstdio> /**< Necessário para uso de fprintf. */
+#include <cstdlib> /**< Necessário para uso do NULL e de abort. */
+#include <mutex> /**< Necessário para uso de std::mutex. */
+#include <vector> /**< Necessário para uso de std::vector. */
+#include "riscos.hpp"
+
+using namespace std;
+
+/*
+ * Quantidade de nós aposentados que dispara uma varredura. Por ser proporcional ao total de
+ * ponteiros de risco, garante que cada varredura libere pelo menos metade dos nós aposentados,
+ * o que mantém o custo amortizado por nó constante.
+ */
+#define LIMITE_APOSENTADOS (2 * MAX_THREADS_RISCO * RISCOS_POR_THREAD)
+
+/* Registro de uma thread: os ponteiros de risco que ela publicou. */
+struct RegistroRisco {
+	atomic<bool> em_uso; /**< Indica se o registro pertence a alguma thread. */
+	atomic<void*> riscos[RISCOS_POR_THREAD]; /**< Ponteiros publicados pela thread. */
+};
+
+/* Nó aposentado, junto com a função capaz de liberá-lo. */
+struct Aposentado {
+	void* p;
+	void (*liberar)(void*);
+};
+
+/* Registros de todas as threads. Variáveis globais "static" são zeradas antes do início do programa. */
+static RegistroRisco registros[MAX_THREADS_RISCO];
+
+/* Nós aposentados por threads que terminaram antes que eles pudessem ser liberados. */
+static mutex trava_orfaos;
+static vector<Aposentado> orfaos;
+static atomic<bool> existem_orfaos(false);
+
+static void varrer(vector<Aposentado>& aposentados);
+
+/* Estado de cada thread. O destrutor é executado automaticamente quando a thread termina. */
+struct EstadoThread {
+	RegistroRisco* registro;
+	vector<Aposentado> aposentados;
+
+	EstadoThread() : registro(NULL) {}
+
+	~EstadoThread() {
+		if (registro != NULL) {
+			for (int i = 0; i < RISCOS_POR_THREAD; i++) {
+				registro->riscos[i].store(NULL, memory_order_release);
+			}
+		}
+		varrer(aposentados);
+		if (!aposentados.empty()) {
+			lock_guard<mutex> guarda(trava_orfaos);
+			orfaos.insert(orfaos.end(), aposentados.begin(), aposentados.end());
+			existem_orfaos.store(true, memory_order_release);
+		}
+		if (registro != NULL) {
+			registro->em_uso.store(false, memory_order_release);
+		}
+	}
+};
+
+static thread_local EstadoThread estado;
+
+/* Retorna o registro da thread corrente, ocupando um registro livre na primeira chamada. */
+static RegistroRisco* obter_registro() {
+	if (estado.registro == NULL) {
+		for (int i = 0; i < MAX_THREADS_RISCO; i++) {
+			bool livre = false;
+			if (registros[i].em_uso.compare_exchange_strong(livre, true, memory_order_acq_rel)) {
+				estado.registro = &registros[i];
+				break;
+			}
+		}
+		/*
+		 * Mais de MAX_THREADS_RISCO threads estão usando o módulo ao mesmo tempo. A verificação não
+		 * usa assert porque, sem registro, a thread não teria como proteger os nós que acessa.
+		 */
+		if (estado.registro == NULL) {
+			fprintf(stderr, "riscos: mais de %d threads usando ponteiros de risco ao mesmo tempo\n", MAX_THREADS_RISCO);
+			abort();
+		}
+	}
+	return estado.registro;
+}
+
+/*
+ * Libera os nós de "aposentados" que não estão publicados por nenhuma thread e mantém
+ * os demais no vetor.
+ */
+static void varrer(vector<Aposentado>& aposentados) {
+	if (existem_orfaos.load(memory_order_acquire)) {
+		lock_guard<mutex> guarda(trava_orfaos);
+		aposentados.insert(aposentados.end(), orfaos.begin(), orfaos.end());
+		orfaos.clear();
+		existem_orfaos.store(false, memory_order_release);
+	}
+	if (aposentados.empty()) {
+		return;
+	}
+
+	/* Fotografa todos os ponteiros de risco publicados no momento. */
+	vector<void*> publicados;
+	publicados.reserve(MAX_THREADS_RISCO * RISCOS_POR_THREAD);
+	for (int i = 0; i < MAX_THREADS_RISCO; i++) {
+		for (int j = 0; j < RISCOS_POR_THREAD; j++) {
+			void* p = registros[i].riscos[j].load(memory_order_seq_cst);
+			if (p != NULL) {
+				publicados.push_back(p);
+			}
+		}
+	}
+	sort(publicados.begin(), publicados.end());
+
+	size_t mantidos = 0;
+	for (size_t i = 0; i < aposentados.size(); i++) {
+		if (binary_search(publicados.begin(), publicados.end(), aposentados[i].p)) {
+			aposentados[mantidos++] = aposentados[i];
+		} else {
+			aposentados[i].liberar(aposentados[i].p);
+		}
+	}
+	aposentados.resize(mantidos);
+}
+
+void proteger(int indice, void* p) {
+	assert((indice >= 0) && (indice < RISCOS_POR_THREAD));
+
+	/*
+	 * A ordem seq_cst garante que a publicação seja visível para as outras threads antes
+	 * de a thread corrente reler a origem do ponteiro para confirmá-lo.
+	 */
+	obter_registro()->riscos[indice].store(p, memory_order_seq_cst);
+}
+
+void liberar_riscos() {
+	RegistroRisco* registro = obter_registro();
+	for (int i = 0; i < RISCOS_POR_THREAD; i++) {
+		registro->riscos[i].store(NULL, memory_order_release);
+	}
+}
+
+void aposentar(void* p, void (*liberar)(void*)) {
+	assert(p != NULL);
+	assert(liberar != NULL);
+
+	Aposentado a = {p, liberar};
+	estado.aposentados.push_back(a);
+	if (estado.aposentados.size() >= LIMITE_APOSENTADOS) {
+		varrer(estado.aposentados);
+	}
+}
+
+void coletar_aposentados() {
+	varrer(estado.aposentados);
+}
@@ -0,0 +1,100 @@
+/**
+ * \file riscos.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Interface do módulo de ponteiros de risco (hazard pointers)
+ *
+ * Disponibiliza a recuperação segura de memória usada pelas estruturas encadeadas sem travas
+ * (por exemplo, a FilaConc). Nessas estruturas, uma thread pode remover e liberar um nó enquanto
+ * outra thread ainda está lendo esse mesmo nó. Para evitar isso:
+ *  - antes de acessar um nó compartilhado, a thread o publica em um de seus ponteiros de risco
+ *    (\p proteger) e confirma que ele ainda está na estrutura;
+ *  - em vez de liberar um nó removido, a thread o "aposenta" (\p aposentar);
+ *  - de tempos em tempos, os nós aposentados que não estão publicados como ponteiro de risco
+ *    por nenhuma thread são efetivamente liberados.
+ *
+ * Cada thread usa até RISCOS_POR_THREAD ponteiros de risco simultâneos e o módulo suporta até
+ * MAX_THREADS_RISCO threads utilizando-o ao mesmo tempo.
+ */
+
+#ifndef RISCOS_HPP
+#define RISCOS_HPP
+
+/**
+ * \def RISCOS_POR_THREAD
+ * \brief Define a quantidade de ponteiros de risco disponíveis para cada thread.
+ * \hideinitializer
+ */
+#define RISCOS_POR_THREAD 2
+
+/**
+ * \def MAX_THREADS_RISCO
+ * \brief Define a quantidade máxima de threads que podem usar ponteiros de risco ao mesmo tempo.
+ * \hideinitializer
+ */
+#ifndef MAX_THREADS_RISCO
+#define MAX_THREADS_RISCO 256
+#endif
+
+/**
+ * \brief Publica o ponteiro \p p no ponteiro de risco de número \p indice da thread corrente.
+ *
+ * Enquanto \p p estiver publicado, nenhuma thread liberará a memória apontada por ele, mesmo
+ * que ela tenha sido aposentada. Como \p p pode ter sido aposentado entre a sua leitura e a
+ * sua publicação, quem chama esta função deve, logo em seguida, reler a origem de \p p e
+ * confirmar que ele continua lá. Exemplo:
+ *
+ * \code {.cpp}
+ * No* p;
+ * do {
+ *     p = estrutura->inicio.load();
+ *     proteger(0, p);
+ * } while (p != estrutura->inicio.load());
+ * \endcode
+ *
+ * \pre \p indice deve estar no intervalo [0, RISCOS_POR_THREAD - 1].
+ *
+ * \param indice representa o número do ponteiro de risco a ser utilizado.
+ * \param *p representa o ponteiro a ser protegido.
+ *
+ * \return void
+ *
+ * \warning O programa será abortado caso \p indice seja inválido ou caso mais de
+ *          MAX_THREADS_RISCO threads utilizem o módulo ao mesmo tempo.
+ */
+void proteger(int indice, void* p);
+
+/**
+ * \brief Remove a publicação de todos os ponteiros de risco da thread corrente.
+ *
+ * \return void
+ */
+void liberar_riscos();
+
+/**
+ * \brief Aposenta um nó que já foi removido da estrutura compartilhada.
+ *
+ * A função \p liberar será chamada com \p p como argumento assim que nenhuma thread tiver
+ * \p p publicado como ponteiro de risco. Isso pode acontecer durante esta chamada, durante
+ * uma chamada futura feita pela mesma thread ou quando a thread terminar.
+ *
+ * \pre O ponteiro \p *p deve ter sido removido da estrutura, de modo que nenhuma thread
+ *      consiga obtê-lo novamente a partir dela.
+ *
+ * \param *p representa o ponteiro a ser aposentado.
+ * \param liberar representa a função que libera a memória apontada por \p p.
+ *
+ * \return void
+ */
+void aposentar(void* p, void (*liberar)(void*));
+
+/**
+ * \brief Tenta liberar imediatamente todos os nós aposentados pela thread corrente.
+ *
+ * Os nós ainda publicados como ponteiros de risco por outras threads continuam aposentados.
+ *
+ * \return void
+ */
+void coletar_aposentados();
+
+#endif
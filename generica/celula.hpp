@@ -0,0 +1,48 @@
+/**
+ * \file celula.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Célula de armazenamento usada pelas EDs genéricas implementadas com arranjos.
+ *
+ * As EDs com arranjos guardam os elementos diretamente no vetor (sem ponteiros para elementos
+ * alocados em outro lugar), mas as posições livres do vetor não podem conter objetos construídos:
+ * o tipo T pode não ter construtor padrão ou pode ser caro de construir. Cada posição do vetor é,
+ * por isso, uma Celula: uma união com um único membro do tipo T, cujo construtor e destrutor não
+ * fazem nada. O objeto só passa a existir quando a ED o constrói na célula (com o "new" de
+ * posicionamento) e deixa de existir quando a ED chama o seu destrutor.
+ */
+
+#ifndef GENERICA_CELULA_HPP
+#define GENERICA_CELULA_HPP
+
+#include <new> /**< Necessário para uso do "new" de posicionamento. */
+#include <utility> /**< Necessário para uso das funções "std::move" e "std::forward". */
+
+namespace generica {
+
+/**
+ * \union Celula
+ * \brief Posição de um vetor que pode ou não conter um objeto do tipo T.
+ */
+template <typename T>
+union Celula {
+	T valor; /**< Objeto armazenado na célula, quando ela estiver ocupada. */
+
+	Celula() {}
+	~Celula() {}
+
+	/** \brief Constrói o objeto na célula, repassando os argumentos ao construtor de T. */
+	template <typename... Args>
+	void construir(Args&&... args) {
+		::new (static_cast<void*>(&valor)) T(std::forward<Args>(args)...);
+	}
+
+	/** \brief Destrói o objeto da célula, que volta a ficar livre. */
+	void destruir() {
+		valor.~T();
+	}
+};
+
+}
+
+#endif
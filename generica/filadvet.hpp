@@ -0,0 +1,215 @@
+/**
+ * \file filadvet.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Interface e implementação do TAD genérico generica::FilaDVet
+ *
+ * Versão genérica da FilaDVet (array/filadvet.hpp): os elementos, de qualquer tipo T, são guardados
+ * diretamente no vetor circular da fila dupla. Assim como na versão original, uma posição do vetor
+ * fica sempre livre para distinguir a fila cheia da fila vazia.
+ *
+ * Os elementos nunca são copiados pela fila: as funções construir_* constroem o objeto diretamente
+ * no vetor e as funções remover_* devolvem o elemento removido por movimentação.
+ *
+ * A capacidade é o parâmetro N do modelo (FilaDVet<T, N>), fixado na compilação. O vetor faz parte do
+ * próprio objeto, sem nenhuma alocação dinâmica: a fila pode ser uma variável local, um membro de
+ * outra estrutura ou, com o "new" de posicionamento, ser construída em uma região de memória
+ * compartilhada (neste caso, T não deve conter ponteiros).
+ * Quando N é uma potência de dois, o avanço circular dos índices usa uma máscara de bits em
+ * vez do resto da divisão.
+ */
+
+#ifndef GENERICA_FILADVET_HPP
+#define GENERICA_FILADVET_HPP
+
+#include <assert.h> /**< Necessário para uso da macro "assert". */
+#include "celula.hpp"
+
+namespace generica {
+
+/**
+ * \class FilaDVet
+ * \brief Fila dupla com arranjo circular de capacidade N, cujos elementos são do tipo T.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include<string>
+ * #include "generica/filadvet.hpp"
+ *
+ * using namespace std;
+ *
+ * int main() {
+ *     generica::FilaDVet<string> f;
+ *     f.inserir_no_fim("meio");
+ *     f.construir_no_inicio("inicio");
+ *     f.construir_no_fim(3, '!');
+ *     while (!f.estah_vazia()) {
+ *         cout << f.remover_do_inicio() << endl;
+ *     }
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * Saída esperada:
+ * \code {.unparsed}
+ *     inicio
+ *     meio
+ *     !!!
+ * \endcode
+ */
+template <typename T, int N = 100>
+class FilaDVet {
+public:
+	/** \brief Tamanho do vetor circular (a fila comporta TAM_MAX - 1 elementos). */
+	static const int TAM_MAX = N;
+
+	static_assert(N >= 2, "O vetor circular precisa de pelo menos duas posições.");
+
+	/**
+	 * \brief Indica se N é uma potência de dois. Nesse caso, os índices circulares são calculados
+	 * com uma máscara de bits, em vez do resto da divisão (a condição é avaliada na compilação).
+	 */
+	static constexpr bool POTENCIA_DE_DOIS = ((N & (N - 1)) == 0);
+
+	/** \brief Cria uma fila vazia. */
+	FilaDVet() : inicio(0), fim(0) {}
+
+	/** \brief Destrói os elementos que ainda estiverem na fila. */
+	~FilaDVet() {
+		while (!estah_vazia()) {
+			itens[inicio].destruir();
+			inicio = incrementar(inicio);
+		}
+	}
+
+	FilaDVet(const FilaDVet&) = delete;
+	FilaDVet& operator=(const FilaDVet&) = delete;
+
+	/** \brief Verifica se a fila está vazia. */
+	bool estah_vazia() const {
+		return (inicio == fim);
+	}
+
+	/** \brief Verifica se a fila está cheia. */
+	bool estah_cheia() const {
+		return (incrementar(fim) == inicio);
+	}
+
+	/**
+	 * \brief Insere uma cópia de \p item no fim da fila (ou move \p item, se ele for um rvalue).
+	 * \warning O programa será abortado, caso a fila esteja cheia.
+	 */
+	void inserir_no_fim(const T& item) {
+		construir_no_fim(item);
+	}
+
+	/** \copydoc inserir_no_fim(const T&) */
+	void inserir_no_fim(T&& item) {
+		construir_no_fim(std::move(item));
+	}
+
+	/**
+	 * \brief Insere uma cópia de \p item no início da fila (ou move \p item, se ele for um rvalue).
+	 * \warning O programa será abortado, caso a fila esteja cheia.
+	 */
+	void inserir_no_inicio(const T& item) {
+		construir_no_inicio(item);
+	}
+
+	/** \copydoc inserir_no_inicio(const T&) */
+	void inserir_no_inicio(T&& item) {
+		construir_no_inicio(std::move(item));
+	}
+
+	/**
+	 * \brief Constrói um novo elemento diretamente no fim da fila, repassando \p args ao construtor de T.
+	 * \warning O programa será abortado, caso a fila esteja cheia.
+	 */
+	template <typename... Args>
+	void construir_no_fim(Args&&... args) {
+		assert(!estah_cheia());
+
+		itens[fim].construir(std::forward<Args>(args)...);
+		fim = incrementar(fim);
+	}
+
+	/**
+	 * \brief Constrói um novo elemento diretamente no início da fila, repassando \p args ao construtor de T.
+	 * \warning O programa será abortado, caso a fila esteja cheia.
+	 */
+	template <typename... Args>
+	void construir_no_inicio(Args&&... args) {
+		assert(!estah_cheia());
+
+		int novo_inicio = decrementar(inicio);
+		itens[novo_inicio].construir(std::forward<Args>(args)...);
+		inicio = novo_inicio;
+	}
+
+	/**
+	 * \brief Remove e retorna, por movimentação, o elemento do início da fila.
+	 * \warning O programa será abortado, caso a fila esteja vazia.
+	 */
+	T remover_do_inicio() {
+		assert(!estah_vazia());
+
+		T item(std::move(itens[inicio].valor));
+		itens[inicio].destruir();
+		inicio = incrementar(inicio);
+		return item;
+	}
+
+	/**
+	 * \brief Remove e retorna, por movimentação, o elemento do fim da fila.
+	 * \warning O programa será abortado, caso a fila esteja vazia.
+	 */
+	T remover_do_fim() {
+		assert(!estah_vazia());
+
+		fim = decrementar(fim);
+		T item(std::move(itens[fim].valor));
+		itens[fim].destruir();
+		return item;
+	}
+
+	/**
+	 * \brief Apenas retorna uma referência para o elemento do início da fila.
+	 * \warning O programa será abortado, caso a fila esteja vazia.
+	 */
+	T& obter_inicio() {
+		assert(!estah_vazia());
+
+		return itens[inicio].valor;
+	}
+
+	/**
+	 * \brief Apenas retorna uma referência para o elemento do fim da fila.
+	 * \warning O programa será abortado, caso a fila esteja vazia.
+	 */
+	T& obter_fim() {
+		assert(!estah_vazia());
+
+		return itens[decrementar(fim)].valor;
+	}
+
+private:
+	/* Retorna o próximo valor do índice i, de forma circular. */
+	static int incrementar(int i) {
+		return POTENCIA_DE_DOIS ? ((i + 1) & (N - 1)) : ((i + 1) % N);
+	}
+
+	/* Retorna o decremento do índice i, de forma circular. */
+	static int decrementar(int i) {
+		return POTENCIA_DE_DOIS ? ((i - 1) & (N - 1)) : ((i - 1 + N) % N);
+	}
+
+	Celula<T> itens[TAM_MAX]; /**< Vetor que armazena os elementos da fila. */
+	int inicio; /**< Variável que indica a posição do primeiro elemento da fila. */
+	int fim; /**< Variável que indica a próxima posição vazia da fila. */
+};
+
+}
+
+#endif
@@ -0,0 +1,152 @@
+/**
+ * \file filaenc.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Interface e implementação do TAD genérico generica::FilaEnc
+ *
+ * Versão genérica da FilaEnc (encadeada/filaenc.hpp): cada nó guarda um elemento de qualquer
+ * tipo T diretamente, ao lado do ponteiro para o próximo nó. Assim como na versão original, os nós
+ * são alocados de um PoolNoh (encadeada/poolnoh.hpp), de modo que o programa deve ser ligado
+ * também com encadeada/poolnoh.cpp (no CMake, o alvo estruturas_generica já inclui a biblioteca
+ * estruturas_pool).
+ *
+ * Os elementos nunca são copiados pela fila: \p construir constrói o objeto diretamente no nó
+ * e \p remover devolve o elemento removido por movimentação.
+ */
+
+#ifndef GENERICA_FILAENC_HPP
+#define GENERICA_FILAENC_HPP
+
+#include <assert.h> /**< Necessário para uso da macro "assert". */
+#include <cstdlib> /**< Necessário para uso do NULL. */
+#include <new> /**< Necessário para uso do "new" de posicionamento. */
+#include <utility> /**< Necessário para uso das funções "std::move" e "std::forward". */
+#include "../encadeada/poolnoh.hpp"
+
+namespace generica {
+
+/**
+ * \class FilaEnc
+ * \brief Fila encadeada, cujos elementos são do tipo T.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include<string>
+ * #include "generica/filaenc.hpp"
+ *
+ * using namespace std;
+ *
+ * int main() {
+ *     generica::FilaEnc<string> f;
+ *     f.inserir("AED");
+ *     f.construir(3, 'x');
+ *     while (!f.estah_vazia()) {
+ *         cout << f.remover() << endl;
+ *     }
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * Saída esperada:
+ * \code {.unparsed}
+ *     AED
+ *     xxx
+ * \endcode
+ */
+template <typename T>
+class FilaEnc {
+public:
+	/** \brief Cria uma fila vazia. */
+	FilaEnc() : inicio(NULL), fim(NULL), pool(criar_pool(sizeof(Noh), NOHS_POR_BLOCO)) {}
+
+	/** \brief Destrói os elementos que ainda estiverem na fila e libera os nós. */
+	~FilaEnc() {
+		while (inicio != NULL) {
+			Noh* aux = inicio;
+			inicio = inicio->prox;
+			aux->~Noh();
+		}
+		liberar_pool(pool);
+	}
+
+	FilaEnc(const FilaEnc&) = delete;
+	FilaEnc& operator=(const FilaEnc&) = delete;
+
+	/** \brief Verifica se a fila está vazia. */
+	bool estah_vazia() const {
+		return (inicio == NULL);
+	}
+
+	/** \brief Insere uma cópia de \p item no fim da fila (ou move \p item, se ele for um rvalue). */
+	void inserir(const T& item) {
+		construir(item);
+	}
+
+	/** \copydoc inserir(const T&) */
+	void inserir(T&& item) {
+		construir(std::move(item));
+	}
+
+	/** \brief Constrói um novo elemento diretamente no fim da fila, repassando \p args ao construtor de T. */
+	template <typename... Args>
+	void construir(Args&&... args) {
+		Noh* novo_noh = ::new (alocar_noh(pool)) Noh(std::forward<Args>(args)...);
+
+		if (inicio == NULL) {
+			inicio = novo_noh;
+		} else {
+			fim->prox = novo_noh;
+		}
+		fim = novo_noh;
+	}
+
+	/**
+	 * \brief Remove e retorna, por movimentação, o elemento do início da fila.
+	 * \warning O programa será abortado, caso a fila esteja vazia.
+	 */
+	T remover() {
+		assert(!estah_vazia());
+
+		Noh* aux = inicio;
+		inicio = inicio->prox;
+		if (inicio == NULL) {
+			fim = NULL;
+		}
+		T item(std::move(aux->item));
+		aux->~Noh();
+		devolver_noh(pool, aux);
+		return item;
+	}
+
+	/**
+	 * \brief Apenas retorna uma referência para o elemento do início da fila.
+	 * \warning O programa será abortado, caso a fila esteja vazia.
+	 */
+	T& obter_inicio() {
+		assert(!estah_vazia());
+
+		return inicio->item;
+	}
+
+private:
+	struct Noh {
+		template <typename... Args>
+		explicit Noh(Args&&... args) : item(std::forward<Args>(args)...), prox(NULL) {}
+
+		T item; /**< Representa a informação a ser armazenada em cada nó da fila. */
+		Noh* prox; /**< É um ponteiro para o próximo nó da fila. */
+	};
+
+	/* O pool garante apenas o alinhamento de um ponteiro para cada nó. */
+	static_assert(alignof(Noh) <= alignof(void*), "O tipo T exige alinhamento maior do que o garantido pelo PoolNoh.");
+
+	Noh* inicio; /**< É um ponteiro para o início da fila. */
+	Noh* fim; /**< É um ponteiro para o fim da fila. */
+	PoolNoh* pool; /**< Pool de onde são alocados os nós da fila. */
+};
+
+}
+
+#endif
@@ -0,0 +1,160 @@
+/**
+ * \file filavet.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Interface e implementação do TAD genérico generica::FilaVet
+ *
+ * Versão genérica da FilaVet (array/filavet.hpp): os elementos, de qualquer tipo T, são guardados
+ * diretamente no vetor circular da fila. Assim como na versão original, uma posição do vetor fica
+ * sempre livre para distinguir a fila cheia da fila vazia.
+ *
+ * Os elementos nunca são copiados pela fila: \p construir constrói o objeto diretamente no vetor
+ * e \p remover devolve o elemento removido por movimentação.
+ *
+ * A capacidade é o parâmetro N do modelo (FilaVet<T, N>), fixado na compilação. O vetor faz parte do
+ * próprio objeto, sem nenhuma alocação dinâmica: a fila pode ser uma variável local, um membro de
+ * outra estrutura ou, com o "new" de posicionamento, ser construída em uma região de memória
+ * compartilhada (neste caso, T não deve conter ponteiros).
+ * Quando N é uma potência de dois, o avanço circular dos índices usa uma máscara de bits em
+ * vez do resto da divisão.
+ */
+
+#ifndef GENERICA_FILAVET_HPP
+#define GENERICA_FILAVET_HPP
+
+#include <assert.h> /**< Necessário para uso da macro "assert". */
+#include "celula.hpp"
+
+namespace generica {
+
+/**
+ * \class FilaVet
+ * \brief Fila com arranjo circular de capacidade N, cujos elementos são do tipo T.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include<utility>
+ * #include "generica/filavet.hpp"
+ *
+ * using namespace std;
+ *
+ * int main() {
+ *     generica::FilaVet<pair<int, char>> f;
+ *     f.construir(1, 'a');
+ *     f.inserir(make_pair(2, 'b'));
+ *     while (!f.estah_vazia()) {
+ *         pair<int, char> x = f.remover();
+ *         cout << x.first << x.second << endl;
+ *     }
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * Saída esperada:
+ * \code {.unparsed}
+ *     1a
+ *     2b
+ * \endcode
+ */
+template <typename T, int N = 100>
+class FilaVet {
+public:
+	/** \brief Tamanho do vetor circular (a fila comporta TAM_MAX - 1 elementos). */
+	static const int TAM_MAX = N;
+
+	static_assert(N >= 2, "O vetor circular precisa de pelo menos duas posições.");
+
+	/**
+	 * \brief Indica se N é uma potência de dois. Nesse caso, os índices circulares são calculados
+	 * com uma máscara de bits, em vez do resto da divisão (a condição é avaliada na compilação).
+	 */
+	static constexpr bool POTENCIA_DE_DOIS = ((N & (N - 1)) == 0);
+
+	/** \brief Cria uma fila vazia. */
+	FilaVet() : inicio(0), fim(0) {}
+
+	/** \brief Destrói os elementos que ainda estiverem na fila. */
+	~FilaVet() {
+		while (!estah_vazia()) {
+			itens[inicio].destruir();
+			inicio = incrementar(inicio);
+		}
+	}
+
+	FilaVet(const FilaVet&) = delete;
+	FilaVet& operator=(const FilaVet&) = delete;
+
+	/** \brief Verifica se a fila está vazia. */
+	bool estah_vazia() const {
+		return (inicio == fim);
+	}
+
+	/** \brief Verifica se a fila está cheia. */
+	bool estah_cheia() const {
+		return (incrementar(fim) == inicio);
+	}
+
+	/**
+	 * \brief Insere uma cópia de \p item no fim da fila (ou move \p item, se ele for um rvalue).
+	 * \warning O programa será abortado, caso a fila esteja cheia.
+	 */
+	void inserir(const T& item) {
+		construir(item);
+	}
+
+	/** \copydoc inserir(const T&) */
+	void inserir(T&& item) {
+		construir(std::move(item));
+	}
+
+	/**
+	 * \brief Constrói um novo elemento diretamente no fim da fila, repassando \p args ao construtor de T.
+	 * \warning O programa será abortado, caso a fila esteja cheia.
+	 */
+	template <typename... Args>
+	void construir(Args&&... args) {
+		assert(!estah_cheia());
+
+		itens[fim].construir(std::forward<Args>(args)...);
+		fim = incrementar(fim);
+	}
+
+	/**
+	 * \brief Remove e retorna, por movimentação, o elemento do início da fila.
+	 * \warning O programa será abortado, caso a fila esteja vazia.
+	 */
+	T remover() {
+		assert(!estah_vazia());
+
+		T item(std::move(itens[inicio].valor));
+		itens[inicio].destruir();
+		inicio = incrementar(inicio);
+		return item;
+	}
+
+	/**
+	 * \brief Apenas retorna uma referência para o elemento do início da fila.
+	 * \warning O programa será abortado, caso a fila esteja vazia.
+	 */
+	T& obter_inicio() {
+		assert(!estah_vazia());
+
+		return itens[inicio].valor;
+	}
+
+private:
+	/* Retorna o próximo valor do índice i, de forma circular. */
+	static int incrementar(int i) {
+		return POTENCIA_DE_DOIS ? ((i + 1) & (N - 1)) : ((i + 1) % N);
+	}
+
+	Celula<T> itens[TAM_MAX]; /**< Vetor que armazena os elementos da fila. */
+	int inicio; /**< Variável que indica a posição do primeiro elemento da fila. */
+	int fim; /**< Variável que indica a próxima posição vazia da fila. */
+};
+
+}
+
+#endif
@@ -0,0 +1,272 @@
+/**
+ * \file listadenc.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Interface e implementação do TAD genérico generica::ListaDEnc
+ *
+ * Versão genérica da ListaDEnc (encadeada/listadenc.hpp): cada nó guarda um elemento de qualquer
+ * tipo T diretamente, ao lado dos ponteiros para o nó anterior e o próximo. Assim como na versão
+ * original, os nós são alocados de um PoolNoh (encadeada/poolnoh.hpp), de modo que o programa deve
+ * ser ligado também com encadeada/poolnoh.cpp (no CMake, o alvo estruturas_generica já inclui a
+ * biblioteca estruturas_pool), e as operações por posição percorrem a lista a
+ * partir da extremidade mais próxima.
+ *
+ * Os elementos nunca são copiados pela lista: as funções construir_* constroem o objeto diretamente
+ * no nó e as funções remover_* devolvem o elemento removido por movimentação.
+ */
+
+#ifndef GENERICA_LISTADENC_HPP
+#define GENERICA_LISTADENC_HPP
+
+#include <assert.h> /**< Necessário para uso da macro "assert". */
+#include <cstdlib> /**< Necessário para uso do NULL. */
+#include <new> /**< Necessário para uso do "new" de posicionamento. */
+#include <utility> /**< Necessário para uso das funções "std::move" e "std::forward". */
+#include "../encadeada/poolnoh.hpp"
+
+namespace generica {
+
+/**
+ * \class ListaDEnc
+ * \brief Lista duplamente encadeada, cujos elementos são do tipo T.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include<string>
+ * #include "generica/listadenc.hpp"
+ *
+ * using namespace std;
+ *
+ * int main() {
+ *     generica::ListaDEnc<string> li;
+ *     li.inserir_no_fim("tres");
+ *     li.construir_no_inicio("um");
+ *     li.construir(1, "dois");
+ *     while (!li.estah_vazia()) {
+ *         cout << li.remover_fim() << " ";
+ *     }
+ *     cout << endl;
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * Saída esperada:
+ * \code {.unparsed}
+ *     tres dois um
+ * \endcode
+ */
+template <typename T>
+class ListaDEnc {
+public:
+	/** \brief Cria uma lista vazia. */
+	ListaDEnc() : inicio(NULL), fim(NULL), tam(0), pool(criar_pool(sizeof(Noh), NOHS_POR_BLOCO)) {}
+
+	/** \brief Destrói os elementos que ainda estiverem na lista e libera os nós. */
+	~ListaDEnc() {
+		while (inicio != NULL) {
+			Noh* aux = inicio;
+			inicio = inicio->prox;
+			aux->~Noh();
+		}
+		liberar_pool(pool);
+	}
+
+	ListaDEnc(const ListaDEnc&) = delete;
+	ListaDEnc& operator=(const ListaDEnc&) = delete;
+
+	/** \brief Verifica se a lista está vazia. */
+	bool estah_vazia() const {
+		return (inicio == NULL);
+	}
+
+	/**
+	 * \brief Insere uma cópia de \p item na posição \p pos (ou move \p item, se ele for um rvalue).
+	 * \warning O programa será abortado, caso \p pos não esteja em [0, TAM].
+	 */
+	void inserir(const T& item, int pos) {
+		construir(pos, item);
+	}
+
+	/** \copydoc inserir(const T&, int) */
+	void inserir(T&& item, int pos) {
+		construir(pos, std::move(item));
+	}
+
+	/** \brief Insere uma cópia de \p item no início da lista (ou move \p item, se ele for um rvalue). */
+	void inserir_no_inicio(const T& item) {
+		construir(0, item);
+	}
+
+	/** \copydoc inserir_no_inicio(const T&) */
+	void inserir_no_inicio(T&& item) {
+		construir(0, std::move(item));
+	}
+
+	/** \brief Insere uma cópia de \p item no fim da lista (ou move \p item, se ele for um rvalue). */
+	void inserir_no_fim(const T& item) {
+		construir(tam, item);
+	}
+
+	/** \copydoc inserir_no_fim(const T&) */
+	void inserir_no_fim(T&& item) {
+		construir(tam, std::move(item));
+	}
+
+	/** \brief Constrói um novo elemento diretamente no início da lista, repassando \p args ao construtor de T. */
+	template <typename... Args>
+	void construir_no_inicio(Args&&... args) {
+		construir(0, std::forward<Args>(args)...);
+	}
+
+	/** \brief Constrói um novo elemento diretamente no fim da lista, repassando \p args ao construtor de T. */
+	template <typename... Args>
+	void construir_no_fim(Args&&... args) {
+		construir(tam, std::forward<Args>(args)...);
+	}
+
+	/**
+	 * \brief Constrói um novo elemento diretamente na posição \p pos, repassando \p args ao construtor de T.
+	 * \warning O programa será abortado, caso \p pos não esteja em [0, TAM].
+	 */
+	template <typename... Args>
+	void construir(int pos, Args&&... args) {
+		assert((pos >= 0) && (pos <= tam));
+
+		// O novo nó fica entre "ant" e "prox" (o nó que hoje ocupa a posição "pos")
+		Noh* prox = (pos == tam) ? NULL : localizar(pos);
+		Noh* ant = (prox == NULL) ? fim : prox->ant;
+		Noh* novo_noh = ::new (alocar_noh(pool)) Noh(ant, prox, std::forward<Args>(args)...);
+
+		if (ant == NULL) {
+			inicio = novo_noh;
+		} else {
+			ant->prox = novo_noh;
+		}
+		if (prox == NULL) {
+			fim = novo_noh;
+		} else {
+			prox->ant = novo_noh;
+		}
+		tam++;
+	}
+
+	/**
+	 * \brief Remove e retorna, por movimentação, o elemento da posição \p pos.
+	 * \warning O programa será abortado, caso a lista esteja vazia ou \p pos não esteja em [0, TAM - 1].
+	 */
+	T remover(int pos) {
+		assert(!estah_vazia());
+		assert((pos >= 0) && (pos < tam));
+
+		Noh* aux = localizar(pos);
+		if (aux->ant == NULL) {
+			inicio = aux->prox;
+		} else {
+			aux->ant->prox = aux->prox;
+		}
+		if (aux->prox == NULL) {
+			fim = aux->ant;
+		} else {
+			aux->prox->ant = aux->ant;
+		}
+
+		T item(std::move(aux->item));
+		aux->~Noh();
+		devolver_noh(pool, aux);
+		tam--;
+		return item;
+	}
+
+	/**
+	 * \brief Remove e retorna, por movimentação, o elemento do início da lista.
+	 * \warning O programa será abortado, caso a lista esteja vazia.
+	 */
+	T remover_inicio() {
+		return remover(0);
+	}
+
+	/**
+	 * \brief Remove e retorna, por movimentação, o elemento do fim da lista.
+	 * \warning O programa será abortado, caso a lista esteja vazia.
+	 */
+	T remover_fim() {
+		return remover(tam - 1);
+	}
+
+	/**
+	 * \brief Apenas retorna uma referência para o elemento da posição \p pos.
+	 * \warning O programa será abortado, caso a lista esteja vazia ou \p pos não esteja em [0, TAM - 1].
+	 */
+	T& obter_elemento(int pos) {
+		assert(!estah_vazia());
+		assert((pos >= 0) && (pos < tam));
+
+		return localizar(pos)->item;
+	}
+
+	/**
+	 * \brief Apenas retorna uma referência para o elemento do início da lista.
+	 * \warning O programa será abortado, caso a lista esteja vazia.
+	 */
+	T& obter_inicio() {
+		assert(!estah_vazia());
+
+		return inicio->item;
+	}
+
+	/**
+	 * \brief Apenas retorna uma referência para o elemento do fim da lista.
+	 * \warning O programa será abortado, caso a lista esteja vazia.
+	 */
+	T& obter_fim() {
+		assert(!estah_vazia());
+
+		return fim->item;
+	}
+
+	/** \brief Retorna a quantidade de elementos da lista. */
+	int obter_tamanho() const {
+		return tam;
+	}
+
+private:
+	struct Noh {
+		template <typename... Args>
+		Noh(Noh* a, Noh* p, Args&&... args) : item(std::forward<Args>(args)...), ant(a), prox(p) {}
+
+		T item; /**< Representa a informação a ser armazenada em cada nó da lista. */
+		Noh* ant; /**< É um ponteiro para o nó anterior. */
+		Noh* prox; /**< É um ponteiro para o próximo nó da lista. */
+	};
+
+	/* O pool garante apenas o alinhamento de um ponteiro para cada nó. */
+	static_assert(alignof(Noh) <= alignof(void*), "O tipo T exige alinhamento maior do que o garantido pelo PoolNoh.");
+
+	/* Encontra o nó da posição "pos", percorrendo a lista a partir da extremidade mais próxima. */
+	Noh* localizar(int pos) {
+		Noh* aux;
+		if (pos < tam / 2) {
+			aux = inicio;
+			for (int i = 0; i < pos; i++) {
+				aux = aux->prox;
+			}
+		} else {
+			aux = fim;
+			for (int i = tam - 1; i > pos; i--) {
+				aux = aux->ant;
+			}
+		}
+		return aux;
+	}
+
+	Noh* inicio; /**< É um ponteiro para o início da lista. */
+	Noh* fim; /**< É um ponteiro para o fim da lista. */
+	int tam; /**< Representa a quantidade de elementos da lista. */
+	PoolNoh* pool; /**< Pool de onde são alocados os nós da lista. */
+};
+
+}
+
+#endif
@@ -0,0 +1,174 @@
+/**
+ * \file listaenc.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Interface e implementação do TAD genérico generica::ListaEnc
+ *
+ * Versão genérica da ListaEnc (encadeada/listaenc.hpp): cada nó guarda um elemento de qualquer
+ * tipo T diretamente, ao lado do ponteiro para o próximo nó. Assim como na versão original, os nós
+ * são alocados de um PoolNoh (encadeada/poolnoh.hpp), de modo que o programa deve ser ligado
+ * também com encadeada/poolnoh.cpp (no CMake, o alvo estruturas_generica já inclui a biblioteca
+ * estruturas_pool).
+ *
+ * Os elementos nunca são copiados pela lista: \p construir constrói o objeto diretamente no nó
+ * e \p remover devolve o elemento removido por movimentação.
+ */
+
+#ifndef GENERICA_LISTAENC_HPP
+#define GENERICA_LISTAENC_HPP
+
+#include <assert.h> /**< Necessário para uso da macro "assert". */
+#include <cstdlib> /**< Necessário para uso do NULL. */
+#include <new> /**< Necessário para uso do "new" de posicionamento. */
+#include <utility> /**< Necessário para uso das funções "std::move" e "std::forward". */
+#include "../encadeada/poolnoh.hpp"
+
+namespace generica {
+
+/**
+ * \class ListaEnc
+ * \brief Lista simplesmente encadeada, cujos elementos são do tipo T.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include<string>
+ * #include "generica/listaenc.hpp"
+ *
+ * using namespace std;
+ *
+ * int main() {
+ *     generica::ListaEnc<string> li;
+ *     li.inserir("um", 0);
+ *     li.inserir("tres", 1);
+ *     li.construir(1, "dois");
+ *     for (int i = 0; i < li.obter_tamanho(); i++) {
+ *         cout << li.obter_elemento(i) << " ";
+ *     }
+ *     cout << endl;
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * Saída esperada:
+ * \code {.unparsed}
+ *     um dois tres
+ * \endcode
+ */
+template <typename T>
+class ListaEnc {
+public:
+	/** \brief Cria uma lista vazia. */
+	ListaEnc() : inicio(NULL), tam(0), pool(criar_pool(sizeof(Noh), NOHS_POR_BLOCO)) {}
+
+	/** \brief Destrói os elementos que ainda estiverem na lista e libera os nós. */
+	~ListaEnc() {
+		while (inicio != NULL) {
+			Noh* aux = inicio;
+			inicio = inicio->prox;
+			aux->~Noh();
+		}
+		liberar_pool(pool);
+	}
+
+	ListaEnc(const ListaEnc&) = delete;
+	ListaEnc& operator=(const ListaEnc&) = delete;
+
+	/** \brief Verifica se a lista está vazia. */
+	bool estah_vazia() const {
+		return (inicio == NULL);
+	}
+
+	/**
+	 * \brief Insere uma cópia de \p item na posição \p pos (ou move \p item, se ele for um rvalue).
+	 * \warning O programa será abortado, caso \p pos não esteja em [0, TAM].
+	 */
+	void inserir(const T& item, int pos) {
+		construir(pos, item);
+	}
+
+	/** \copydoc inserir(const T&, int) */
+	void inserir(T&& item, int pos) {
+		construir(pos, std::move(item));
+	}
+
+	/**
+	 * \brief Constrói um novo elemento diretamente na posição \p pos, repassando \p args ao construtor de T.
+	 * \warning O programa será abortado, caso \p pos não esteja em [0, TAM].
+	 */
+	template <typename... Args>
+	void construir(int pos, Args&&... args) {
+		assert((pos >= 0) && (pos <= tam));
+
+		// Encontra o ponteiro que deve passar a apontar para o novo nó
+		Noh** ligacao = &inicio;
+		for (int i = 0; i < pos; i++) {
+			ligacao = &(*ligacao)->prox;
+		}
+		*ligacao = ::new (alocar_noh(pool)) Noh(*ligacao, std::forward<Args>(args)...);
+		tam++;
+	}
+
+	/**
+	 * \brief Remove e retorna, por movimentação, o elemento da posição \p pos.
+	 * \warning O programa será abortado, caso a lista esteja vazia ou \p pos não esteja em [0, TAM - 1].
+	 */
+	T remover(int pos) {
+		assert(!estah_vazia());
+		assert((pos >= 0) && (pos < tam));
+
+		Noh** ligacao = &inicio;
+		for (int i = 0; i < pos; i++) {
+			ligacao = &(*ligacao)->prox;
+		}
+		Noh* aux = *ligacao;
+		*ligacao = aux->prox;
+
+		T item(std::move(aux->item));
+		aux->~Noh();
+		devolver_noh(pool, aux);
+		tam--;
+		return item;
+	}
+
+	/**
+	 * \brief Apenas retorna uma referência para o elemento da posição \p pos.
+	 * \warning O programa será abortado, caso a lista esteja vazia ou \p pos não esteja em [0, TAM - 1].
+	 */
+	T& obter_elemento(int pos) {
+		assert(!estah_vazia());
+		assert((pos >= 0) && (pos < tam));
+
+		Noh* aux = inicio;
+		for (int i = 0; i < pos; i++) {
+			aux = aux->prox;
+		}
+		return aux->item;
+	}
+
+	/** \brief Retorna a quantidade de elementos da lista. */
+	int obter_tamanho() const {
+		return tam;
+	}
+
+private:
+	struct Noh {
+		template <typename... Args>
+		Noh(Noh* p, Args&&... args) : item(std::forward<Args>(args)...), prox(p) {}
+
+		T item; /**< Representa a informação a ser armazenada em cada nó da lista. */
+		Noh* prox; /**< É um ponteiro para o próximo nó da lista. */
+	};
+
+	/* O pool garante apenas o alinhamento de um ponteiro para cada nó. */
+	static_assert(alignof(Noh) <= alignof(void*), "O tipo T exige alinhamento maior do que o garantido pelo PoolNoh.");
+
+	Noh* inicio; /**< É um ponteiro para o início da lista. */
+	int tam; /**< Representa a quantidade de elementos da lista. */
+	PoolNoh* pool; /**< Pool de onde são alocados os nós da lista. */
+};
+
+}
+
+#endif
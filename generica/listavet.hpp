@@ -0,0 +1,170 @@
+/**
+ * \file listavet.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Interface e implementação do TAD genérico generica::ListaVet
+ *
+ * Versão genérica da ListaVet (array/listavet.hpp): os elementos, de qualquer tipo T, são guardados
+ * diretamente no vetor da lista.
+ *
+ * Os elementos nunca são copiados pela lista: os deslocamentos das inserções e remoções no meio
+ * da lista movem os elementos, \p construir constrói o novo objeto diretamente na sua posição e
+ * \p remover devolve o elemento removido por movimentação.
+ *
+ * A capacidade é o parâmetro N do modelo (ListaVet<T, N>), fixado na compilação. O vetor faz parte do
+ * próprio objeto, sem nenhuma alocação dinâmica: a lista pode ser uma variável local, um membro de
+ * outra estrutura ou, com o "new" de posicionamento, ser construída em uma região de memória
+ * compartilhada (neste caso, T não deve conter ponteiros).
+ */
+
+#ifndef GENERICA_LISTAVET_HPP
+#define GENERICA_LISTAVET_HPP
+
+#include <assert.h> /**< Necessário para uso da macro "assert". */
+#include "celula.hpp"
+
+namespace generica {
+
+/**
+ * \class ListaVet
+ * \brief Lista com arranjo de capacidade N, cujos elementos são do tipo T.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include<string>
+ * #include "generica/listavet.hpp"
+ *
+ * using namespace std;
+ *
+ * int main() {
+ *     generica::ListaVet<string> li;
+ *     li.inserir("um", 0);
+ *     li.inserir("tres", 1);
+ *     li.construir(1, "dois");
+ *     for (int i = 0; i < li.obter_tamanho(); i++) {
+ *         cout << li.obter(i) << " ";
+ *     }
+ *     cout << endl;
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * Saída esperada:
+ * \code {.unparsed}
+ *     um dois tres
+ * \endcode
+ */
+template <typename T, int N = 100>
+class ListaVet {
+public:
+	/** \brief Quantidade máxima de elementos suportada pela lista. */
+	static const int TAM_MAX = N;
+
+	static_assert(N >= 1, "A capacidade deve ser positiva.");
+
+	/** \brief Cria uma lista vazia. */
+	ListaVet() : ultimo(0) {}
+
+	/** \brief Destrói os elementos que ainda estiverem na lista. */
+	~ListaVet() {
+		while (ultimo > 0) {
+			itens[--ultimo].destruir();
+		}
+	}
+
+	ListaVet(const ListaVet&) = delete;
+	ListaVet& operator=(const ListaVet&) = delete;
+
+	/** \brief Verifica se a lista está vazia. */
+	bool estah_vazia() const {
+		return (ultimo == 0);
+	}
+
+	/** \brief Verifica se a lista está cheia. */
+	bool estah_cheia() const {
+		return (ultimo == TAM_MAX);
+	}
+
+	/**
+	 * \brief Insere uma cópia de \p item na posição \p pos (ou move \p item, se ele for um rvalue).
+	 * \warning O programa será abortado, caso a lista esteja cheia ou \p pos não esteja em [0, TAM].
+	 */
+	void inserir(const T& item, int pos) {
+		construir(pos, item);
+	}
+
+	/** \copydoc inserir(const T&, int) */
+	void inserir(T&& item, int pos) {
+		construir(pos, std::move(item));
+	}
+
+	/**
+	 * \brief Constrói um novo elemento diretamente na posição \p pos, repassando \p args ao construtor de T.
+	 * \warning O programa será abortado, caso a lista esteja cheia ou \p pos não esteja em [0, TAM].
+	 */
+	template <typename... Args>
+	void construir(int pos, Args&&... args) {
+		assert(!estah_cheia());
+		assert((pos >= 0) && (pos <= ultimo));
+
+		if (pos < ultimo) {
+			/*
+			 * Desloca os elementos uma posição para a direita: o último é movido para a célula
+			 * livre e os demais são movidos sobre o seu vizinho da direita. Em seguida, o elemento
+			 * que restou (já movido) na posição "pos" é destruído, liberando a célula.
+			 */
+			itens[ultimo].construir(std::move(itens[ultimo - 1].valor));
+			for (int i = ultimo - 1; i > pos; i--) {
+				itens[i].valor = std::move(itens[i - 1].valor);
+			}
+			itens[pos].destruir();
+		}
+		itens[pos].construir(std::forward<Args>(args)...);
+		ultimo++;
+	}
+
+	/**
+	 * \brief Remove e retorna, por movimentação, o elemento da posição \p pos.
+	 * \warning O programa será abortado, caso a lista esteja vazia ou \p pos não esteja em [0, TAM - 1].
+	 */
+	T remover(int pos) {
+		assert(!estah_vazia());
+		assert((pos >= 0) && (pos < ultimo));
+
+		T item(std::move(itens[pos].valor));
+
+		/* Desloca os elementos uma posição para a esquerda e destrói o último, que ficou vazio. */
+		for (int i = pos; i < ultimo - 1; i++) {
+			itens[i].valor = std::move(itens[i + 1].valor);
+		}
+		ultimo--;
+		itens[ultimo].destruir();
+		return item;
+	}
+
+	/**
+	 * \brief Apenas retorna uma referência para o elemento da posição \p pos.
+	 * \warning O programa será abortado, caso a lista esteja vazia ou \p pos não esteja em [0, TAM - 1].
+	 */
+	T& obter(int pos) {
+		assert(!estah_vazia());
+		assert((pos >= 0) && (pos < ultimo));
+
+		return itens[pos].valor;
+	}
+
+	/** \brief Retorna a quantidade de elementos da lista. */
+	int obter_tamanho() const {
+		return ultimo;
+	}
+
+private:
+	Celula<T> itens[TAM_MAX]; /**< Vetor que armazena os elementos da lista. */
+	int ultimo; /**< Variável que indica a próxima posição vazia da lista. */
+};
+
+}
+
+#endif
@@ -0,0 +1,141 @@
+/**
+ * \file pilhaenc.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Interface e implementação do TAD genérico generica::PilhaEnc
+ *
+ * Versão genérica da PilhaEnc (encadeada/pilhaenc.hpp): cada nó guarda um elemento de qualquer
+ * tipo T diretamente, ao lado do ponteiro para o próximo nó. Assim como na versão original, os nós
+ * são alocados de um PoolNoh (encadeada/poolnoh.hpp), de modo que o programa deve ser ligado
+ * também com encadeada/poolnoh.cpp (no CMake, o alvo estruturas_generica já inclui a biblioteca
+ * estruturas_pool).
+ *
+ * Os elementos nunca são copiados pela pilha: \p construir_no_topo constrói o objeto diretamente
+ * no nó e \p desempilhar devolve o elemento removido por movimentação.
+ */
+
+#ifndef GENERICA_PILHAENC_HPP
+#define GENERICA_PILHAENC_HPP
+
+#include <assert.h> /**< Necessário para uso da macro "assert". */
+#include <cstdlib> /**< Necessário para uso do NULL. */
+#include <new> /**< Necessário para uso do "new" de posicionamento. */
+#include <utility> /**< Necessário para uso das funções "std::move" e "std::forward". */
+#include "../encadeada/poolnoh.hpp"
+
+namespace generica {
+
+/**
+ * \class PilhaEnc
+ * \brief Pilha encadeada, cujos elementos são do tipo T.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include<string>
+ * #include "generica/pilhaenc.hpp"
+ *
+ * using namespace std;
+ *
+ * int main() {
+ *     generica::PilhaEnc<string> p;
+ *     p.empilhar("AED");
+ *     p.construir_no_topo(3, 'x');
+ *     while (!p.estah_vazia()) {
+ *         cout << p.desempilhar() << endl;
+ *     }
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * Saída esperada:
+ * \code {.unparsed}
+ *     xxx
+ *     AED
+ * \endcode
+ */
+template <typename T>
+class PilhaEnc {
+public:
+	/** \brief Cria uma pilha vazia. */
+	PilhaEnc() : topo(NULL), pool(criar_pool(sizeof(Noh), NOHS_POR_BLOCO)) {}
+
+	/** \brief Destrói os elementos que ainda estiverem na pilha e libera os nós. */
+	~PilhaEnc() {
+		while (topo != NULL) {
+			Noh* aux = topo;
+			topo = topo->prox;
+			aux->~Noh();
+		}
+		liberar_pool(pool);
+	}
+
+	PilhaEnc(const PilhaEnc&) = delete;
+	PilhaEnc& operator=(const PilhaEnc&) = delete;
+
+	/** \brief Verifica se a pilha está vazia. */
+	bool estah_vazia() const {
+		return (topo == NULL);
+	}
+
+	/** \brief Empilha uma cópia de \p item (ou move \p item para a pilha, se ele for um rvalue). */
+	void empilhar(const T& item) {
+		construir_no_topo(item);
+	}
+
+	/** \copydoc empilhar(const T&) */
+	void empilhar(T&& item) {
+		construir_no_topo(std::move(item));
+	}
+
+	/** \brief Constrói um novo elemento diretamente no topo da pilha, repassando \p args ao construtor de T. */
+	template <typename... Args>
+	void construir_no_topo(Args&&... args) {
+		topo = ::new (alocar_noh(pool)) Noh(topo, std::forward<Args>(args)...);
+	}
+
+	/**
+	 * \brief Remove e retorna, por movimentação, o elemento do topo da pilha.
+	 * \warning O programa será abortado, caso a pilha esteja vazia.
+	 */
+	T desempilhar() {
+		assert(!estah_vazia());
+
+		Noh* aux = topo;
+		topo = topo->prox;
+		T item(std::move(aux->item));
+		aux->~Noh();
+		devolver_noh(pool, aux);
+		return item;
+	}
+
+	/**
+	 * \brief Apenas retorna uma referência para o elemento do topo da pilha.
+	 * \warning O programa será abortado, caso a pilha esteja vazia.
+	 */
+	T& obter_topo() {
+		assert(!estah_vazia());
+
+		return topo->item;
+	}
+
+private:
+	struct Noh {
+		template <typename... Args>
+		Noh(Noh* p, Args&&... args) : item(std::forward<Args>(args)...), prox(p) {}
+
+		T item; /**< Representa a informação a ser armazenada em cada nó da pilha. */
+		Noh* prox; /**< É um ponteiro para o próximo nó da pilha. */
+	};
+
+	/* O pool garante apenas o alinhamento de um ponteiro para cada nó. */
+	static_assert(alignof(Noh) <= alignof(void*), "O tipo T exige alinhamento maior do que o garantido pelo PoolNoh.");
+
+	Noh* topo; /**< É um ponteiro para o topo da pilha. */
+	PoolNoh* pool; /**< Pool de onde são alocados os nós da pilha. */
+};
+
+}
+
+#endif
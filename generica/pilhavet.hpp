@@ -0,0 +1,145 @@
+/**
+ * \file pilhavet.hpp
+ * \author Prof. Paulo Afonso (pauloa.junior@dcc.ufla.br)
+ * \date Outubro, 2026
+ * \brief Interface e implementação do TAD genérico generica::PilhaVet
+ *
+ * Versão genérica da PilhaVet (array/pilhavet.hpp): os elementos, de qualquer tipo T, são guardados
+ * diretamente no vetor da pilha, e não por meio de ponteiros. Por ser um modelo (template), toda a
+ * implementação fica neste arquivo.
+ *
+ * Os elementos nunca são copiados pela pilha: \p empilhar recebe um objeto que é copiado ou movido
+ * para o vetor (conforme seja um lvalue ou um rvalue), \p construir_no_topo constrói o objeto
+ * diretamente no vetor e \p desempilhar devolve o elemento removido por movimentação.
+ *
+ * A capacidade é o parâmetro N do modelo (PilhaVet<T, N>), fixado na compilação. O vetor faz parte do
+ * próprio objeto, sem nenhuma alocação dinâmica: a pilha pode ser uma variável local, um membro de
+ * outra estrutura ou, com o "new" de posicionamento, ser construída em uma região de memória
+ * compartilhada (neste caso, T não deve conter ponteiros).
+ */
+
+#ifndef GENERICA_PILHAVET_HPP
+#define GENERICA_PILHAVET_HPP
+
+#include <assert.h> /**< Necessário para uso da macro "assert". */
+#include "celula.hpp"
+
+namespace generica {
+
+/**
+ * \class PilhaVet
+ * \brief Pilha com arranjo de capacidade N, cujos elementos são do tipo T.
+ *
+ * Exemplo de uso:
+ * \code {.cpp}
+ * #include<cstdlib>
+ * #include<iostream>
+ * #include<string>
+ * #include "generica/pilhavet.hpp"
+ *
+ * using namespace std;
+ *
+ * int main() {
+ *     generica::PilhaVet<string> p;
+ *     p.empilhar("AED");
+ *     p.construir_no_topo(3, 'x');
+ *     while (!p.estah_vazia()) {
+ *         cout << p.desempilhar() << endl;
+ *     }
+ *     return EXIT_SUCCESS;
+ * }
+ * \endcode
+ *
+ * Saída esperada:
+ * \code {.unparsed}
+ *     xxx
+ *     AED
+ * \endcode
+ */
+template <typename T, int N = 100>
+class PilhaVet {
+public:
+	/** \brief Quantidade máxima de elementos suportada pela pilha. */
+	static const int TAM_MAX = N;
+
+	static_assert(N >= 1, "A capacidade deve ser positiva.");
+
+	/** \brief Cria uma pilha vazia. */
+	PilhaVet() : topo(0) {}
+
+	/** \brief Destrói os elementos que ainda estiverem na pilha. */
+	~PilhaVet() {
+		while (topo > 0) {
+			itens[--topo].destruir();
+		}
+	}
+
+	PilhaVet(const PilhaVet&) = delete;
+	PilhaVet& operator=(const PilhaVet&) = delete;
+
+	/** \brief Verifica se a pilha está vazia. */
+	bool estah_vazia() const {
+		return (topo == 0);
+	}
+
+	/** \brief Verifica se a pilha está cheia. */
+	bool estah_cheia() const {
+		return (topo == TAM_MAX);
+	}
+
+	/**
+	 * \brief Empilha uma cópia de \p item (ou move \p item para a pilha, se ele for um rvalue).
+	 * \warning O programa será abortado, caso a pilha esteja cheia.
+	 */
+	void empilhar(const T& item) {
+		construir_no_topo(item);
+	}
+
+	/** \copydoc empilhar(const T&) */
+	void empilhar(T&& item) {
+		construir_no_topo(std::move(item));
+	}
+
+	/**
+	 * \brief Constrói um novo elemento diretamente no topo da pilha, repassando \p args ao construtor de T.
+	 * \warning O programa será abortado, caso a pilha esteja cheia.
+	 */
+	template <typename... Args>
+	void construir_no_topo(Args&&... args) {
+		assert(!estah_cheia());
+
+		itens[topo].construir(std::forward<Args>(args)...);
+		topo++;
+	}
+
+	/**
+	 * \brief Remove e retorna, por movimentação, o elemento do topo da pilha.
+	 * \warning O programa será abortado, caso a pilha esteja vazia.
+	 */
+	T desempilhar() {
+		assert(!estah_vazia());
+
+		topo--;
+		T item(std::move(itens[topo].valor));
+		itens[topo].destruir();
+		return item;
+	}
+
+	/**
+	 * \brief Apenas retorna uma referência para o elemento do topo da pilha.
+	 * \warning O programa será abortado, caso a pilha esteja vazia.
+	 */
+	T& obter_topo() {
+		assert(!estah_vazia());
+
+		return itens[topo - 1].valor;
+	}
+
+private:
+	Celula<T> itens[TAM_MAX]; /**< Vetor que armazena os elementos da pilha. */
+	int topo; /**< Variável que indica a próxima posição vazia da pilha. */
+};
+
+}
+
+#endif